@@ -0,0 +1,347 @@
+#include "bench_util.h"
+
+#include "libcartilage.h"
+
+#include <stddef.h>
+
+/* Batch sizes are chosen such that each sample does roughly the same amount of work regardless of complexity */
+#define BATCH_CONSTANT 1024
+#define BATCH_LINEAR_WORK 100000
+
+/**
+ * Environment
+ */
+
+typedef struct bench_item {
+	size_t key;
+	glthread_t glthread;
+	glthread_t link;
+} item_t;
+
+typedef struct bench_ctx {
+	size_t n;
+	CircularSinglyLinkedList* ll;
+	CircularSinglyLinkedList* copy;
+	ForwardNode_t* scratch[BATCH_CONSTANT];
+	glthread_t head;
+	glthread_list_t list;
+	item_t* items;
+	item_t spare[BATCH_CONSTANT];
+	glthread_t* gscratch[BATCH_CONSTANT];
+} ctx_t;
+
+int comparator(void* a, void* b) {
+	size_t ka = ((item_t*)a)->key;
+	size_t kb = ((item_t*)b)->key;
+
+	if (ka == kb) return 0;
+	return ka < kb ? -1 : 1;
+}
+
+void noop(void* n) {
+	(void)n;
+}
+
+/**
+ * CircularSinglyLinkedList operations
+ */
+
+void op_csll_push_back(void* c, size_t i) {
+	csll_push_back(((ctx_t*)c)->ll, (void*)i);
+}
+
+void op_csll_push_front(void* c, size_t i) {
+	csll_push_front(((ctx_t*)c)->ll, (void*)i);
+}
+
+void undo_csll_push(void* c, size_t batch) {
+	ctx_t* ctx = c;
+
+	for (size_t i = 0; i < batch; i++) csll_release_node(ctx->ll, csll_pop_front(ctx->ll));
+}
+
+void op_csll_pop_front(void* c, size_t i) {
+	ctx_t* ctx = c;
+
+	ctx->scratch[i] = csll_pop_front(ctx->ll);
+}
+
+void op_csll_pop(void* c, size_t i) {
+	ctx_t* ctx = c;
+
+	ctx->scratch[i] = csll_pop(ctx->ll);
+}
+
+void op_csll_remove_node(void* c, size_t i) {
+	ctx_t* ctx = c;
+
+	ctx->scratch[i] = csll_remove_node(ctx->ll, ctx->ll->head);
+}
+
+void undo_csll_remove(void* c, size_t batch) {
+	ctx_t* ctx = c;
+
+	for (size_t i = 0; i < batch; i++) {
+		csll_release_node(ctx->ll, ctx->scratch[i]);
+		csll_push_back(ctx->ll, (void*)i);
+	}
+}
+
+void op_csll_insert_after(void* c, size_t i) {
+	ctx_t* ctx = c;
+
+	csll_insert_after(ctx->ll, (void*)i, ctx->ll->head);
+}
+
+void undo_csll_insert_after(void* c, size_t batch) {
+	ctx_t* ctx = c;
+
+	for (size_t i = 0; i < batch; i++) {
+		csll_release_node(ctx->ll, csll_remove_node(ctx->ll, ctx->ll->head->next));
+	}
+}
+
+void op_csll_insert_before(void* c, size_t i) {
+	ctx_t* ctx = c;
+
+	csll_insert_before(ctx->ll, (void*)i, ctx->ll->tail);
+}
+
+void undo_csll_insert_before(void* c, size_t batch) {
+	ctx_t* ctx = c;
+
+	for (size_t i = 0; i < batch; i++) {
+		csll_release_node(ctx->ll, csll_remove_node(ctx->ll, csll_prev(ctx->ll, ctx->ll->tail)));
+	}
+}
+
+void op_csll_move_after(void* c, size_t i) {
+	ctx_t* ctx = c;
+	(void)i;
+
+	csll_move_after(ctx->ll, ctx->ll->head->next, ctx->ll->tail);
+}
+
+void op_csll_move_before(void* c, size_t i) {
+	ctx_t* ctx = c;
+	(void)i;
+
+	csll_move_before(ctx->ll, ctx->ll->head, ctx->ll->tail);
+}
+
+void op_csll_next(void* c, size_t i) {
+	ctx_t* ctx = c;
+
+	ctx->scratch[i] = csll_next(ctx->ll, ctx->ll->head);
+}
+
+void op_csll_prev(void* c, size_t i) {
+	ctx_t* ctx = c;
+
+	ctx->scratch[i] = csll_prev(ctx->ll, ctx->ll->tail);
+}
+
+void op_csll_iterate(void* c, size_t i) {
+	(void)i;
+
+	csll_iterate(((ctx_t*)c)->ll, noop);
+}
+
+void op_csll_push_back_list(void* c, size_t i) {
+	ctx_t* ctx = c;
+	(void)i;
+
+	csll_push_back_list(ctx->copy, ctx->ll);
+}
+
+void op_csll_push_front_list(void* c, size_t i) {
+	ctx_t* ctx = c;
+	(void)i;
+
+	csll_push_front_list(ctx->copy, ctx->ll);
+}
+
+void undo_csll_push_list(void* c, size_t batch) {
+	ctx_t* ctx = c;
+	(void)batch;
+
+	csll_destroy_list(ctx->copy);
+	ctx->copy = csll_make_list();
+}
+
+/**
+ * GlThread operations
+ */
+
+void op_glthread_push(void* c, size_t i) {
+	ctx_t* ctx = c;
+
+	glthread_push(&ctx->head, &ctx->spare[i].glthread);
+}
+
+void op_glthread_priority_insert(void* c, size_t i) {
+	ctx_t* ctx = c;
+
+	glthread_priority_insert(&ctx->head, &ctx->spare[i].glthread, comparator, offsetof(item_t, glthread));
+}
+
+void undo_glthread_insert(void* c, size_t batch) {
+	ctx_t* ctx = c;
+
+	for (size_t i = 0; i < batch; i++) {
+		glthread_remove(&ctx->spare[i].glthread);
+		glthread_init(&ctx->spare[i].glthread);
+	}
+}
+
+void op_glthread_remove(void* c, size_t i) {
+	ctx_t* ctx = c;
+	glthread_t* first = ctx->head.next;
+
+	glthread_remove(first);
+	ctx->gscratch[i] = first;
+}
+
+void op_glthread_dequeue_first(void* c, size_t i) {
+	ctx_t* ctx = c;
+
+	ctx->gscratch[i] = glthread_dequeue_first(&ctx->head);
+}
+
+void undo_glthread_dequeue(void* c, size_t batch) {
+	ctx_t* ctx = c;
+
+	// reinsert in reverse such that the chain remains ordered
+	for (size_t i = batch; i > 0; i--) {
+		glthread_init(ctx->gscratch[i - 1]);
+		glthread_insert_after(&ctx->head, ctx->gscratch[i - 1]);
+	}
+}
+
+void op_glthread_size(void* c, size_t i) {
+	ctx_t* ctx = c;
+
+	ctx->spare[i].key = glthread_size(&ctx->head);
+}
+
+void op_glthread_list_push(void* c, size_t i) {
+	ctx_t* ctx = c;
+
+	glthread_list_push(&ctx->list, &ctx->spare[i].link);
+}
+
+void undo_glthread_list_push(void* c, size_t batch) {
+	ctx_t* ctx = c;
+
+	for (size_t i = 0; i < batch; i++) glthread_list_pop(&ctx->list);
+}
+
+void op_glthread_list_dequeue_first(void* c, size_t i) {
+	ctx_t* ctx = c;
+
+	ctx->gscratch[i] = glthread_list_dequeue_first(&ctx->list);
+}
+
+void undo_glthread_list_dequeue(void* c, size_t batch) {
+	ctx_t* ctx = c;
+
+	for (size_t i = batch; i > 0; i--) glthread_list_push_front(&ctx->list, ctx->gscratch[i - 1]);
+}
+
+void op_glthread_list_size(void* c, size_t i) {
+	ctx_t* ctx = c;
+
+	ctx->spare[i].key = glthread_list_size(&ctx->list);
+}
+
+/**
+ * Lifecycle
+ */
+
+ctx_t* setup(size_t n) {
+	ctx_t* ctx = malloc(sizeof(ctx_t));
+
+	ctx->n = n;
+	ctx->ll = csll_make_list();
+	ctx->copy = csll_make_list();
+	ctx->items = malloc(n * sizeof(item_t));
+
+	glthread_init(&ctx->head);
+	glthread_list_init(&ctx->list);
+
+	glthread_t* last = &ctx->head;
+
+	for (size_t i = 0; i < n; i++) {
+		csll_push_back(ctx->ll, (void*)i);
+
+		ctx->items[i].key = i;
+		glthread_init(&ctx->items[i].glthread);
+		glthread_insert_after(last, &ctx->items[i].glthread);
+		last = &ctx->items[i].glthread;
+
+		glthread_list_push(&ctx->list, &ctx->items[i].link);
+	}
+
+	for (size_t i = 0; i < BATCH_CONSTANT; i++) {
+		ctx->spare[i].key = random() % n;
+		glthread_init(&ctx->spare[i].glthread);
+	}
+
+	return ctx;
+}
+
+void teardown(ctx_t* ctx) {
+	csll_destroy_list(ctx->ll);
+	csll_destroy_list(ctx->copy);
+	free(ctx->items);
+	free(ctx);
+}
+
+/**
+ * Runner
+ */
+
+int main(int argc, char** argv) {
+	size_t max_n = bench_max_n(argc, argv);
+
+	BENCH_HEADER();
+
+	for (size_t n = BENCH_MIN_N; n <= max_n; n *= 10) {
+		ctx_t* ctx = setup(n);
+
+		size_t constant = n < BATCH_CONSTANT ? n : BATCH_CONSTANT;
+		size_t linear = BATCH_LINEAR_WORK / n;
+
+		if (linear > constant) linear = constant;
+		if (linear < 1) linear = 1;
+
+		bench_measure("csll_push_back", n, constant, op_csll_push_back, undo_csll_push, ctx);
+		bench_measure("csll_push_front", n, constant, op_csll_push_front, undo_csll_push, ctx);
+		bench_measure("csll_pop_front", n, constant, op_csll_pop_front, undo_csll_remove, ctx);
+		bench_measure("csll_pop", n, linear, op_csll_pop, undo_csll_remove, ctx);
+		bench_measure("csll_remove_node", n, constant, op_csll_remove_node, undo_csll_remove, ctx);
+		bench_measure("csll_insert_after", n, constant, op_csll_insert_after, undo_csll_insert_after, ctx);
+		bench_measure("csll_insert_before", n, linear, op_csll_insert_before, undo_csll_insert_before, ctx);
+		bench_measure("csll_move_after", n, constant, op_csll_move_after, NULL, ctx);
+		bench_measure("csll_move_before", n, linear, op_csll_move_before, NULL, ctx);
+		bench_measure("csll_next", n, constant, op_csll_next, NULL, ctx);
+		bench_measure("csll_prev", n, linear, op_csll_prev, NULL, ctx);
+		bench_measure("csll_iterate", n, linear, op_csll_iterate, NULL, ctx);
+		bench_measure("csll_push_back_list", n, linear, op_csll_push_back_list, undo_csll_push_list, ctx);
+		bench_measure("csll_push_front_list", n, linear, op_csll_push_front_list, undo_csll_push_list, ctx);
+
+		bench_measure("glthread_push", n, linear, op_glthread_push, undo_glthread_insert, ctx);
+		bench_measure("glthread_priority_insert", n, linear, op_glthread_priority_insert, undo_glthread_insert, ctx);
+		bench_measure("glthread_remove", n, constant, op_glthread_remove, undo_glthread_dequeue, ctx);
+		bench_measure("glthread_dequeue_first", n, constant, op_glthread_dequeue_first, undo_glthread_dequeue, ctx);
+		bench_measure("glthread_size", n, linear, op_glthread_size, NULL, ctx);
+
+		bench_measure("glthread_list_push", n, constant, op_glthread_list_push, undo_glthread_list_push, ctx);
+		bench_measure("glthread_list_dequeue_first", n, constant, op_glthread_list_dequeue_first, undo_glthread_list_dequeue, ctx);
+		bench_measure("glthread_list_size", n, constant, op_glthread_list_size, NULL, ctx);
+
+		teardown(ctx);
+	}
+
+	return EXIT_SUCCESS;
+}
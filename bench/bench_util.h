@@ -0,0 +1,111 @@
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define BENCH_MIN_N 10
+#define BENCH_MAX_N 1000000
+
+#define BENCH_SAMPLES 32
+
+/* Every benchmark emits CSV rows in this format, such that runs of different builds may be diffed */
+#define BENCH_HEADER() printf("case,n,ops,ns_per_op,ops_per_sec,p50_ns,p90_ns,p99_ns\n")
+
+/**
+ * @brief Monotonic timestamp in nanoseconds
+ *
+ * @return uint64_t
+ */
+uint64_t bench_now(void) {
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Print a single result row for `ops` operations that took `elapsed` nanoseconds
+ *
+ * @param name
+ * @param n
+ * @param ops
+ * @param elapsed
+ */
+void bench_report(const char* name, size_t n, size_t ops, uint64_t elapsed) {
+	double ns_per_op = ops ? (double)elapsed / (double)ops : 0;
+	double ops_per_sec = elapsed ? (double)ops * 1e9 / (double)elapsed : 0;
+
+	printf("%s,%zu,%zu,%.2f,%.0f,,,\n", name, n, ops, ns_per_op, ops_per_sec);
+}
+
+int __bench_compare_double(const void* a, const void* b) {
+	double da = *(const double*)a, db = *(const double*)b;
+
+	return (da > db) - (da < db);
+}
+
+/**
+ * @brief Time `samples` batches of `batch` invocations of `op`, and report the mean and per-batch ns/op percentiles
+ *
+ * `undo`, if provided, is invoked untimed after each batch to restore the state `op` expects (e.g. the list size)
+ *
+ * @param name
+ * @param n
+ * @param batch
+ * @param op
+ * @param undo
+ * @param ctx
+ */
+void bench_measure(
+	const char* name,
+	size_t n,
+	size_t batch,
+	void (*op)(void* ctx, size_t i),
+	void (*undo)(void* ctx, size_t batch),
+	void* ctx
+) {
+	double per_op[BENCH_SAMPLES];
+	uint64_t total = 0;
+
+	for (int s = 0; s < BENCH_SAMPLES; s++) {
+		uint64_t start = bench_now();
+
+		for (size_t i = 0; i < batch; i++) op(ctx, i);
+
+		uint64_t elapsed = bench_now() - start;
+
+		total += elapsed;
+		per_op[s] = (double)elapsed / (double)batch;
+
+		if (undo) undo(ctx, batch);
+	}
+
+	qsort(per_op, BENCH_SAMPLES, sizeof(double), __bench_compare_double);
+
+	size_t ops = batch * BENCH_SAMPLES;
+
+	printf("%s,%zu,%zu,%.2f,%.0f,%.2f,%.2f,%.2f\n",
+		name, n, ops,
+		(double)total / (double)ops,
+		total ? (double)ops * 1e9 / (double)total : 0,
+		per_op[BENCH_SAMPLES / 2],
+		per_op[BENCH_SAMPLES * 9 / 10],
+		per_op[BENCH_SAMPLES * 99 / 100]);
+}
+
+/**
+ * @brief Read the largest list size to benchmark from argv, if given
+ *
+ * @param argc
+ * @param argv
+ * @return size_t
+ */
+size_t bench_max_n(int argc, char** argv) {
+	return argc > 1 ? strtoull(argv[1], NULL, 10) : BENCH_MAX_N;
+}
+
+#endif
@@ -0,0 +1,70 @@
+#include "bench_util.h"
+
+#include "libcartilage.h"
+
+#define CHURN_OPS 10000
+#define CSLL_MAX_N 100000
+
+/**
+ * Benchmarks
+ */
+
+void bench_csll_churn(size_t n) {
+	CircularSinglyLinkedList* ll = csll_make_list();
+	ForwardNode_t** nodes = malloc(n * sizeof(ForwardNode_t*));
+
+	for (size_t i = 0; i < n; i++) nodes[i] = csll_push_back(ll, (void*)i);
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < CHURN_OPS; i++) {
+		size_t victim = random() % n;
+
+		csll_release_node(ll, csll_remove_node(ll, nodes[victim]));
+		nodes[victim] = csll_push_back(ll, (void*)victim);
+	}
+
+	bench_report("csll remove_node+push_back", n, CHURN_OPS, bench_now() - start);
+
+	free(nodes);
+	csll_destroy_list(ll);
+}
+
+void bench_cdll_churn(size_t n) {
+	CircularDoublyLinkedList* ll = cdll_make_list();
+	BidirectionalNode_t** nodes = malloc(n * sizeof(BidirectionalNode_t*));
+
+	for (size_t i = 0; i < n; i++) nodes[i] = cdll_push_back(ll, (void*)i);
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < CHURN_OPS; i++) {
+		size_t victim = random() % n;
+
+		cdll_release_node(ll, cdll_remove_node(ll, nodes[victim]));
+		nodes[victim] = cdll_push_back(ll, (void*)victim);
+	}
+
+	bench_report("cdll remove_node+push_back", n, CHURN_OPS, bench_now() - start);
+
+	free(nodes);
+	cdll_destroy_list(ll);
+}
+
+/**
+ * Runner
+ */
+
+int main(int argc, char** argv) {
+	size_t max_n = bench_max_n(argc, argv);
+
+	BENCH_HEADER();
+
+	for (size_t n = BENCH_MIN_N; n <= max_n; n *= 10) {
+		// linear per removal; larger sizes take minutes
+		if (n <= CSLL_MAX_N) bench_csll_churn(n);
+		bench_cdll_churn(n);
+	}
+
+	return EXIT_SUCCESS;
+}
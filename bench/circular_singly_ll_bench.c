@@ -0,0 +1,73 @@
+#include "bench_util.h"
+
+#include "libcartilage.h"
+
+/**
+ * Helpers
+ */
+
+void free_node(void* n) {
+	free(n);
+}
+
+void destroy(CircularSinglyLinkedList* ll) {
+	csll_iterate(ll, free_node);
+	free(ll);
+}
+
+/**
+ * Benchmarks
+ */
+
+void bench_push_back(size_t n) {
+	CircularSinglyLinkedList* ll = csll_make_list();
+
+	uint64_t start = bench_now();
+	for (size_t i = 0; i < n; i++) csll_push_back(ll, (void*)i);
+	bench_report("csll_push_back", n, n, bench_now() - start);
+
+	destroy(ll);
+}
+
+void bench_push_front(size_t n) {
+	CircularSinglyLinkedList* ll = csll_make_list();
+
+	uint64_t start = bench_now();
+	for (size_t i = 0; i < n; i++) csll_push_front(ll, (void*)i);
+	bench_report("csll_push_front", n, n, bench_now() - start);
+
+	destroy(ll);
+}
+
+void bench_pop_front(size_t n) {
+	CircularSinglyLinkedList* ll = csll_make_list();
+	ForwardNode_t** nodes = malloc(n * sizeof(ForwardNode_t*));
+
+	for (size_t i = 0; i < n; i++) csll_push_back(ll, (void*)i);
+
+	uint64_t start = bench_now();
+	for (size_t i = 0; i < n; i++) nodes[i] = csll_pop_front(ll);
+	bench_report("csll_pop_front", n, n, bench_now() - start);
+
+	for (size_t i = 0; i < n; i++) free(nodes[i]);
+	free(nodes);
+	destroy(ll);
+}
+
+/**
+ * Runner
+ */
+
+int main(int argc, char** argv) {
+	size_t max_n = bench_max_n(argc, argv);
+
+	BENCH_HEADER();
+
+	for (size_t n = BENCH_MIN_N; n <= max_n; n *= 10) {
+		bench_push_back(n);
+		bench_push_front(n);
+		bench_pop_front(n);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,96 @@
+#include "bench_util.h"
+
+#include "libcartilage.h"
+
+#define ITERATE_PASSES 8
+
+/**
+ * Environment
+ */
+
+static uintptr_t checksum;
+
+/**
+ * Helpers
+ */
+
+void accumulate(void* node) {
+	checksum += (uintptr_t)((ForwardNode_t*)node)->data;
+}
+
+/* Relink the ring in a random order, as long-running insert/remove/move churn eventually does */
+void scatter(CircularSinglyLinkedList* ll) {
+	ForwardNode_t** nodes = malloc(ll->size * sizeof(ForwardNode_t*));
+	ForwardNode_t* n = ll->head;
+
+	for (uint32_t i = 0; i < ll->size; i++, n = n->next) nodes[i] = n;
+
+	for (uint32_t i = ll->size - 1; i > 0; i--) {
+		uint32_t j = random() % (i + 1);
+		ForwardNode_t* tmp = nodes[i];
+
+		nodes[i] = nodes[j];
+		nodes[j] = tmp;
+	}
+
+	for (uint32_t i = 0; i < ll->size - 1; i++) nodes[i]->next = nodes[i + 1];
+
+	nodes[ll->size - 1]->next = nodes[0];
+	ll->head = nodes[0];
+	ll->tail = nodes[ll->size - 1];
+
+	free(nodes);
+}
+
+void bench_iterate(const char* name, CircularSinglyLinkedList* ll) {
+	fprintf(stderr, "# %s n=%u fragmentation=%.3f\n", name, ll->size, csll_fragmentation(ll));
+
+	uint64_t start = bench_now();
+
+	for (int p = 0; p < ITERATE_PASSES; p++) csll_iterate(ll, accumulate);
+
+	bench_report(name, ll->size, (size_t)ll->size * ITERATE_PASSES, bench_now() - start);
+}
+
+/**
+ * Benchmarks
+ */
+
+void bench_compact(size_t n) {
+	CircularSinglyLinkedList* ll = csll_make_list();
+
+	for (size_t i = 0; i < n; i++) csll_push_back(ll, (void*)i);
+
+	scatter(ll);
+	bench_iterate("csll iterate (scattered)", ll);
+
+	uint64_t start = bench_now();
+
+	csll_fragmentation(ll);
+
+	bench_report("csll_fragmentation", n, n, bench_now() - start);
+
+	start = bench_now();
+
+	csll_compact(ll, NULL, NULL);
+
+	bench_report("csll_compact", n, n, bench_now() - start);
+
+	bench_iterate("csll iterate (compacted)", ll);
+
+	csll_destroy_list(ll);
+}
+
+/**
+ * Runner
+ */
+
+int main(int argc, char** argv) {
+	size_t max_n = bench_max_n(argc, argv);
+
+	BENCH_HEADER();
+
+	for (size_t n = BENCH_MIN_N; n <= max_n; n *= 10) bench_compact(n);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,137 @@
+#include "bench_util.h"
+
+#include "libcartilage.h"
+
+#define TRAVERSAL_N 1000000
+#define WARM_PASSES 8
+/* Larger than any last-level cache we expect to run on */
+#define EVICT_BYTES (64 * 1024 * 1024)
+
+/**
+ * Environment
+ */
+
+static uintptr_t checksum;
+static char* evict_buffer;
+
+/**
+ * Helpers
+ */
+
+void accumulate(void* node) {
+	checksum += (uintptr_t)((ForwardNode_t*)node)->data;
+}
+
+int accumulate_ctx(ForwardNode_t* node, void* ctx) {
+	*(uintptr_t*)ctx += (uintptr_t)node->data;
+
+	return 0;
+}
+
+/* Relink the ring in a random order, such that traversal order has nothing to do with address order */
+void scatter(CircularSinglyLinkedList* ll) {
+	ForwardNode_t** nodes = malloc(ll->size * sizeof(ForwardNode_t*));
+	ForwardNode_t* n = ll->head;
+
+	for (uint32_t i = 0; i < ll->size; i++, n = n->next) nodes[i] = n;
+
+	for (uint32_t i = ll->size - 1; i > 0; i--) {
+		uint32_t j = random() % (i + 1);
+		ForwardNode_t* tmp = nodes[i];
+
+		nodes[i] = nodes[j];
+		nodes[j] = tmp;
+	}
+
+	for (uint32_t i = 0; i < ll->size - 1; i++) nodes[i]->next = nodes[i + 1];
+
+	nodes[ll->size - 1]->next = nodes[0];
+	ll->head = nodes[0];
+	ll->tail = nodes[ll->size - 1];
+
+	free(nodes);
+}
+
+void evict_caches(void) {
+	for (size_t i = 0; i < EVICT_BYTES; i += CACHE_LINE_SIZE) evict_buffer[i]++;
+}
+
+/**
+ * Traversals
+ */
+
+void traverse_iterate(CircularSinglyLinkedList* ll) {
+	csll_iterate(ll, accumulate);
+}
+
+void traverse_cursor_no_prefetch(CircularSinglyLinkedList* ll) {
+	csll_cursor_t c = csll_cursor_make(ll, 0);
+	ForwardNode_t* n;
+
+	while ((n = csll_cursor_next(&c))) checksum += (uintptr_t)n->data;
+}
+
+void traverse_foreach(CircularSinglyLinkedList* ll) {
+	ForwardNode_t* n;
+
+	CSLL_FOREACH(ll, n) checksum += (uintptr_t)n->data;
+}
+
+void traverse_iterate_ctx(CircularSinglyLinkedList* ll) {
+	csll_iterate_ctx(ll, accumulate_ctx, &checksum);
+}
+
+/**
+ * Benchmarks
+ */
+
+void bench_traversal(const char* name, CircularSinglyLinkedList* ll, void (*traverse)(CircularSinglyLinkedList*)) {
+	char label[128];
+
+	evict_caches();
+
+	uint64_t start = bench_now();
+
+	traverse(ll);
+
+	snprintf(label, sizeof(label), "%s (cold)", name);
+	bench_report(label, ll->size, ll->size, bench_now() - start);
+
+	start = bench_now();
+
+	for (int p = 0; p < WARM_PASSES; p++) traverse(ll);
+
+	snprintf(label, sizeof(label), "%s (warm)", name);
+	bench_report(label, ll->size, (size_t)ll->size * WARM_PASSES, bench_now() - start);
+}
+
+/**
+ * Runner
+ */
+
+int main(int argc, char** argv) {
+	size_t max_n = bench_max_n(argc, argv);
+
+	BENCH_HEADER();
+
+	evict_buffer = calloc(EVICT_BYTES, 1);
+
+	for (size_t n = BENCH_MIN_N; n <= max_n && n <= TRAVERSAL_N; n *= 10) {
+		CircularSinglyLinkedList* ll = csll_make_list();
+
+		for (size_t i = 0; i < n; i++) csll_push_back(ll, (void*)i);
+
+		scatter(ll);
+
+		bench_traversal("csll_iterate", ll, traverse_iterate);
+		bench_traversal("csll_cursor distance=0", ll, traverse_cursor_no_prefetch);
+		bench_traversal("CSLL_FOREACH", ll, traverse_foreach);
+		bench_traversal("csll_iterate_ctx", ll, traverse_iterate_ctx);
+
+		csll_destroy_list(ll);
+	}
+
+	free(evict_buffer);
+
+	return EXIT_SUCCESS;
+}
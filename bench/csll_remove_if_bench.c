@@ -0,0 +1,106 @@
+#include "bench_util.h"
+
+#include "libcartilage.h"
+
+/* Purging via csll_remove_node is quadratic; beyond this it dominates the suite's runtime */
+#define REMOVE_NODE_MAX_N 10000
+
+/**
+ * Environment
+ */
+
+/* Every other session has expired */
+int is_expired(ForwardNode_t* node, void* ctx) {
+	(void)ctx;
+
+	return (uintptr_t)node->data % 2;
+}
+
+int is_live(ForwardNode_t* node, void* ctx) {
+	return !is_expired(node, ctx);
+}
+
+/**
+ * Helpers
+ */
+
+CircularSinglyLinkedList* make_sessions(size_t n) {
+	CircularSinglyLinkedList* ll = csll_make_list();
+
+	for (size_t i = 0; i < n; i++) csll_push_back(ll, (void*)i);
+
+	return ll;
+}
+
+/**
+ * Benchmarks
+ */
+
+void bench_remove_node(size_t n) {
+	CircularSinglyLinkedList* ll = make_sessions(n);
+	ForwardNode_t* node = ll->head;
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < n; i++) {
+		ForwardNode_t* next = node->next;
+
+		if (is_expired(node, NULL)) csll_release_node(ll, csll_remove_node(ll, node));
+
+		node = next;
+	}
+
+	bench_report("purge via csll_remove_node", n, n, bench_now() - start);
+
+	csll_destroy_list(ll);
+}
+
+void bench_remove_if(size_t n) {
+	CircularSinglyLinkedList* ll = make_sessions(n);
+
+	uint64_t start = bench_now();
+
+	ForwardNode_t* removed = csll_remove_if(ll, is_expired, NULL);
+
+	while (removed) {
+		ForwardNode_t* next = removed->next;
+
+		csll_release_node(ll, removed);
+		removed = next;
+	}
+
+	bench_report("purge via csll_remove_if", n, n, bench_now() - start);
+
+	csll_destroy_list(ll);
+}
+
+void bench_retain(size_t n) {
+	CircularSinglyLinkedList* ll = make_sessions(n);
+
+	uint64_t start = bench_now();
+
+	csll_retain(ll, is_live, NULL, NULL);
+
+	bench_report("purge via csll_retain", n, n, bench_now() - start);
+
+	csll_destroy_list(ll);
+}
+
+/**
+ * Runner
+ */
+
+int main(int argc, char** argv) {
+	size_t max_n = bench_max_n(argc, argv);
+
+	BENCH_HEADER();
+
+	for (size_t n = BENCH_MIN_N; n <= max_n; n *= 10) {
+		if (n <= REMOVE_NODE_MAX_N) bench_remove_node(n);
+
+		bench_remove_if(n);
+		bench_retain(n);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,107 @@
+#include "bench_util.h"
+
+#include "libcartilage.h"
+
+#define TICKS 100000
+/* Emulated rotation walks the ring per tick; fewer ticks keep it from dominating the suite's runtime */
+#define EMULATED_TICKS 1000
+
+/**
+ * Environment
+ */
+
+static uintptr_t checksum;
+
+/**
+ * Helpers
+ */
+
+CircularSinglyLinkedList* make_backends(size_t n) {
+	CircularSinglyLinkedList* ll = csll_make_list();
+
+	for (size_t i = 0; i < n; i++) csll_push_back(ll, (void*)i);
+
+	return ll;
+}
+
+/**
+ * Benchmarks
+ */
+
+/* Rotation as emulated before csll_rotate: move the tail to the front */
+void bench_pop_push_front(size_t n) {
+	CircularSinglyLinkedList* ll = make_backends(n);
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < EMULATED_TICKS; i++) {
+		ForwardNode_t* node = csll_pop(ll);
+
+		checksum += (uintptr_t)node->data;
+		csll_push_front(ll, node->data);
+		csll_release_node(ll, node);
+	}
+
+	bench_report("tick via csll_pop+csll_push_front", n, EMULATED_TICKS, bench_now() - start);
+
+	csll_destroy_list(ll);
+}
+
+void bench_rotate(size_t n) {
+	CircularSinglyLinkedList* ll = make_backends(n);
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < TICKS; i++) checksum += (uintptr_t)csll_rotate(ll, 1)->data;
+
+	bench_report("tick via csll_rotate", n, TICKS, bench_now() - start);
+
+	csll_destroy_list(ll);
+}
+
+void bench_rr_cursor(size_t n) {
+	CircularSinglyLinkedList* ll = make_backends(n);
+	csll_rr_cursor_t c;
+
+	csll_rr_init(&c, ll);
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < TICKS; i++) checksum += (uintptr_t)csll_rr_next(&c)->data;
+
+	bench_report("tick via csll_rr_next", n, TICKS, bench_now() - start);
+
+	// retire every tenth backend as it comes up, and replace it
+	start = bench_now();
+
+	for (size_t i = 0; i < TICKS; i++) {
+		void* backend = csll_rr_next(&c)->data;
+
+		if (i % 10) continue;
+
+		csll_release_node(ll, csll_rr_remove(&c));
+		csll_push_back(ll, backend);
+	}
+
+	bench_report("tick via csll_rr_next+csll_rr_remove", n, TICKS, bench_now() - start);
+
+	csll_destroy_list(ll);
+}
+
+/**
+ * Runner
+ */
+
+int main(int argc, char** argv) {
+	size_t max_n = bench_max_n(argc, argv);
+
+	BENCH_HEADER();
+
+	for (size_t n = BENCH_MIN_N; n <= max_n; n *= 10) {
+		bench_pop_push_front(n);
+		bench_rotate(n);
+		bench_rr_cursor(n);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,181 @@
+#include "bench_util.h"
+
+#include "csll_typed.h"
+#include "libcartilage.h"
+
+#define ITERATE_PASSES 8
+
+/**
+ * Environment
+ */
+
+typedef struct record {
+	uint64_t key, a, b, c;
+} record_t; /* 32 bytes */
+
+CSLL_DEFINE(int_list, int)
+CSLL_DEFINE(record_list, record_t)
+
+static uint64_t checksum;
+
+/**
+ * Helpers
+ */
+
+void accumulate_int(int* value) {
+	checksum += *value;
+}
+
+void accumulate_record(record_t* value) {
+	checksum += value->key + value->c;
+}
+
+void accumulate_boxed_int(void* node) {
+	checksum += *(int*)((ForwardNode_t*)node)->data;
+}
+
+void accumulate_boxed_record(void* node) {
+	record_t* r = ((ForwardNode_t*)node)->data;
+
+	checksum += r->key + r->c;
+}
+
+/**
+ * Benchmarks
+ */
+
+void bench_typed_int(size_t n) {
+	int_list_t* ll = int_list_make_list();
+	int out;
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < n; i++) int_list_push_back(ll, (int)i);
+
+	bench_report("typed int push_back", n, n, bench_now() - start);
+
+	start = bench_now();
+
+	for (int p = 0; p < ITERATE_PASSES; p++) int_list_iterate(ll, accumulate_int);
+
+	bench_report("typed int iterate", n, n * ITERATE_PASSES, bench_now() - start);
+
+	start = bench_now();
+
+	while (int_list_pop_front(ll, &out) == 0) checksum += out;
+
+	bench_report("typed int pop_front", n, n, bench_now() - start);
+
+	int_list_destroy_list(ll);
+}
+
+/* The boxed list owns a heap copy of each value, as it must for values that are not pointer-sized */
+void bench_boxed_int(size_t n) {
+	CircularSinglyLinkedList* ll = csll_make_list();
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < n; i++) {
+		int* v = malloc(sizeof(int));
+
+		*v = (int)i;
+		csll_push_back(ll, v);
+	}
+
+	bench_report("boxed int push_back", n, n, bench_now() - start);
+
+	start = bench_now();
+
+	for (int p = 0; p < ITERATE_PASSES; p++) csll_iterate(ll, accumulate_boxed_int);
+
+	bench_report("boxed int iterate", n, n * ITERATE_PASSES, bench_now() - start);
+
+	start = bench_now();
+
+	for (ForwardNode_t* node; (node = csll_pop_front(ll));) {
+		checksum += *(int*)node->data;
+		free(node->data);
+		csll_release_node(ll, node);
+	}
+
+	bench_report("boxed int pop_front", n, n, bench_now() - start);
+
+	csll_destroy_list(ll);
+}
+
+void bench_typed_record(size_t n) {
+	record_list_t* ll = record_list_make_list();
+	record_t out;
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < n; i++) record_list_push_back(ll, (record_t){i, i, i, i});
+
+	bench_report("typed record push_back", n, n, bench_now() - start);
+
+	start = bench_now();
+
+	for (int p = 0; p < ITERATE_PASSES; p++) record_list_iterate(ll, accumulate_record);
+
+	bench_report("typed record iterate", n, n * ITERATE_PASSES, bench_now() - start);
+
+	start = bench_now();
+
+	while (record_list_pop_front(ll, &out) == 0) checksum += out.key;
+
+	bench_report("typed record pop_front", n, n, bench_now() - start);
+
+	record_list_destroy_list(ll);
+}
+
+void bench_boxed_record(size_t n) {
+	CircularSinglyLinkedList* ll = csll_make_list();
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < n; i++) {
+		record_t* r = malloc(sizeof(record_t));
+
+		*r = (record_t){i, i, i, i};
+		csll_push_back(ll, r);
+	}
+
+	bench_report("boxed record push_back", n, n, bench_now() - start);
+
+	start = bench_now();
+
+	for (int p = 0; p < ITERATE_PASSES; p++) csll_iterate(ll, accumulate_boxed_record);
+
+	bench_report("boxed record iterate", n, n * ITERATE_PASSES, bench_now() - start);
+
+	start = bench_now();
+
+	for (ForwardNode_t* node; (node = csll_pop_front(ll));) {
+		checksum += ((record_t*)node->data)->key;
+		free(node->data);
+		csll_release_node(ll, node);
+	}
+
+	bench_report("boxed record pop_front", n, n, bench_now() - start);
+
+	csll_destroy_list(ll);
+}
+
+/**
+ * Runner
+ */
+
+int main(int argc, char** argv) {
+	size_t max_n = bench_max_n(argc, argv);
+
+	BENCH_HEADER();
+
+	for (size_t n = BENCH_MIN_N; n <= max_n; n *= 10) {
+		bench_typed_int(n);
+		bench_boxed_int(n);
+		bench_typed_record(n);
+		bench_boxed_record(n);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,150 @@
+#include "bench_util.h"
+
+#include "libcartilage.h"
+
+#define DRR_MIN_N 100
+#define DRR_MAX_N 100000
+#define PICKS 1000000
+#define BATCH 32
+/* Replace the picked member once per this many picks */
+#define CHURN_PERIOD 16
+/* Smooth weighted round-robin scans every member per pick; fewer picks keep it from dominating the suite's runtime */
+#define SWRR_PICKS 10000
+
+/**
+ * Environment
+ */
+
+typedef struct backend {
+	int weight;
+	int current;
+} backend_t;
+
+static uintptr_t checksum;
+
+/**
+ * Helpers
+ */
+
+uint32_t weight_of(size_t i) {
+	return i % 4 + 1;
+}
+
+drr_scheduler_t* make_scheduler(size_t n) {
+	drr_scheduler_t* s = drr_make();
+
+	for (size_t i = 0; i < n; i++) drr_add(s, (void*)i, weight_of(i));
+
+	return s;
+}
+
+/* Smooth weighted round-robin, as application code would build it over the list: each pick scans every member */
+backend_t* swrr_pick(CircularSinglyLinkedList* ll, int total) {
+	ForwardNode_t* n = ll->head;
+	backend_t* best = NULL;
+
+	for (uint32_t i = 0; i < ll->size; i++, n = n->next) {
+		backend_t* b = n->data;
+
+		b->current += b->weight;
+		if (!best || b->current > best->current) best = b;
+	}
+
+	best->current -= total;
+
+	return best;
+}
+
+/**
+ * Benchmarks
+ */
+
+void bench_pick(size_t n) {
+	drr_scheduler_t* s = make_scheduler(n);
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < PICKS; i++) checksum += (uintptr_t)drr_pick(s)->data;
+
+	bench_report("drr_pick", n, PICKS, bench_now() - start);
+
+	drr_destroy(s);
+}
+
+void bench_pick_batch(size_t n) {
+	drr_scheduler_t* s = make_scheduler(n);
+	drr_member_t* out[BATCH];
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < PICKS; i += BATCH) {
+		drr_pick_batch(s, out, BATCH);
+		checksum += (uintptr_t)out[BATCH - 1]->data;
+	}
+
+	bench_report("drr_pick_batch", n, PICKS, bench_now() - start);
+
+	drr_destroy(s);
+}
+
+void bench_churn(size_t n) {
+	drr_scheduler_t* s = make_scheduler(n);
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < PICKS; i++) {
+		drr_member_t* m = drr_pick(s);
+
+		if (i % CHURN_PERIOD) continue;
+
+		// the picked queue drained; a new one takes its place
+		void* data = m->data;
+
+		drr_remove(s, m);
+		drr_add(s, data, weight_of(i));
+	}
+
+	bench_report("drr_pick+remove+add", n, PICKS, bench_now() - start);
+
+	drr_destroy(s);
+}
+
+void bench_swrr(size_t n) {
+	CircularSinglyLinkedList* ll = csll_make_list();
+	backend_t* backends = calloc(n, sizeof(backend_t));
+	int total = 0;
+
+	for (size_t i = 0; i < n; i++) {
+		backends[i].weight = weight_of(i);
+		total += backends[i].weight;
+		csll_push_back(ll, &backends[i]);
+	}
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < SWRR_PICKS; i++) checksum += (uintptr_t)swrr_pick(ll, total);
+
+	bench_report("smooth wrr pick via csll", n, SWRR_PICKS, bench_now() - start);
+
+	csll_destroy_list(ll);
+	free(backends);
+}
+
+/**
+ * Runner
+ */
+
+int main(int argc, char** argv) {
+	size_t max_n = bench_max_n(argc, argv);
+
+	BENCH_HEADER();
+
+	for (size_t n = DRR_MIN_N; n <= max_n && n <= DRR_MAX_N; n *= 10) {
+		bench_swrr(n);
+		bench_pick(n);
+		bench_pick_batch(n);
+		bench_churn(n);
+	}
+
+	return EXIT_SUCCESS;
+}
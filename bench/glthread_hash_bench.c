@@ -0,0 +1,141 @@
+#include "bench_util.h"
+
+#include "libcartilage.h"
+
+#include <stddef.h>
+
+/* Finding by linear walk is quadratic over the whole key set; beyond this it dominates the suite's runtime */
+#define LINEAR_FIND_MAX_N 10000
+
+/**
+ * Environment
+ */
+
+typedef struct user {
+	long id;
+	glthread_t hash_link;
+	glthread_t list_link;
+} user_t;
+
+uint64_t hash_id(const void* key) {
+	return *(const long*)key;
+}
+
+int eq_id(const void* a, const void* b) {
+	return *(const long*)a == *(const long*)b;
+}
+
+/**
+ * Helpers
+ */
+
+user_t* make_users(size_t n) {
+	user_t* users = malloc(n * sizeof(user_t));
+
+	for (size_t i = 0; i < n; i++) {
+		users[i].id = (long)i * 2654435761L;
+		glthread_init(&users[i].hash_link);
+		glthread_init(&users[i].list_link);
+	}
+
+	return users;
+}
+
+user_t* linear_find(glthread_t* head, long id) {
+	glthread_t* curr;
+
+	ITERATE_GLTHREAD_BEGIN(head, curr) {
+		user_t* u = GET_DATA_FROM_OFFSET(curr, offsetof(user_t, list_link));
+
+		if (u->id == id) return u;
+	} ITERATE_GLTHREAD_END(head, curr);
+
+	return NULL;
+}
+
+/**
+ * Benchmarks
+ */
+
+void bench_linear(size_t n) {
+	user_t* users = make_users(n);
+	glthread_t head;
+	size_t found = 0;
+
+	glthread_init(&head);
+
+	for (size_t i = 0; i < n; i++) glthread_insert_after(&head, &users[i].list_link);
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < n; i++) found += linear_find(&head, users[random() % n].id) != NULL;
+
+	bench_report("glthread linear find", n, found, bench_now() - start);
+
+	free(users);
+}
+
+void bench_hash(size_t n) {
+	user_t* users = make_users(n);
+	glthread_hash_t h;
+	size_t found = 0;
+
+	glthread_hash_init(&h, 0, hash_id, eq_id, offsetof(user_t, hash_link), offsetof(user_t, id));
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < n; i++) glthread_hash_insert(&h, &users[i].hash_link);
+
+	bench_report("glthread_hash_insert (from empty)", n, n, bench_now() - start);
+
+	start = bench_now();
+
+	for (size_t i = 0; i < n; i++) found += glthread_hash_find(&h, &users[random() % n].id) != NULL;
+
+	bench_report("glthread_hash_find", n, found, bench_now() - start);
+
+	start = bench_now();
+
+	for (size_t i = 0; i < n; i++) glthread_hash_remove(&h, &users[i].id);
+
+	bench_report("glthread_hash_remove", n, n, bench_now() - start);
+
+	glthread_hash_destroy(&h);
+	glthread_hash_init(&h, 0, hash_id, eq_id, offsetof(user_t, hash_link), offsetof(user_t, id));
+
+	// the longest single insert while growing from empty, which a stop-the-world rehash would make O(n)
+	uint64_t worst = 0;
+
+	for (size_t i = 0; i < n; i++) {
+		uint64_t t = bench_now();
+
+		glthread_hash_insert(&h, &users[i].hash_link);
+
+		t = bench_now() - t;
+
+		if (t > worst) worst = t;
+	}
+
+	fprintf(stderr, "# glthread_hash_insert n=%zu worst_ns=%lu\n", n, (unsigned long)worst);
+
+	glthread_hash_destroy(&h);
+	free(users);
+}
+
+/**
+ * Runner
+ */
+
+int main(int argc, char** argv) {
+	size_t max_n = bench_max_n(argc, argv);
+
+	BENCH_HEADER();
+
+	for (size_t n = BENCH_MIN_N; n <= max_n; n *= 10) {
+		if (n <= LINEAR_FIND_MAX_N) bench_linear(n);
+
+		bench_hash(n);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,90 @@
+#include "bench_util.h"
+
+#include "libcartilage.h"
+
+#include <stddef.h>
+
+#define PRIORITY_INSERT_MAX_N 10000
+
+/**
+ * Environment
+ */
+
+typedef struct bench_data {
+	int key;
+	glthread_t glthread;
+	glthread_heap_node_t node;
+} bench_t;
+
+int comparator(void* a, void* b) {
+	int ka = ((bench_t*)a)->key;
+	int kb = ((bench_t*)b)->key;
+
+	if (ka == kb) return 0;
+	return ka < kb ? -1 : 1;
+}
+
+bench_t* make_data(size_t n) {
+	bench_t* data = malloc(n * sizeof(bench_t));
+
+	for (size_t i = 0; i < n; i++) data[i].key = random();
+
+	return data;
+}
+
+/**
+ * Benchmarks
+ */
+
+void bench_priority_insert(size_t n) {
+	bench_t* data = make_data(n);
+	glthread_t head;
+
+	glthread_init(&head);
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < n; i++) {
+		glthread_priority_insert(&head, &data[i].glthread, comparator, offsetof(bench_t, glthread));
+	}
+
+	for (size_t i = 0; i < n; i++) glthread_dequeue_first(&head);
+
+	bench_report("glthread_priority_insert+dequeue", n, 2 * n, bench_now() - start);
+
+	free(data);
+}
+
+void bench_heap(size_t n) {
+	bench_t* data = make_data(n);
+	glthread_heap_t heap;
+
+	glthread_heap_init(&heap, comparator, offsetof(bench_t, node));
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < n; i++) glthread_heap_insert(&heap, &data[i].node);
+	for (size_t i = 0; i < n; i++) glthread_heap_extract(&heap);
+
+	bench_report("glthread_heap_insert+extract", n, 2 * n, bench_now() - start);
+
+	free(data);
+}
+
+/**
+ * Runner
+ */
+
+int main(int argc, char** argv) {
+	size_t max_n = bench_max_n(argc, argv);
+
+	BENCH_HEADER();
+
+	for (size_t n = BENCH_MIN_N; n <= max_n; n *= 10) {
+		// quadratic; larger sizes take minutes
+		if (n <= PRIORITY_INSERT_MAX_N) bench_priority_insert(n);
+		bench_heap(n);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,152 @@
+#include "bench_util.h"
+
+#include "glthread_typed.h"
+#include "libcartilage.h"
+
+/* Priority insert is quadratic; these bracket the sizes at which a sorted glthread is still a sensible structure */
+#define TYPED_MIN_N 1000
+#define TYPED_MAX_N 100000
+#define FIND_OPS 1000
+
+/**
+ * Environment
+ */
+
+typedef struct item {
+	long key;
+	glthread_t glthread;
+} item_t;
+
+GLTHREAD_DEFINE(item, item_t, glthread, a->key < b->key)
+
+int comparator(void* a, void* b) {
+	long ka = ((item_t*)a)->key;
+	long kb = ((item_t*)b)->key;
+
+	if (ka == kb) return 0;
+	return ka < kb ? -1 : 1;
+}
+
+/* Not static, such that the compiler cannot fold the calls made through it */
+int (*find_comparator)(void*, void*) = comparator;
+
+/* The function pointer version's search, as a caller would write it today */
+item_t* find_by_comparator(glthread_t* head, item_t* key, int offset) {
+	glthread_t* curr;
+
+	ITERATE_GLTHREAD_BEGIN(head, curr) {
+		item_t* it = GET_DATA_FROM_OFFSET(curr, offset);
+		int cmp = find_comparator(key, it);
+
+		if (cmp == -1) return NULL;
+		if (cmp == 0) return it;
+	} ITERATE_GLTHREAD_END(head, curr);
+
+	return NULL;
+}
+
+static uintptr_t checksum;
+
+/**
+ * Helpers
+ */
+
+item_t* make_items(size_t n) {
+	item_t* items = malloc(n * sizeof(item_t));
+
+	for (size_t i = 0; i < n; i++) {
+		items[i].key = random();
+		glthread_init(&items[i].glthread);
+	}
+
+	return items;
+}
+
+/**
+ * Benchmarks
+ */
+
+void bench_comparator(size_t n) {
+	item_t* items = make_items(2 * n);
+	glthread_t head;
+	glthread_list_t other;
+
+	glthread_init(&head);
+	glthread_list_init(&other);
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < n; i++) {
+		glthread_priority_insert(&head, &items[i].glthread, comparator, offsetof(item_t, glthread));
+	}
+
+	bench_report("glthread_priority_insert", n, n, bench_now() - start);
+
+	start = bench_now();
+
+	for (size_t i = 0; i < FIND_OPS; i++) checksum += (uintptr_t)find_by_comparator(&head, &items[random() % n], offsetof(item_t, glthread));
+
+	bench_report("glthread find via comparator", n, FIND_OPS, bench_now() - start);
+
+	for (size_t i = n; i < 2 * n; i++) glthread_list_push(&other, &items[i].glthread);
+
+	glthread_list_sort(&other, comparator, offsetof(item_t, glthread));
+
+	start = bench_now();
+
+	glthread_merge(&head, &other.head, comparator, offsetof(item_t, glthread));
+
+	bench_report("glthread_merge", n, 2 * n, bench_now() - start);
+
+	free(items);
+}
+
+void bench_typed(size_t n) {
+	item_t* items = make_items(2 * n);
+	glthread_t head;
+	glthread_list_t other;
+
+	glthread_init(&head);
+	glthread_list_init(&other);
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < n; i++) item_priority_insert(&head, &items[i]);
+
+	bench_report("GLTHREAD_DEFINE priority_insert", n, n, bench_now() - start);
+
+	start = bench_now();
+
+	for (size_t i = 0; i < FIND_OPS; i++) checksum += (uintptr_t)item_find(&head, &items[random() % n]);
+
+	bench_report("GLTHREAD_DEFINE find", n, FIND_OPS, bench_now() - start);
+
+	for (size_t i = n; i < 2 * n; i++) glthread_list_push(&other, &items[i].glthread);
+
+	glthread_list_sort(&other, comparator, offsetof(item_t, glthread));
+
+	start = bench_now();
+
+	item_merge(&head, &other.head);
+
+	bench_report("GLTHREAD_DEFINE merge", n, 2 * n, bench_now() - start);
+
+	free(items);
+}
+
+/**
+ * Runner
+ */
+
+int main(int argc, char** argv) {
+	size_t max_n = bench_max_n(argc, argv);
+
+	BENCH_HEADER();
+
+	for (size_t n = TYPED_MIN_N; n <= max_n && n <= TYPED_MAX_N; n *= 10) {
+		bench_comparator(n);
+		bench_typed(n);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,116 @@
+#include "bench_util.h"
+
+#include "libcartilage.h"
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#define ITERATE_PASSES 8
+#define CHURN_OPS 100000
+
+/**
+ * Environment
+ */
+
+static uintptr_t checksum;
+
+/**
+ * Helpers
+ */
+
+void accumulate(void* value) {
+	checksum += (uintptr_t)value;
+}
+
+void accumulate_node(void* node) {
+	checksum += (uintptr_t)((ForwardNode_t*)node)->data;
+}
+
+/* Bytes currently allocated from the heap, including mmap'd blocks, or 0 where the C library does not expose it */
+size_t heap_in_use(void) {
+#ifdef __GLIBC__
+	struct mallinfo2 info = mallinfo2();
+
+	return info.uordblks + info.hblkhd;
+#else
+	return 0;
+#endif
+}
+
+void report_memory(const char* name, size_t n, size_t bytes) {
+	fprintf(stderr, "# %s n=%zu bytes/elem=%.2f\n", name, n, (double)bytes / (double)n);
+}
+
+/**
+ * Benchmarks
+ */
+
+void bench_csll(size_t n) {
+	size_t before = heap_in_use();
+	CircularSinglyLinkedList* ll = csll_make_list();
+
+	for (size_t i = 0; i < n; i++) csll_push_back(ll, (void*)i);
+
+	report_memory("csll", n, heap_in_use() - before);
+
+	uint64_t start = bench_now();
+
+	for (int p = 0; p < ITERATE_PASSES; p++) csll_iterate(ll, accumulate_node);
+
+	bench_report("csll iterate", n, n * ITERATE_PASSES, bench_now() - start);
+
+	start = bench_now();
+
+	for (size_t i = 0; i < CHURN_OPS; i++) {
+		csll_release_node(ll, csll_pop_front(ll));
+		csll_push_back(ll, (void*)i);
+	}
+
+	bench_report("csll pop_front+push_back", n, CHURN_OPS, bench_now() - start);
+
+	csll_destroy_list(ll);
+}
+
+void bench_ilist(size_t n) {
+	size_t before = heap_in_use();
+	IndexList_t* ll = ilist_make_list(n); // presized, such that the figure excludes growth slack
+
+	for (size_t i = 0; i < n; i++) ilist_push_back(ll, (void*)i);
+
+	report_memory("ilist", n, heap_in_use() - before);
+
+	uint64_t start = bench_now();
+
+	for (int p = 0; p < ITERATE_PASSES; p++) ilist_iterate(ll, accumulate);
+
+	bench_report("ilist iterate", n, n * ITERATE_PASSES, bench_now() - start);
+
+	start = bench_now();
+
+	for (size_t i = 0; i < CHURN_OPS; i++) {
+		ilist_pop_front(ll);
+		ilist_push_back(ll, (void*)i);
+	}
+
+	bench_report("ilist pop_front+push_back", n, CHURN_OPS, bench_now() - start);
+
+	ilist_destroy_list(ll);
+}
+
+/**
+ * Runner
+ */
+
+int main(int argc, char** argv) {
+	size_t max_n = bench_max_n(argc, argv);
+
+	BENCH_HEADER();
+
+	for (size_t n = BENCH_MIN_N; n <= max_n; n *= 10) {
+		bench_csll(n);
+		bench_ilist(n);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,113 @@
+#include "bench_util.h"
+
+#include "libcartilage.h"
+
+#define ITERATE_PASSES 8
+
+/**
+ * Environment
+ */
+
+typedef struct item {
+	size_t key;
+	icsll_node_t link;
+} item_t;
+
+static size_t checksum;
+
+/**
+ * Helpers
+ */
+
+void visit_boxed(void* node) {
+	checksum += ((item_t*)((ForwardNode_t*)node)->data)->key;
+}
+
+void visit_intrusive(void* data) {
+	checksum += ((item_t*)data)->key;
+}
+
+item_t* make_items(size_t n) {
+	item_t* items = malloc(n * sizeof(item_t));
+
+	for (size_t i = 0; i < n; i++) {
+		items[i].key = i;
+		icsll_node_init(&items[i].link);
+	}
+
+	return items;
+}
+
+/**
+ * Benchmarks
+ */
+
+void bench_boxed(size_t n) {
+	item_t* items = make_items(n);
+	CircularSinglyLinkedList* ll = csll_make_list();
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < n; i++) csll_push_back(ll, &items[i]);
+
+	bench_report("csll push_back", n, n, bench_now() - start);
+
+	start = bench_now();
+
+	for (int p = 0; p < ITERATE_PASSES; p++) csll_iterate(ll, visit_boxed);
+
+	bench_report("csll iterate", n, n * ITERATE_PASSES, bench_now() - start);
+
+	start = bench_now();
+
+	for (size_t i = 0; i < n; i++) csll_release_node(ll, csll_pop_front(ll));
+
+	bench_report("csll pop_front", n, n, bench_now() - start);
+
+	csll_destroy_list(ll);
+	free(items);
+}
+
+void bench_intrusive(size_t n) {
+	item_t* items = make_items(n);
+	icsll_t ll;
+
+	icsll_init(&ll, offsetof(item_t, link));
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < n; i++) icsll_push_back(&ll, &items[i].link);
+
+	bench_report("icsll push_back", n, n, bench_now() - start);
+
+	start = bench_now();
+
+	for (int p = 0; p < ITERATE_PASSES; p++) icsll_iterate(&ll, visit_intrusive);
+
+	bench_report("icsll iterate", n, n * ITERATE_PASSES, bench_now() - start);
+
+	start = bench_now();
+
+	for (size_t i = 0; i < n; i++) icsll_pop_front(&ll);
+
+	bench_report("icsll pop_front", n, n, bench_now() - start);
+
+	free(items);
+}
+
+/**
+ * Runner
+ */
+
+int main(int argc, char** argv) {
+	size_t max_n = bench_max_n(argc, argv);
+
+	BENCH_HEADER();
+
+	for (size_t n = BENCH_MIN_N; n <= max_n; n *= 10) {
+		bench_boxed(n);
+		bench_intrusive(n);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,102 @@
+#include "bench_util.h"
+
+#include "libcartilage.h"
+
+#include <pthread.h>
+
+#define MAX_THREADS 32
+#define TOTAL_PAIRS 1000000
+#define CAPACITY 1024
+
+/**
+ * Environment
+ */
+
+typedef struct locked_list {
+	pthread_mutex_t lock;
+	CircularSinglyLinkedList* ll;
+} locked_list_t;
+
+typedef struct worker_arg {
+	void* q;
+	size_t n;
+} worker_arg_t;
+
+void* work_mpmc(void* arg) {
+	worker_arg_t* w = arg;
+
+	for (size_t i = 0; i < w->n; i++) {
+		size_t v = i;
+
+		mpmc_ring_push(w->q, &v);
+		mpmc_ring_pop(w->q, &v);
+	}
+
+	return NULL;
+}
+
+void* work_locked(void* arg) {
+	worker_arg_t* w = arg;
+	locked_list_t* q = w->q;
+
+	for (size_t i = 0; i < w->n; i++) {
+		pthread_mutex_lock(&q->lock);
+		csll_push_back(q->ll, (void*)i);
+		pthread_mutex_unlock(&q->lock);
+
+		pthread_mutex_lock(&q->lock);
+		ForwardNode_t* n = csll_pop_front(q->ll);
+		pthread_mutex_unlock(&q->lock);
+
+		free(n);
+	}
+
+	return NULL;
+}
+
+/**
+ * Helpers
+ */
+
+void run_workers(const char* name, void* q, void* (*work)(void*), int threads) {
+	pthread_t tids[MAX_THREADS];
+	worker_arg_t args[MAX_THREADS];
+	size_t per_thread = TOTAL_PAIRS / threads;
+
+	uint64_t start = bench_now();
+
+	for (int i = 0; i < threads; i++) {
+		args[i].q = q;
+		args[i].n = per_thread;
+		pthread_create(&tids[i], NULL, work, &args[i]);
+	}
+
+	for (int i = 0; i < threads; i++) pthread_join(tids[i], NULL);
+
+	bench_report(name, threads, 2 * per_thread * threads, bench_now() - start);
+}
+
+/**
+ * Runner
+ */
+
+int main(void) {
+	BENCH_HEADER();
+
+	for (int threads = 1; threads <= MAX_THREADS; threads *= 2) {
+		mpmc_ring_t* r = mpmc_ring_make(CAPACITY, sizeof(size_t));
+		locked_list_t q;
+
+		pthread_mutex_init(&q.lock, NULL);
+		q.ll = csll_make_list();
+
+		run_workers("mpmc_ring push+pop (threads=n)", r, work_mpmc, threads);
+		run_workers("mutex+csll push+pop (threads=n)", &q, work_locked, threads);
+
+		mpmc_ring_destroy(r);
+		csll_destroy_list(q.ll);
+		pthread_mutex_destroy(&q.lock);
+	}
+
+	return EXIT_SUCCESS;
+}
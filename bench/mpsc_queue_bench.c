@@ -0,0 +1,137 @@
+#include "bench_util.h"
+
+#include "libcartilage.h"
+
+#include <pthread.h>
+#include <stddef.h>
+
+#define MAX_PRODUCERS 16
+#define TOTAL_ITEMS 1000000
+#define BATCH_SIZE 64
+
+/**
+ * Environment
+ */
+
+typedef struct bench_data {
+	mpsc_node_t node;
+	glthread_t glthread;
+} bench_t;
+
+typedef struct locked_list {
+	pthread_mutex_t lock;
+	glthread_list_t list;
+} locked_list_t;
+
+typedef struct producer_arg {
+	void* q;
+	bench_t* items;
+	size_t n;
+} producer_arg_t;
+
+void* produce_mpsc(void* arg) {
+	producer_arg_t* p = arg;
+
+	for (size_t i = 0; i < p->n; i++) mpsc_queue_push(p->q, &p->items[i].node);
+
+	return NULL;
+}
+
+void* produce_locked(void* arg) {
+	producer_arg_t* p = arg;
+	locked_list_t* q = p->q;
+
+	for (size_t i = 0; i < p->n; i++) {
+		pthread_mutex_lock(&q->lock);
+		glthread_list_push(&q->list, &p->items[i].glthread);
+		pthread_mutex_unlock(&q->lock);
+	}
+
+	return NULL;
+}
+
+/**
+ * Helpers
+ */
+
+uint64_t run_producers(void* q, void* (*produce)(void*), bench_t* items, int producers, pthread_t* threads, producer_arg_t* args) {
+	size_t per_producer = TOTAL_ITEMS / producers;
+
+	for (int i = 0; i < producers; i++) {
+		args[i].q = q;
+		args[i].items = items + i * per_producer;
+		args[i].n = per_producer;
+		pthread_create(&threads[i], NULL, produce, &args[i]);
+	}
+
+	return per_producer * producers;
+}
+
+/**
+ * Benchmarks
+ */
+
+void bench_mpsc(bench_t* items, int producers) {
+	mpsc_queue_t* q = aligned_alloc(CACHE_LINE_SIZE, sizeof(mpsc_queue_t));
+	pthread_t threads[MAX_PRODUCERS];
+	producer_arg_t args[MAX_PRODUCERS];
+	mpsc_node_t* batch[BATCH_SIZE];
+
+	mpsc_queue_init(q);
+
+	uint64_t start = bench_now();
+	uint64_t total = run_producers(q, produce_mpsc, items, producers, threads, args);
+
+	for (uint64_t consumed = 0; consumed < total;) {
+		consumed += mpsc_queue_pop_batch(q, batch, BATCH_SIZE);
+	}
+
+	for (int i = 0; i < producers; i++) pthread_join(threads[i], NULL);
+
+	bench_report("mpsc_queue (producers=n)", producers, total, bench_now() - start);
+
+	free(q);
+}
+
+void bench_locked(bench_t* items, int producers) {
+	locked_list_t q;
+	pthread_t threads[MAX_PRODUCERS];
+	producer_arg_t args[MAX_PRODUCERS];
+
+	pthread_mutex_init(&q.lock, NULL);
+	glthread_list_init(&q.list);
+
+	uint64_t start = bench_now();
+	uint64_t total = run_producers(&q, produce_locked, items, producers, threads, args);
+
+	for (uint64_t consumed = 0; consumed < total;) {
+		pthread_mutex_lock(&q.lock);
+		while (glthread_list_dequeue_first(&q.list)) consumed++;
+		pthread_mutex_unlock(&q.lock);
+	}
+
+	for (int i = 0; i < producers; i++) pthread_join(threads[i], NULL);
+
+	bench_report("mutex+glthread_list (producers=n)", producers, total, bench_now() - start);
+
+	pthread_mutex_destroy(&q.lock);
+}
+
+/**
+ * Runner
+ */
+
+int main(void) {
+	bench_t* items = malloc(TOTAL_ITEMS * sizeof(bench_t));
+
+	BENCH_HEADER();
+
+	for (int producers = 1; producers <= MAX_PRODUCERS; producers *= 2) {
+		bench_mpsc(items, producers);
+		bench_locked(items, producers);
+	}
+
+	free(items);
+
+	return EXIT_SUCCESS;
+}
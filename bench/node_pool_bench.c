@@ -0,0 +1,70 @@
+#include "bench_util.h"
+
+#include "libcartilage.h"
+
+#define POOL_CHUNK_SIZE 4096
+#define CHURN_ROUNDS 10
+
+/**
+ * Helpers
+ */
+
+CircularSinglyLinkedList* make_list(int pooled) {
+	if (!pooled) return csll_make_list();
+
+	return csll_make_list_owning_allocator(&node_pool_make(sizeof(ForwardNode_t), POOL_CHUNK_SIZE)->allocator);
+}
+
+/**
+ * Benchmarks
+ */
+
+void bench_push_pop(size_t n, int pooled) {
+	CircularSinglyLinkedList* ll = make_list(pooled);
+
+	uint64_t start = bench_now();
+
+	for (int r = 0; r < CHURN_ROUNDS; r++) {
+		for (size_t i = 0; i < n; i++) csll_push_back(ll, (void*)i);
+		for (size_t i = 0; i < n; i++) csll_release_node(ll, csll_pop_front(ll));
+	}
+
+	bench_report(pooled ? "push_back+pop_front (pool)" : "push_back+pop_front (malloc)", n, 2 * n * CHURN_ROUNDS, bench_now() - start);
+
+	csll_destroy_list(ll);
+}
+
+void bench_push_back_list(size_t n, int pooled) {
+	CircularSinglyLinkedList* src = csll_make_list();
+
+	for (size_t i = 0; i < n; i++) csll_push_back(src, (void*)i);
+
+	uint64_t start = bench_now();
+
+	CircularSinglyLinkedList* ll = make_list(pooled);
+	csll_push_back_list(ll, src);
+	csll_destroy_list(ll);
+
+	bench_report(pooled ? "csll_push_back_list+destroy (pool)" : "csll_push_back_list+destroy (malloc)", n, n, bench_now() - start);
+
+	csll_destroy_list(src);
+}
+
+/**
+ * Runner
+ */
+
+int main(int argc, char** argv) {
+	size_t max_n = bench_max_n(argc, argv);
+
+	BENCH_HEADER();
+
+	for (size_t n = BENCH_MIN_N; n <= max_n; n *= 10) {
+		bench_push_pop(n, 0);
+		bench_push_pop(n, 1);
+		bench_push_back_list(n, 0);
+		bench_push_back_list(n, 1);
+	}
+
+	return EXIT_SUCCESS;
+}
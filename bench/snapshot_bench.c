@@ -0,0 +1,118 @@
+#include "bench_util.h"
+
+#include "libcartilage.h"
+#include <string.h>
+
+#define SNAPSHOT_PATH "/tmp/cartilage_snapshot_bench.bin"
+
+/**
+ * Environment
+ */
+
+typedef struct record {
+	long key;
+	long value;
+} record_t;
+
+static long checksum;
+
+/**
+ * Helpers
+ */
+
+void accumulate(void* data) {
+	checksum += ((record_t*)data)->key;
+}
+
+/* Conventional reload: read every record and allocate a node and a copy for it */
+CircularSinglyLinkedList* rebuild(const char* path) {
+	CircularSinglyLinkedList* ll = csll_make_list();
+	SnapshotHeader_t header;
+	FILE* fp = fopen(path, "rb");
+	size_t stride = 0;
+
+	if (fread(&header, sizeof(header), 1, fp) == 1) stride = SNAPSHOT_STRIDE(header.record_size);
+
+	unsigned char* buffer = malloc(stride ? stride : 1);
+
+	for (uint64_t i = 0; stride && i < header.count && fread(buffer, stride, 1, fp) == 1; i++) {
+		record_t* rec = malloc(sizeof(record_t));
+
+		memcpy(rec, ((SnapshotRecord_t*)buffer)->data, sizeof(record_t));
+		csll_push_back(ll, rec);
+	}
+
+	free(buffer);
+	fclose(fp);
+
+	return ll;
+}
+
+void free_records(CircularSinglyLinkedList* ll) {
+	ForwardNode_t* n = ll->head;
+
+	for (uint32_t i = 0; i < ll->size; i++, n = n->next) free(n->data);
+}
+
+/**
+ * Benchmarks
+ */
+
+void bench_snapshot(size_t n) {
+	record_t* records = malloc(n * sizeof(record_t));
+	CircularSinglyLinkedList* ll = csll_make_list();
+
+	for (size_t i = 0; i < n; i++) {
+		records[i].key = i;
+		records[i].value = random();
+		csll_push_back(ll, &records[i]);
+	}
+
+	uint64_t start = bench_now();
+
+	csll_snapshot_save(ll, SNAPSHOT_PATH, sizeof(record_t));
+
+	bench_report("csll_snapshot_save", n, n, bench_now() - start);
+
+	csll_destroy_list(ll);
+	free(records);
+
+	start = bench_now();
+
+	Snapshot_t* s = snapshot_map(SNAPSHOT_PATH);
+
+	bench_report("snapshot_map (load)", n, 1, bench_now() - start);
+
+	start = bench_now();
+
+	snapshot_iterate(s, accumulate);
+
+	bench_report("snapshot_iterate (first pass)", n, n, bench_now() - start);
+
+	snapshot_unmap(s);
+
+	start = bench_now();
+
+	ll = rebuild(SNAPSHOT_PATH);
+
+	bench_report("fread+csll rebuild (load)", n, 1, bench_now() - start);
+
+	free_records(ll);
+	csll_destroy_list(ll);
+
+	remove(SNAPSHOT_PATH);
+}
+
+/**
+ * Runner
+ */
+
+int main(int argc, char** argv) {
+	size_t max_n = bench_max_n(argc, argv);
+
+	BENCH_HEADER();
+
+	for (size_t n = BENCH_MIN_N; n <= max_n; n *= 10) bench_snapshot(n);
+
+	return EXIT_SUCCESS;
+}
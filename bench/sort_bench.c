@@ -0,0 +1,137 @@
+#include "bench_util.h"
+
+#include "libcartilage.h"
+
+#define SORT_MIN_N 10000
+/* Building by priority insert is quadratic; beyond this it dominates the suite's runtime */
+#define PRIORITY_INSERT_MAX_N 10000
+
+/**
+ * Environment
+ */
+
+typedef struct item {
+	long key;
+	glthread_t glthread;
+} item_t;
+
+int comparator(void* a, void* b) {
+	long ka = ((item_t*)a)->key;
+	long kb = ((item_t*)b)->key;
+
+	if (ka == kb) return 0;
+	return ka < kb ? -1 : 1;
+}
+
+int compare_values(void* a, void* b) {
+	if (a == b) return 0;
+	return (uintptr_t)a < (uintptr_t)b ? -1 : 1;
+}
+
+/**
+ * Helpers
+ */
+
+item_t* make_items(size_t n) {
+	item_t* items = malloc(n * sizeof(item_t));
+
+	for (size_t i = 0; i < n; i++) {
+		items[i].key = random();
+		glthread_init(&items[i].glthread);
+	}
+
+	return items;
+}
+
+/**
+ * Benchmarks
+ */
+
+void bench_priority_insert_build(size_t n) {
+	item_t* items = make_items(n);
+	glthread_t head;
+
+	glthread_init(&head);
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < n; i++) {
+		glthread_priority_insert(&head, &items[i].glthread, comparator, offsetof(item_t, glthread));
+	}
+
+	bench_report("glthread build via priority_insert", n, n, bench_now() - start);
+
+	free(items);
+}
+
+void bench_sort_build(size_t n) {
+	item_t* items = make_items(n);
+	glthread_list_t list;
+
+	glthread_list_init(&list);
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < n; i++) glthread_list_push(&list, &items[i].glthread);
+
+	glthread_list_sort(&list, comparator, offsetof(item_t, glthread));
+
+	bench_report("glthread build via push+sort", n, n, bench_now() - start);
+
+	free(items);
+}
+
+void bench_merge(size_t n) {
+	item_t* items = make_items(n);
+	glthread_list_t a, b;
+
+	glthread_list_init(&a);
+	glthread_list_init(&b);
+
+	for (size_t i = 0; i < n; i++) glthread_list_push(i % 2 ? &a : &b, &items[i].glthread);
+
+	glthread_list_sort(&a, comparator, offsetof(item_t, glthread));
+	glthread_list_sort(&b, comparator, offsetof(item_t, glthread));
+
+	uint64_t start = bench_now();
+
+	glthread_list_merge(&a, &b, comparator, offsetof(item_t, glthread));
+
+	bench_report("glthread_list_merge", n, n, bench_now() - start);
+
+	free(items);
+}
+
+void bench_csll_sort(size_t n) {
+	CircularSinglyLinkedList* ll = csll_make_list();
+
+	for (size_t i = 0; i < n; i++) csll_push_back(ll, (void*)(uintptr_t)random());
+
+	uint64_t start = bench_now();
+
+	csll_sort(ll, compare_values);
+
+	bench_report("csll_sort", n, n, bench_now() - start);
+
+	csll_destroy_list(ll);
+}
+
+/**
+ * Runner
+ */
+
+int main(int argc, char** argv) {
+	size_t max_n = bench_max_n(argc, argv);
+
+	BENCH_HEADER();
+
+	for (size_t n = SORT_MIN_N; n <= max_n; n *= 10) {
+		if (n <= PRIORITY_INSERT_MAX_N) bench_priority_insert_build(n);
+
+		bench_sort_build(n);
+		bench_merge(n);
+		bench_csll_sort(n);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,146 @@
+#include "bench_util.h"
+
+#include "libcartilage.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+#define ITEMS 1000000
+#define CAPACITY 4096
+#define BATCH_SIZE 32
+
+/**
+ * Environment
+ */
+
+typedef struct locked_list {
+	pthread_mutex_t lock;
+	CircularSinglyLinkedList* ll;
+} locked_list_t;
+
+void* produce_single(void* arg) {
+	spsc_ring_t* r = arg;
+
+	for (uint64_t i = 0; i < ITEMS;) {
+		if (spsc_ring_push(r, &i) == 0) i++;
+		else sched_yield();
+	}
+
+	return NULL;
+}
+
+void* produce_reserve(void* arg) {
+	spsc_ring_t* r = arg;
+
+	for (uint64_t i = 0; i < ITEMS;) {
+		uint64_t* slots;
+		size_t n = spsc_ring_reserve(r, ITEMS - i < BATCH_SIZE ? ITEMS - i : BATCH_SIZE, (void**)&slots);
+
+		if (!n) {
+			sched_yield();
+			continue;
+		}
+
+		for (size_t j = 0; j < n; j++) slots[j] = i++;
+
+		spsc_ring_commit(r, n);
+	}
+
+	return NULL;
+}
+
+void* produce_locked(void* arg) {
+	locked_list_t* q = arg;
+
+	for (uint64_t i = 0; i < ITEMS; i++) {
+		pthread_mutex_lock(&q->lock);
+		csll_push_back(q->ll, (void*)i);
+		pthread_mutex_unlock(&q->lock);
+	}
+
+	return NULL;
+}
+
+/**
+ * Benchmarks
+ */
+
+void bench_spsc(const char* name, void* (*produce)(void*), int batched) {
+	spsc_ring_t* r = spsc_ring_make(CAPACITY, sizeof(uint64_t));
+	pthread_t producer;
+	uint64_t batch[BATCH_SIZE];
+	volatile uint64_t sink = 0;
+
+	uint64_t start = bench_now();
+
+	pthread_create(&producer, NULL, produce, r);
+
+	for (uint64_t consumed = 0; consumed < ITEMS;) {
+		size_t n = batched
+			? spsc_ring_pop_batch(r, batch, BATCH_SIZE)
+			: spsc_ring_pop(r, batch) == 0;
+
+		if (!n) {
+			sched_yield();
+			continue;
+		}
+
+		sink += batch[n - 1];
+		consumed += n;
+	}
+
+	pthread_join(producer, NULL);
+
+	bench_report(name, ITEMS, ITEMS, bench_now() - start);
+
+	spsc_ring_destroy(r);
+}
+
+void bench_locked(void) {
+	locked_list_t q;
+	pthread_t producer;
+	volatile uint64_t sink = 0;
+
+	pthread_mutex_init(&q.lock, NULL);
+	q.ll = csll_make_list();
+
+	uint64_t start = bench_now();
+
+	pthread_create(&producer, NULL, produce_locked, &q);
+
+	for (uint64_t consumed = 0; consumed < ITEMS;) {
+		pthread_mutex_lock(&q.lock);
+		ForwardNode_t* n = csll_pop_front(q.ll);
+		pthread_mutex_unlock(&q.lock);
+
+		if (!n) {
+			sched_yield();
+			continue;
+		}
+
+		sink += (uint64_t)n->data;
+		csll_release_node(q.ll, n);
+		consumed++;
+	}
+
+	pthread_join(producer, NULL);
+
+	bench_report("mutex+csll push_back/pop_front", ITEMS, ITEMS, bench_now() - start);
+
+	csll_destroy_list(q.ll);
+	pthread_mutex_destroy(&q.lock);
+}
+
+/**
+ * Runner
+ */
+
+int main(void) {
+	BENCH_HEADER();
+
+	bench_spsc("spsc_ring push/pop", produce_single, 0);
+	bench_spsc("spsc_ring reserve+commit/pop_batch", produce_reserve, 1);
+	bench_locked();
+
+	return EXIT_SUCCESS;
+}
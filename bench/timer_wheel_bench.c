@@ -0,0 +1,140 @@
+#include "bench_util.h"
+
+#include "libcartilage.h"
+
+#include <stddef.h>
+
+/* Arming by priority insert is quadratic; beyond this it dominates the suite's runtime */
+#define PRIORITY_INSERT_MAX_N 10000
+/* Timeouts are spread over this many ticks, e.g. a minute of 1ms ticks */
+#define TIMEOUT_TICKS 60000
+
+/**
+ * Environment
+ */
+
+typedef struct conn {
+	uint64_t expires;
+	int cancelled;
+	glthread_t glthread;
+	wheel_timer_t timer;
+} conn_t;
+
+static size_t fired;
+
+int comparator(void* a, void* b) {
+	uint64_t ea = ((conn_t*)a)->expires;
+	uint64_t eb = ((conn_t*)b)->expires;
+
+	if (ea == eb) return 0;
+	return ea < eb ? -1 : 1;
+}
+
+/**
+ * Helpers
+ */
+
+conn_t* make_conns(size_t n) {
+	conn_t* conns = malloc(n * sizeof(conn_t));
+
+	for (size_t i = 0; i < n; i++) {
+		conns[i].expires = 1 + random() % TIMEOUT_TICKS;
+		conns[i].cancelled = random() % 2;
+		glthread_init(&conns[i].glthread);
+		wheel_timer_init(&conns[i].timer);
+	}
+
+	return conns;
+}
+
+void on_expiry(wheel_timer_t* t, void* ctx) {
+	(void)t;
+	(void)ctx;
+
+	fired++;
+}
+
+/**
+ * Benchmarks
+ */
+
+void bench_timer_wheel(size_t n) {
+	conn_t* conns = make_conns(n);
+	timer_wheel_t* w = malloc(sizeof(timer_wheel_t));
+
+	timer_wheel_init(w, 0);
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < n; i++) timer_wheel_arm(w, &conns[i].timer, conns[i].expires);
+
+	bench_report("timer_wheel_arm", n, n, bench_now() - start);
+
+	start = bench_now();
+
+	for (size_t i = 0; i < n; i++) {
+		if (conns[i].cancelled) timer_wheel_cancel(w, &conns[i].timer);
+	}
+
+	bench_report("timer_wheel_cancel (half)", n, n / 2, bench_now() - start);
+
+	fired = 0;
+	start = bench_now();
+
+	timer_wheel_advance(w, TIMEOUT_TICKS, on_expiry, NULL);
+
+	bench_report("timer_wheel_advance (fire rest)", n, fired, bench_now() - start);
+
+	free(w);
+	free(conns);
+}
+
+void bench_priority_insert(size_t n) {
+	conn_t* conns = make_conns(n);
+	glthread_t head;
+
+	glthread_init(&head);
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < n; i++) {
+		glthread_priority_insert(&head, &conns[i].glthread, comparator, offsetof(conn_t, glthread));
+	}
+
+	bench_report("glthread_priority_insert (arm)", n, n, bench_now() - start);
+
+	start = bench_now();
+
+	for (size_t i = 0; i < n; i++) {
+		if (conns[i].cancelled) glthread_remove(&conns[i].glthread);
+	}
+
+	bench_report("glthread_remove (cancel half)", n, n / 2, bench_now() - start);
+
+	fired = 0;
+	start = bench_now();
+
+	while (glthread_dequeue_first(&head)) fired++;
+
+	bench_report("glthread_dequeue_first (fire rest)", n, fired, bench_now() - start);
+
+	free(conns);
+}
+
+/**
+ * Runner
+ */
+
+int main(int argc, char** argv) {
+	size_t max_n = bench_max_n(argc, argv);
+
+	BENCH_HEADER();
+
+	for (size_t n = BENCH_MIN_N; n <= max_n; n *= 10) {
+		if (n <= PRIORITY_INSERT_MAX_N) bench_priority_insert(n);
+
+		bench_timer_wheel(n);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,119 @@
+#include "bench_util.h"
+
+#include "libcartilage.h"
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#define ITERATE_PASSES 8
+
+/**
+ * Environment
+ */
+
+static uintptr_t checksum;
+
+/**
+ * Helpers
+ */
+
+void accumulate(void* value) {
+	checksum += (uintptr_t)value;
+}
+
+/* Bytes currently allocated from the heap, or 0 where the C library does not expose it */
+size_t heap_in_use(void) {
+#ifdef __GLIBC__
+	return mallinfo2().uordblks;
+#else
+	return 0;
+#endif
+}
+
+void report_memory(const char* name, size_t n, size_t bytes) {
+	fprintf(stderr, "# %s n=%zu bytes/elem=%.2f\n", name, n, (double)bytes / (double)n);
+}
+
+/**
+ * Benchmarks
+ */
+
+void bench_csll_iterate(size_t n) {
+	size_t before = heap_in_use();
+	CircularSinglyLinkedList* ll = csll_make_list();
+
+	for (size_t i = 0; i < n; i++) csll_push_back(ll, (void*)i);
+
+	report_memory("csll", n, heap_in_use() - before);
+
+	uint64_t start = bench_now();
+
+	for (int p = 0; p < ITERATE_PASSES; p++) csll_iterate(ll, accumulate);
+
+	bench_report("csll iterate", n, n * ITERATE_PASSES, bench_now() - start);
+
+	csll_destroy_list(ll);
+}
+
+void bench_ucsll_iterate(size_t n) {
+	size_t before = heap_in_use();
+	UnrolledCircularSinglyLinkedList* ll = ucsll_make_list();
+
+	for (size_t i = 0; i < n; i++) ucsll_push_back(ll, (void*)i);
+
+	report_memory("ucsll", n, heap_in_use() - before);
+
+	uint64_t start = bench_now();
+
+	for (int p = 0; p < ITERATE_PASSES; p++) ucsll_iterate(ll, accumulate);
+
+	bench_report("ucsll iterate", n, n * ITERATE_PASSES, bench_now() - start);
+
+	ucsll_destroy_list(ll);
+}
+
+void bench_csll_push_pop(size_t n) {
+	CircularSinglyLinkedList* ll = csll_make_list();
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < n; i++) csll_push_back(ll, (void*)i);
+	for (size_t i = 0; i < n; i++) csll_release_node(ll, csll_pop_front(ll));
+
+	bench_report("csll push_back+pop_front", n, n * 2, bench_now() - start);
+
+	csll_destroy_list(ll);
+}
+
+void bench_ucsll_push_pop(size_t n) {
+	UnrolledCircularSinglyLinkedList* ll = ucsll_make_list();
+
+	uint64_t start = bench_now();
+
+	for (size_t i = 0; i < n; i++) ucsll_push_back(ll, (void*)i);
+	for (size_t i = 0; i < n; i++) ucsll_pop_front(ll);
+
+	bench_report("ucsll push_back+pop_front", n, n * 2, bench_now() - start);
+
+	ucsll_destroy_list(ll);
+}
+
+/**
+ * Runner
+ */
+
+int main(int argc, char** argv) {
+	size_t max_n = bench_max_n(argc, argv);
+
+	BENCH_HEADER();
+
+	for (size_t n = BENCH_MIN_N; n <= max_n; n *= 10) {
+		bench_csll_iterate(n);
+		bench_ucsll_iterate(n);
+		bench_csll_push_pop(n);
+		bench_ucsll_push_pop(n);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,182 @@
+#include "bench_util.h"
+
+#include "libcartilage.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+#define MAX_THREADS 16
+/* A binary task tree of this depth has 2^depth leaves */
+#define TREE_DEPTH 16
+#define LEAF_WORK 128
+
+/**
+ * Environment
+ */
+
+/* Tasks are encoded as their depth in the tree plus one, such that no task is NULL */
+#define TASK(depth) ((void*)(uintptr_t)((depth) + 1))
+#define TASK_DEPTH(task) ((int)((uintptr_t)(task) - 1))
+
+typedef struct scheduler {
+	int threads;
+	ws_deque_t* deques[MAX_THREADS];
+	pthread_mutex_t lock;
+	CircularSinglyLinkedList* queue; /* Shared queue of the locked scheduler */
+	_Atomic(size_t) remaining; /* Leaves yet to run */
+} scheduler_t;
+
+typedef struct worker {
+	scheduler_t* s;
+	int id;
+	uint64_t rng;
+	uint64_t sink;
+} worker_t;
+
+/**
+ * Helpers
+ */
+
+uint64_t xorshift(uint64_t* state) {
+	*state ^= *state << 13;
+	*state ^= *state >> 7;
+	*state ^= *state << 17;
+
+	return *state;
+}
+
+/* Fork: split the task down to a leaf, spawning the right half at each level; leaves do a fixed amount of work */
+void execute(worker_t* w, void* task, void (*spawn)(worker_t*, void*)) {
+	int depth = TASK_DEPTH(task);
+
+	for (; depth < TREE_DEPTH; depth++) spawn(w, TASK(depth + 1));
+
+	for (int i = 0; i < LEAF_WORK; i++) w->sink += xorshift(&w->rng);
+
+	atomic_fetch_sub_explicit(&w->s->remaining, 1, memory_order_release);
+}
+
+/**
+ * Work-stealing scheduler
+ */
+
+void spawn_local(worker_t* w, void* task) {
+	ws_deque_push(w->s->deques[w->id], task);
+}
+
+void* ws_worker(void* arg) {
+	worker_t* w = arg;
+	scheduler_t* s = w->s;
+
+	// join: run until every leaf of the tree has run
+	while (atomic_load_explicit(&s->remaining, memory_order_acquire)) {
+		void* task = ws_deque_pop(s->deques[w->id]);
+
+		if (!task && s->threads > 1) {
+			int victim = xorshift(&w->rng) % s->threads;
+
+			if (victim != w->id) task = ws_deque_steal(s->deques[victim]);
+		}
+
+		if (task) {
+			execute(w, task, spawn_local);
+		} else {
+			sched_yield();
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Locked scheduler
+ */
+
+void spawn_shared(worker_t* w, void* task) {
+	pthread_mutex_lock(&w->s->lock);
+	csll_push_front(w->s->queue, task);
+	pthread_mutex_unlock(&w->s->lock);
+}
+
+void* locked_worker(void* arg) {
+	worker_t* w = arg;
+	scheduler_t* s = w->s;
+
+	while (atomic_load_explicit(&s->remaining, memory_order_acquire)) {
+		void* task = NULL;
+
+		pthread_mutex_lock(&s->lock);
+
+		ForwardNode_t* n = csll_pop_front(s->queue);
+
+		if (n) {
+			task = n->data;
+			csll_release_node(s->queue, n);
+		}
+
+		pthread_mutex_unlock(&s->lock);
+
+		if (task) {
+			execute(w, task, spawn_shared);
+		} else {
+			sched_yield();
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Benchmarks
+ */
+
+void run_scheduler(const char* name, int threads, void* (*work)(void*)) {
+	scheduler_t s = { .threads = threads };
+	pthread_t tids[MAX_THREADS];
+	worker_t workers[MAX_THREADS];
+	size_t leaves = (size_t)1 << TREE_DEPTH;
+
+	for (int i = 0; i < threads; i++) s.deques[i] = ws_deque_make(TREE_DEPTH);
+
+	pthread_mutex_init(&s.lock, NULL);
+	s.queue = csll_make_list();
+	atomic_init(&s.remaining, leaves);
+
+	// the root task; threads are started after, which orders the push before any pop or steal
+	if (work == ws_worker) {
+		ws_deque_push(s.deques[0], TASK(0));
+	} else {
+		csll_push_front(s.queue, TASK(0));
+	}
+
+	uint64_t start = bench_now();
+
+	for (int i = 0; i < threads; i++) {
+		workers[i] = (worker_t){ .s = &s, .id = i, .rng = 0x9E3779B97F4A7C15 * (i + 1) };
+		pthread_create(&tids[i], NULL, work, &workers[i]);
+	}
+
+	for (int i = 0; i < threads; i++) pthread_join(tids[i], NULL);
+
+	bench_report(name, threads, leaves, bench_now() - start);
+
+	for (int i = 0; i < threads; i++) ws_deque_destroy(s.deques[i]);
+
+	csll_destroy_list(s.queue);
+	pthread_mutex_destroy(&s.lock);
+}
+
+/**
+ * Runner
+ */
+
+int main(void) {
+	BENCH_HEADER();
+
+	for (int threads = 1; threads <= MAX_THREADS; threads *= 2) {
+		run_scheduler("ws_deque fork-join (threads=n)", threads, ws_worker);
+		run_scheduler("mutex+csll fork-join (threads=n)", threads, locked_worker);
+	}
+
+	return EXIT_SUCCESS;
+}
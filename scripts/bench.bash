@@ -0,0 +1,53 @@
+#!/usr/bin/env bash
+IFS=$'\n'
+
+BENCH_DIR=bench
+UTIL_F=util.bash
+BENCH_OUT="${BENCH_OUT:-bench.csv}"
+
+run_bench () {
+	local file_name="$1"
+
+	gcc -O2 -pthread -std=c17 -D_DEFAULT_SOURCE -Isrc "$BENCH_DIR/$file_name" src/*.c -o bench_main
+	green "[+] Running $file_name...\n" >&2
+
+	# every binary prints its own CSV header; keep only the one written by main
+	./bench_main $BENCH_MAX_N | tail -n +2 | tee -a "$BENCH_OUT"
+}
+
+main () {
+	benches=(
+		'api_bench.c'
+		'circular_singly_ll_bench.c'
+		'csll_cursor_bench.c'
+		'csll_typed_bench.c'
+		'csll_compact_bench.c'
+		'csll_remove_if_bench.c'
+		'csll_rotate_bench.c'
+		'circular_doubly_ll_bench.c'
+		'unrolled_csll_bench.c'
+		'intrusive_csll_bench.c'
+		'index_list_bench.c'
+		'node_pool_bench.c'
+		'glthread_heap_bench.c'
+		'glthread_hash_bench.c'
+		'timer_wheel_bench.c'
+		'sort_bench.c'
+		'glthread_typed_bench.c'
+		'mpsc_queue_bench.c'
+		'spsc_ring_bench.c'
+		'mpmc_ring_bench.c'
+		'ws_deque_bench.c'
+		'drr_scheduler_bench.c'
+		'snapshot_bench.c'
+	)
+
+	echo 'case,n,ops,ns_per_op,ops_per_sec,p50_ns,p90_ns,p99_ns' | tee "$BENCH_OUT"
+
+	for_each run_bench ${benches[*]}
+
+	green "[+] Results written to $BENCH_OUT\n" >&2
+}
+
+. "$(dirname "$(readlink -f "$BASH_SOURCE")")"/$UTIL_F
+main $*
@@ -23,8 +23,8 @@ not_test_file () {
 run_test () {
 	local file_name="$1"
 
-	gcc -Isrc -c "$TESTING_DIR/$file_name" -o main.o
-	gcc -o main main.o -L./ -l cartilage
+	gcc -pthread -Isrc -c "$TESTING_DIR/$file_name" -o main.o
+	gcc -pthread -o main main.o -L./ -l cartilage
 
 	export LD_LIBRARY_PATH=$HOME/repositories/cartilage/src/:$LD_LIBRARY_PATH
 	green "\n[+] Running test...\n\n"
@@ -37,7 +37,24 @@ main () {
 
 	tests=(
 		'circular_singly_ll_test.c'
-		# 'glthread_test.c'
+		'csll_typed_test.c'
+		'circular_doubly_ll_test.c'
+		'unrolled_csll_test.c'
+		'intrusive_csll_test.c'
+		'index_list_test.c'
+		'offset_list_test.c'
+		'snapshot_test.c'
+		'node_pool_test.c'
+		'glthread_test.c'
+		'glthread_typed_test.c'
+		'glthread_heap_test.c'
+		'glthread_hash_test.c'
+		'timer_wheel_test.c'
+		'mpsc_queue_test.c'
+		'spsc_ring_test.c'
+		'mpmc_ring_test.c'
+		'ws_deque_test.c'
+		'drr_scheduler_test.c'
 	)
 
 	make unix
@@ -0,0 +1,460 @@
+/**
+ * @file circular_doubly_ll.c
+ * @author Matthew Zito (goldmund@freenode)
+ * @brief Implements a Circular Doubly Linked List
+ * @version 0.1
+ * @date 2021-07-11
+ *
+ * @copyright Copyright (c) 2021 Matthew Zito (goldmund)
+ *
+ */
+
+#include "libcartilage.h"
+
+#include <stdlib.h>
+
+/**
+ * @brief Bootstrap a new head node
+ * @private
+ *
+ * @param ll
+ * @param node
+ * @return BidirectionalNode_t*
+ */
+BidirectionalNode_t* __cdll_new_head(CircularDoublyLinkedList* ll, BidirectionalNode_t* node) {
+	ll->head = node;
+	node->next = node;
+	node->prev = node;
+
+	node->list = ll;
+	ll->size++;
+	return node;
+}
+
+/**
+ * @brief Link a detached node immediately after `at`
+ * @private
+ *
+ * @param node
+ * @param at
+ */
+void __cdll_link_after(BidirectionalNode_t* node, BidirectionalNode_t* at) {
+	node->prev = at;
+	node->next = at->next;
+	at->next->prev = node;
+	at->next = node;
+}
+
+/**
+ * @brief Unlink a node from its neighbors, advancing the head if need be
+ * @private
+ *
+ * @param ll
+ * @param node
+ */
+void __cdll_unlink(CircularDoublyLinkedList* ll, BidirectionalNode_t* node) {
+	if (node == ll->head) ll->head = node->next;
+
+	node->prev->next = node->next;
+	node->next->prev = node->prev;
+}
+
+/**
+ * @brief Generate a new node
+ * @private
+ *
+ * @param value
+ * @return BidirectionalNode_t*
+ */
+BidirectionalNode_t* __cdll_make_node(void* value) {
+	BidirectionalNode_t* n = malloc(sizeof(BidirectionalNode_t));
+
+	if (!n) return NULL;
+
+	n->data = value;
+	n->next = NULL;
+	n->prev = NULL;
+	n->list = NULL;
+
+	return n;
+}
+
+/**
+ * @brief Generate a new node using the list's allocator
+ * @private
+ *
+ * @param ll
+ * @param value
+ * @return BidirectionalNode_t* - NULL if the allocator is exhausted
+ */
+BidirectionalNode_t* __cdll_alloc_node(CircularDoublyLinkedList* ll, void* value) {
+	if (!ll->allocator) return __cdll_make_node(value);
+
+	BidirectionalNode_t* n = ll->allocator->alloc(ll->allocator->ctx, sizeof(BidirectionalNode_t));
+
+	if (!n) return NULL;
+
+	n->data = value;
+	n->next = NULL;
+	n->prev = NULL;
+	n->list = NULL;
+
+	return n;
+}
+
+/**
+ * @brief Instantiate an empty circular doubly linked list
+ *
+ * @return CircularDoublyLinkedList*
+ */
+CircularDoublyLinkedList* cdll_make_list(void) {
+	return cdll_make_list_with_allocator(NULL);
+}
+
+/**
+ * @brief Instantiate an empty circular doubly linked list whose nodes are obtained from `allocator`
+ *
+ * The list does not own the allocator, which may be shared with other lists; `cdll_destroy_list` frees each node
+ *
+ * @param allocator
+ * @return CircularDoublyLinkedList*
+ */
+CircularDoublyLinkedList* cdll_make_list_with_allocator(NodeAllocator_t* allocator) {
+	CircularDoublyLinkedList* ll = malloc(sizeof(CircularDoublyLinkedList));
+
+	if (!ll) return NULL;
+
+	ll->head = NULL;
+	ll->size = 0;
+	ll->allocator = allocator;
+	ll->owns_allocator = 0;
+
+	return ll;
+}
+
+/**
+ * @brief Instantiate an empty circular doubly linked list that owns `allocator`, from which its nodes are obtained
+ *
+ * If the allocator provides `release`, `cdll_destroy_list` releases it rather than freeing each node; it must not
+ * be shared with any other list
+ *
+ * @param allocator
+ * @return CircularDoublyLinkedList*
+ */
+CircularDoublyLinkedList* cdll_make_list_owning_allocator(NodeAllocator_t* allocator) {
+	CircularDoublyLinkedList* ll = cdll_make_list_with_allocator(allocator);
+
+	if (ll) ll->owns_allocator = allocator != NULL;
+
+	return ll;
+}
+
+/**
+ * @brief Return a node that was removed from the list to the list's allocator
+ *
+ * @param ll
+ * @param node
+ */
+void cdll_release_node(CircularDoublyLinkedList* ll, BidirectionalNode_t* node) {
+	if (!node) return;
+
+	if (ll->allocator) ll->allocator->free(ll->allocator->ctx, node);
+	else free(node);
+}
+
+/**
+ * @brief Free all nodes of the list and the list itself; node data is not freed
+ *
+ * @param ll
+ */
+void cdll_destroy_list(CircularDoublyLinkedList* ll) {
+	if (ll->owns_allocator && ll->allocator->release) {
+		ll->allocator->release(ll->allocator->ctx);
+	} else {
+		BidirectionalNode_t* n = ll->head;
+
+		for (uint32_t i = ll->size; i > 0; i--) {
+			BidirectionalNode_t* next = n->next;
+
+			cdll_release_node(ll, n);
+			n = next;
+		}
+	}
+
+	free(ll);
+}
+
+/**
+ * @brief Returns the previous list node, if extant; else, NULL
+ *
+ * @param ll
+ * @param node
+ * @return BidirectionalNode_t*
+ */
+BidirectionalNode_t* cdll_prev(CircularDoublyLinkedList* ll, BidirectionalNode_t* node) {
+	if (!node || !node->list || node->list != ll) return NULL;
+
+	return node->prev;
+}
+
+/**
+ * @brief Returns the next list node, if extant; else, NULL
+ *
+ * @param ll
+ * @param node
+ * @return BidirectionalNode_t*
+ */
+BidirectionalNode_t* cdll_next(CircularDoublyLinkedList* ll, BidirectionalNode_t* node) {
+	if (!node || !node->list || node->list != ll) return NULL;
+
+	return node->next;
+}
+
+/**
+ * @brief Push a new node with value `value` to the back of the list
+ *
+ * @param ll
+ * @param value
+ * @return BidirectionalNode_t* - the new node, or NULL if it could not be allocated
+ */
+BidirectionalNode_t* cdll_push_back(CircularDoublyLinkedList* ll, void* value) {
+	BidirectionalNode_t* node = __cdll_alloc_node(ll, value);
+
+	if (!node) return NULL;
+	if (!ll->head) return __cdll_new_head(ll, node);
+
+	__cdll_link_after(node, ll->head->prev);
+
+	node->list = ll;
+	ll->size++;
+
+	return node;
+}
+
+/**
+ * @brief Push a new node with value `value` to the front of the list
+ *
+ * @param ll
+ * @param value
+ * @return BidirectionalNode_t* - the new node, or NULL if it could not be allocated
+ */
+BidirectionalNode_t* cdll_push_front(CircularDoublyLinkedList* ll, void* value) {
+	BidirectionalNode_t* node = cdll_push_back(ll, value);
+
+	if (!node) return NULL;
+
+	// the back of a ring is immediately before its front
+	ll->head = node;
+
+	return node;
+}
+
+/**
+ * @brief Move a given node to its new position after `mark`
+ *
+ * If either the given node or mark are not an element of the list; node == mark; or mark.next == node, the list is not modified
+ *
+ * Both the node and mark must not be NULL
+ *
+ * @param ll
+ * @param node
+ * @param mark
+ * @return int - 0 if success, else -1
+ */
+int cdll_move_after(CircularDoublyLinkedList* ll, BidirectionalNode_t* node, BidirectionalNode_t* mark) {
+	if (!node || !mark) return -1;
+
+	if (node->list != ll || node == mark || mark->list != ll) {
+		return -1;
+	}
+
+	if (mark->next == node) return -1;
+
+	__cdll_unlink(ll, node);
+	__cdll_link_after(node, mark);
+	return 0;
+}
+
+/**
+ * @brief Move a given node to its new position before `mark`
+ *
+ * If either the given node or mark are not an element of the list; node == mark; or node.next == mark, the list is not modified
+ *
+ * Both the node and mark must not be NULL
+ *
+ * @param ll
+ * @param node
+ * @param mark
+ * @return int - 0 if success, else -1
+ */
+int cdll_move_before(CircularDoublyLinkedList* ll, BidirectionalNode_t* node, BidirectionalNode_t* mark) {
+	if (!node || !mark) return -1;
+
+	if (node->list != ll || node == mark || mark->list != ll) {
+		return -1;
+	}
+
+	if (node->next == mark) return -1;
+
+	__cdll_unlink(ll, node);
+	__cdll_link_after(node, mark->prev);
+	return 0;
+}
+
+/**
+ * @brief Remove a given node from the list
+ *
+ * @param ll
+ * @param node
+ * @return BidirectionalNode_t*
+ */
+BidirectionalNode_t* cdll_remove_node(CircularDoublyLinkedList* ll, BidirectionalNode_t* node) {
+	if (!ll->head || !node) return NULL;
+
+	if (node->list != ll) return NULL;
+
+	if (ll->size == 1) {
+		ll->head = NULL;
+	} else {
+		__cdll_unlink(ll, node);
+	}
+
+	node->next = NULL;
+	node->prev = NULL;
+	node->list = NULL;
+
+	ll->size--;
+
+	return node;
+}
+
+/**
+ * @brief Remove the last node from the list
+ *
+ * @param ll
+ * @return BidirectionalNode_t*
+ */
+BidirectionalNode_t* cdll_pop(CircularDoublyLinkedList* ll) {
+	if (!ll->head) return NULL;
+
+	return cdll_remove_node(ll, ll->head->prev);
+}
+
+/**
+ * @brief Remove the first node from the list
+ *
+ * @param ll
+ * @return BidirectionalNode_t*
+ */
+BidirectionalNode_t* cdll_pop_front(CircularDoublyLinkedList* ll) {
+	if (!ll->head) return NULL;
+
+	return cdll_remove_node(ll, ll->head);
+}
+
+/**
+ * @brief Insert a new node with value `value` immediately after `mark`
+ *
+ * If `mark` is not an element of the list, the list is not modified
+ *
+ * `mark` must not be NULL
+ *
+ * @param ll
+ * @param value
+ * @param mark
+ * @return BidirectionalNode_t*
+ */
+BidirectionalNode_t* cdll_insert_after(CircularDoublyLinkedList* ll, void* value, BidirectionalNode_t* mark) {
+	if (!mark || mark->list != ll) return NULL;
+
+	BidirectionalNode_t* n = __cdll_alloc_node(ll, value);
+
+	if (!n) return NULL;
+
+	__cdll_link_after(n, mark);
+
+	n->list = ll;
+	ll->size++;
+
+	return n;
+}
+
+/**
+ * @brief Insert a new node with value `value` immediately before `mark`
+ *
+ * If `mark` is not an element of the list, the list is not modified
+ *
+ * `mark` must not be NULL
+ *
+ * @param ll
+ * @param value
+ * @param mark
+ * @return BidirectionalNode_t*
+ */
+BidirectionalNode_t* cdll_insert_before(CircularDoublyLinkedList* ll, void* value, BidirectionalNode_t* mark) {
+	if (!mark || mark->list != ll) return NULL;
+
+	return cdll_insert_after(ll, value, mark->prev);
+}
+
+/**
+ * @brief Insert a copy of another list at the back of the caller list
+ *
+ * The lists may be the same, but must not be NULL
+ *
+ * @param ll
+ * @param other
+ * @return CircularDoublyLinkedList*
+ */
+CircularDoublyLinkedList* cdll_push_back_list(CircularDoublyLinkedList* ll, CircularDoublyLinkedList* other) {
+	if (!other || !ll) return NULL;
+
+	BidirectionalNode_t* n = other->head;
+
+	for (uint32_t i = other->size; i > 0; i--, n = n->next) {
+		cdll_push_back(ll, n->data);
+	}
+
+	return ll;
+}
+
+/**
+ * @brief Insert a copy of another list at the front of the caller list
+ *
+ * The lists may be the same, but must not be NULL
+ *
+ * @param ll
+ * @param other
+ * @return CircularDoublyLinkedList*
+ */
+CircularDoublyLinkedList* cdll_push_front_list(CircularDoublyLinkedList* ll, CircularDoublyLinkedList* other) {
+	if (!other || !ll) return NULL;
+
+	if (!other->head) return ll;
+
+	BidirectionalNode_t* n = other->head->prev;
+
+	for (uint32_t i = other->size; i > 0; i--, n = n->prev) {
+		cdll_push_front(ll, n->data);
+	}
+
+	return ll;
+}
+
+/**
+ * @brief Iterate over the list and invoke `callback` with each node
+ *
+ * @param ll
+ * @param callback
+ */
+void cdll_iterate(CircularDoublyLinkedList* ll, void (*callback)(void*)) {
+	BidirectionalNode_t* n = ll->head;
+
+	/* `next` is read before the callback so that the callback may free the node */
+	for (uint32_t i = ll->size; i > 0; i--) {
+		BidirectionalNode_t* next = n->next;
+
+		callback(n);
+		n = next;
+	}
+}
@@ -15,6 +15,12 @@
 #include <stdio.h>
 #include <unistd.h>
 
+/* Enough bins of 2^i-node runs to sort any list whose size fits in its uint32_t */
+#define CSLL_SORT_BINS 33
+
+/* Chunk size for nodes allocated after a compaction, such that one push does not allocate another list's worth */
+#define CSLL_COMPACT_CHUNK_SIZE 1024
+
 /**
  * @brief Bootstrap a new head node
  * @private
@@ -25,7 +31,8 @@
  */
 ForwardNode_t* __csll_new_head(CircularSinglyLinkedList* ll, ForwardNode_t* node) {
 	ll->head = node;
-	node->next = ll->head;
+	ll->tail = node;
+	node->next = node;
 
 	node->list = ll;
 	ll->size++;
@@ -36,11 +43,16 @@ ForwardNode_t* __csll_new_head(CircularSinglyLinkedList* ll, ForwardNode_t* node
  * @brief Find the node prior to the given target
  * @private
  *
+ * The node before the head is the tail, which is resolved in constant time;
+ * any other target requires a walk from the head
+ *
  * @param ll
  * @param target
  * @return ForwardNode_t*
  */
 ForwardNode_t* __csll_find_node_before(CircularSinglyLinkedList* ll, ForwardNode_t* target) {
+	if (target == ll->head) return ll->tail;
+
 	ForwardNode_t* tmp = ll->head;
 
 	while (tmp->next != target) {
@@ -64,13 +76,70 @@ ForwardNode_t* __csll_find_node_before(CircularSinglyLinkedList* ll, ForwardNode
 ForwardNode_t* __csll_move(CircularSinglyLinkedList* ll, ForwardNode_t* node, ForwardNode_t* at) {
 	ForwardNode_t* tmp = __csll_find_node_before(ll, node);
 
+	if (node == ll->head) ll->head = node->next;
+	if (node == ll->tail) ll->tail = tmp;
+
 	tmp->next = node->next;
 	node->next = at->next;
 	at->next = node;
 
+	if (at == ll->tail) ll->tail = node;
+
 	return node;
 }
 
+/**
+ * @brief Unlink every node for which `!!predicate(node, ctx) == match`, in a single traversal
+ * @private
+ *
+ * @param ll
+ * @param predicate
+ * @param ctx
+ * @param match
+ * @return ForwardNode_t* - the first unlinked node, chained through `next` and NULL-terminated
+ */
+ForwardNode_t* __csll_unlink_where(
+	CircularSinglyLinkedList* ll,
+	int (*predicate)(ForwardNode_t*, void*),
+	void* ctx,
+	int match
+) {
+	ForwardNode_t removed = { 0 };
+	ForwardNode_t* last_removed = &removed;
+	ForwardNode_t* prev = ll->tail;
+	ForwardNode_t* n = ll->head;
+
+	for (uint32_t i = ll->size; i > 0; i--) {
+		ForwardNode_t* next = n->next;
+
+		if (!!predicate(n, ctx) == match) {
+			// until a node is kept, `prev` is the old tail, which thereby comes to point at the first kept node
+			prev->next = next;
+
+			n->next = NULL;
+			n->list = NULL;
+			last_removed->next = n;
+			last_removed = n;
+
+			ll->size--;
+		} else {
+			prev = n;
+		}
+
+		n = next;
+	}
+
+	if (!ll->size) {
+		ll->head = NULL;
+		ll->tail = NULL;
+	} else {
+		ll->tail = prev;
+		ll->head = prev->next;
+	}
+
+	return removed.next;
+}
+
 /**
  * @brief Generate a new node
  * @private
@@ -81,6 +150,30 @@ ForwardNode_t* __csll_move(CircularSinglyLinkedList* ll, ForwardNode_t* node, Fo
 ForwardNode_t* __csll_make_node(void* value) {
 	ForwardNode_t* n = malloc(sizeof(ForwardNode_t));
 
+	if (!n) return NULL;
+
+	n->data = value;
+	n->next = NULL;
+	n->list = NULL;
+
+	return n;
+}
+
+/**
+ * @brief Generate a new node using the list's allocator
+ * @private
+ *
+ * @param ll
+ * @param value
+ * @return ForwardNode_t* - NULL if the allocator is exhausted
+ */
+ForwardNode_t* __csll_alloc_node(CircularSinglyLinkedList* ll, void* value) {
+	if (!ll->allocator) return __csll_make_node(value);
+
+	ForwardNode_t* n = ll->allocator->alloc(ll->allocator->ctx, sizeof(ForwardNode_t));
+
+	if (!n) return NULL;
+
 	n->data = value;
 	n->next = NULL;
 	n->list = NULL;
@@ -94,14 +187,83 @@ ForwardNode_t* __csll_make_node(void* value) {
  * @return CircularSinglyLinkedList*
  */
 CircularSinglyLinkedList* csll_make_list(void) {
+	return csll_make_list_with_allocator(NULL);
+}
+
+/**
+ * @brief Instantiate an empty circular singly linked list whose nodes are obtained from `allocator`
+ *
+ * The list does not own the allocator, which may be shared with other lists; `csll_destroy_list` frees each node
+ *
+ * @param allocator
+ * @return CircularSinglyLinkedList*
+ */
+CircularSinglyLinkedList* csll_make_list_with_allocator(NodeAllocator_t* allocator) {
 	CircularSinglyLinkedList* ll = malloc(sizeof(CircularSinglyLinkedList));
 
+	if (!ll) return NULL;
+
 	ll->head = NULL;
+	ll->tail = NULL;
 	ll->size = 0;
+	ll->allocator = allocator;
+	ll->owns_allocator = 0;
 
 	return ll;
 }
 
+/**
+ * @brief Instantiate an empty circular singly linked list that owns `allocator`, from which its nodes are obtained
+ *
+ * If the allocator provides `release`, `csll_destroy_list` releases it rather than freeing each node; it must not
+ * be shared with any other list
+ *
+ * @param allocator
+ * @return CircularSinglyLinkedList*
+ */
+CircularSinglyLinkedList* csll_make_list_owning_allocator(NodeAllocator_t* allocator) {
+	CircularSinglyLinkedList* ll = csll_make_list_with_allocator(allocator);
+
+	if (ll) ll->owns_allocator = allocator != NULL;
+
+	return ll;
+}
+
+/**
+ * @brief Return a node that was removed from the list to the list's allocator
+ *
+ * @param ll
+ * @param node
+ */
+void csll_release_node(CircularSinglyLinkedList* ll, ForwardNode_t* node) {
+	if (!node) return;
+
+	if (ll->allocator) ll->allocator->free(ll->allocator->ctx, node);
+	else free(node);
+}
+
+/**
+ * @brief Free all nodes of the list and the list itself; node data is not freed
+ *
+ * @param ll
+ */
+void csll_destroy_list(CircularSinglyLinkedList* ll) {
+	if (ll->owns_allocator && ll->allocator->release) {
+		ll->allocator->release(ll->allocator->ctx);
+	} else {
+		ForwardNode_t* n = ll->head;
+
+		for (uint32_t i = ll->size; i > 0; i--) {
+			ForwardNode_t* next = n->next;
+
+			csll_release_node(ll, n);
+			n = next;
+		}
+	}
+
+	free(ll);
+}
+
 /**
  * @brief Returns the previous list node, if extant; else, NULL
  *
@@ -137,21 +299,18 @@ ForwardNode_t* csll_next(CircularSinglyLinkedList* ll, ForwardNode_t* node) {
  *
  * @param ll
  * @param value
- * @return ForwardNode_t*
+ * @return ForwardNode_t* - the new node, or NULL if it could not be allocated
  */
 ForwardNode_t* csll_push_back(CircularSinglyLinkedList* ll, void* value) {
-	ForwardNode_t* node = __csll_make_node(value);
+	ForwardNode_t* node = __csll_alloc_node(ll, value);
 
-	if (!ll->head) return __csll_new_head(ll, node);
+	if (!node) return NULL;
 
-	if (ll->head && ll->size == 1) {
-		ll->head->next = node;
-	} else {
-		ForwardNode_t* tmp = __csll_find_node_before(ll, ll->head);
-		tmp->next = node;
-	}
+	if (!ll->head) return __csll_new_head(ll, node);
 
+	ll->tail->next = node;
 	node->next = ll->head;
+	ll->tail = node;
 
 	node->list = ll;
 	ll->size++;
@@ -164,18 +323,18 @@ ForwardNode_t* csll_push_back(CircularSinglyLinkedList* ll, void* value) {
  *
  * @param ll
  * @param value
- * @return ForwardNode_t*
+ * @return ForwardNode_t* - the new node, or NULL if it could not be allocated
  */
 ForwardNode_t* csll_push_front(CircularSinglyLinkedList* ll, void* value) {
-	ForwardNode_t* node = __csll_make_node(value);
+	ForwardNode_t* node = __csll_alloc_node(ll, value);
 
-	if (!ll->head) return __csll_new_head(ll, node);
+	if (!node) return NULL;
 
-	ForwardNode_t* tmp = __csll_find_node_before(ll, ll->head);
+	if (!ll->head) return __csll_new_head(ll, node);
 
 	node->next = ll->head;
 	ll->head = node;
-	tmp->next = ll->head;
+	ll->tail->next = ll->head;
 
 	node->list = ll;
 	ll->size++;
@@ -246,23 +405,16 @@ ForwardNode_t* csll_remove_node(CircularSinglyLinkedList* ll, ForwardNode_t* nod
 
 	if (node->list != ll) return NULL;
 
-	ForwardNode_t* tmp1 = ll->head;
-	ForwardNode_t* tmp2 = NULL;
-
-	while (tmp1 != node) {
-		tmp2 = tmp1;
-		tmp1 = tmp1->next;
-	}
-
-	if (tmp1 == ll->head) {
-		tmp2 = ll->head;
+	if (ll->size == 1) {
+		ll->head = NULL;
+		ll->tail = NULL;
+	} else {
+		ForwardNode_t* tmp = __csll_find_node_before(ll, node);
 
-		while (tmp2->next != ll->head) tmp2 = tmp2->next;
+		tmp->next = node->next;
 
-		ll->head = ll->head->next;
-		tmp2->next = ll->head;
-	} else {
-		tmp2->next = tmp1->next;
+		if (node == ll->head) ll->head = node->next;
+		if (node == ll->tail) ll->tail = tmp;
 	}
 
 	node->list = NULL;
@@ -275,17 +427,75 @@ ForwardNode_t* csll_remove_node(CircularSinglyLinkedList* ll, ForwardNode_t* nod
 /**
  * @brief Remove the last node from the list
  *
+ * Unlinking the tail requires its predecessor, so this walks the list once
+ *
  * @param ll
  * @return ForwardNode_t*
  */
 ForwardNode_t* csll_pop(CircularSinglyLinkedList* ll) {
 	if (!ll->head) return NULL;
 
-	ForwardNode_t* tmp = ll->head;
+	return csll_remove_node(ll, ll->tail);
+}
+
+/**
+ * @brief Remove the first node from the list in constant time
+ *
+ * @param ll
+ * @return ForwardNode_t*
+ */
+ForwardNode_t* csll_pop_front(CircularSinglyLinkedList* ll) {
+	if (!ll->head) return NULL;
+
+	return csll_remove_node(ll, ll->head);
+}
 
-	while (tmp->next != ll->head) tmp = tmp->next;
+/**
+ * @brief Unlink, in a single traversal, every node for which `predicate` returns non-zero
+ *
+ * The removed nodes keep their relative order and are handed back as a NULL-terminated chain linked through `next`;
+ * the caller returns each to the list via csll_release_node
+ *
+ * @param ll
+ * @param predicate - invoked with each node and `ctx`
+ * @param ctx
+ * @return ForwardNode_t* - the first removed node, or NULL if none matched
+ */
+ForwardNode_t* csll_remove_if(CircularSinglyLinkedList* ll, int (*predicate)(ForwardNode_t*, void*), void* ctx) {
+	return __csll_unlink_where(ll, predicate, ctx, 1);
+}
+
+/**
+ * @brief Keep only the nodes for which `predicate` returns non-zero, in a single traversal, and release the rest
+ *
+ * Each removed node is passed to `dispose`, if provided, e.g. to free its data, and is then released
+ *
+ * @param ll
+ * @param predicate - invoked with each node and `ctx`
+ * @param dispose - invoked with each removed node and `ctx`
+ * @param ctx
+ * @return uint32_t - the number of nodes removed
+ */
+uint32_t csll_retain(
+	CircularSinglyLinkedList* ll,
+	int (*predicate)(ForwardNode_t*, void*),
+	void (*dispose)(ForwardNode_t*, void*),
+	void* ctx
+) {
+	ForwardNode_t* n = __csll_unlink_where(ll, predicate, ctx, 0);
+	uint32_t removed = 0;
+
+	while (n) {
+		ForwardNode_t* next = n->next;
+
+		if (dispose) dispose(n, ctx);
+
+		csll_release_node(ll, n);
+		n = next;
+		removed++;
+	}
 
-	return csll_remove_node(ll, tmp);
+	return removed;
 }
 
 /**
@@ -303,19 +513,15 @@ ForwardNode_t* csll_pop(CircularSinglyLinkedList* ll) {
 ForwardNode_t* csll_insert_after(CircularSinglyLinkedList* ll, void* value, ForwardNode_t* mark) {
 	if (!mark || mark->list != ll) return NULL;
 
-	ForwardNode_t* n = __csll_make_node(value);
+	ForwardNode_t* n = __csll_alloc_node(ll, value);
 
+	if (!n) return NULL;
 	if (!ll->head) return __csll_new_head(ll, n);
 
-	ForwardNode_t* tmp = __csll_find_node_before(ll, mark->next);
+	n->next = mark->next;
+	mark->next = n;
 
-	if (tmp->next == ll->head) {
-		tmp->next = n;
-		n->next = ll->head;
-	} else {
-		n->next = tmp->next;
-		tmp->next = n;
-	}
+	if (mark == ll->tail) ll->tail = n;
 
 	n->list = ll;
 	ll->size++;
@@ -374,10 +580,17 @@ CircularSinglyLinkedList* csll_push_back_list(CircularSinglyLinkedList* ll, Circ
 CircularSinglyLinkedList* csll_push_front_list(CircularSinglyLinkedList* ll, CircularSinglyLinkedList* other) {
 	if (!other || !ll) return NULL;
 
-	ForwardNode_t* n = csll_prev(other, other->head);
+	if (!other->head) return ll;
+
+	ForwardNode_t* n = other->head;
+	uint32_t size = other->size;
+
+	/* Copies are chained after the new head; the originals (and thus the walk over `other`) are never relinked */
+	ForwardNode_t* last = csll_push_front(ll, n->data);
 
-	for (int i = other->size; i > 0; i--, n = csll_prev(other, n)) {
-		csll_push_front(ll, n->data);
+	for (uint32_t i = size - 1; i > 0; i--) {
+		n = n->next;
+		last = csll_insert_after(ll, n->data, last);
 	}
 
 	return ll;
@@ -392,8 +605,348 @@ CircularSinglyLinkedList* csll_push_front_list(CircularSinglyLinkedList* ll, Cir
 void csll_iterate(CircularSinglyLinkedList* ll, void (*callback)(void*)) {
 	ForwardNode_t* n = ll->head;
 
-	do {
+	/* `next` is read before the callback so that the callback may free the node */
+	for (uint32_t i = ll->size; i > 0; i--) {
+		ForwardNode_t* next = n->next;
+
 		callback(n);
-		n = n->next;
-	} while (n->next && n != ll->head);
+		n = next;
+	}
+}
+
+/**
+ * @brief Stably merge two sorted, NULL-terminated chains
+ * @private
+ *
+ * @param a
+ * @param b
+ * @param comparator
+ * @return ForwardNode_t* - the first node of the merged chain
+ */
+ForwardNode_t* __csll_merge_chains(ForwardNode_t* a, ForwardNode_t* b, int (*comparator)(void*, void*)) {
+	ForwardNode_t dummy;
+	ForwardNode_t* last = &dummy;
+
+	while (a && b) {
+		// take from `b` only if it strictly precedes, such that equal nodes keep their order
+		if (comparator(b->data, a->data) == -1) {
+			last->next = b;
+			b = b->next;
+		} else {
+			last->next = a;
+			a = a->next;
+		}
+
+		last = last->next;
+	}
+
+	last->next = a ? a : b;
+
+	return dummy.next;
+}
+
+/**
+ * @brief Close a NULL-terminated chain of the list's nodes back into a ring starting at `first`
+ * @private
+ *
+ * @param ll
+ * @param first
+ */
+void __csll_close_ring(CircularSinglyLinkedList* ll, ForwardNode_t* first) {
+	ForwardNode_t* last = first;
+
+	while (last->next) last = last->next;
+
+	last->next = first;
+	ll->head = first;
+	ll->tail = last;
+}
+
+/**
+ * @brief Sort the list in place by node data; stable, O(n log n), and allocation-free
+ *
+ * Bottom-up: each node is carried into bins of sorted runs of 2^i nodes, as with binary addition
+ *
+ * @param ll
+ * @param comparator
+ */
+void csll_sort(CircularSinglyLinkedList* ll, int (*comparator)(void*, void*)) {
+	if (ll->size < 2) return;
+
+	ForwardNode_t* bins[CSLL_SORT_BINS] = { NULL };
+	ForwardNode_t* curr = ll->head;
+
+	ll->tail->next = NULL;
+
+	while (curr) {
+		ForwardNode_t* run = curr;
+		int i = 0;
+
+		curr = curr->next;
+		run->next = NULL;
+
+		// older runs hold earlier nodes, and so are always the left side of the merge
+		for (; bins[i]; i++) {
+			run = __csll_merge_chains(bins[i], run, comparator);
+			bins[i] = NULL;
+		}
+
+		bins[i] = run;
+	}
+
+	ForwardNode_t* sorted = NULL;
+
+	for (int i = 0; i < CSLL_SORT_BINS; i++) {
+		if (bins[i]) sorted = __csll_merge_chains(bins[i], sorted, comparator);
+	}
+
+	__csll_close_ring(ll, sorted);
+}
+
+/**
+ * @brief Merge the nodes of the sorted list `other` into the sorted list `ll`, leaving `other` empty
+ *
+ * Where nodes compare equal, those of `ll` come first. Nodes change lists, so both lists must use the same allocator,
+ * and `other` must not own it: destroying `other` would then release the nodes it gave to `ll`
+ *
+ * @param ll
+ * @param other
+ * @param comparator
+ * @return int - 0 if success, else -1
+ */
+int csll_merge(CircularSinglyLinkedList* ll, CircularSinglyLinkedList* other, int (*comparator)(void*, void*)) {
+	if (!ll || !other || ll == other || ll->allocator != other->allocator || other->owns_allocator) return -1;
+
+	if (!other->head) return 0;
+
+	ForwardNode_t* n = other->head;
+
+	for (uint32_t i = other->size; i > 0; i--, n = n->next) n->list = ll;
+
+	other->tail->next = NULL;
+
+	if (ll->head) {
+		ll->tail->next = NULL;
+		__csll_close_ring(ll, __csll_merge_chains(ll->head, other->head, comparator));
+	} else {
+		__csll_close_ring(ll, other->head);
+	}
+
+	ll->size += other->size;
+
+	other->head = NULL;
+	other->tail = NULL;
+	other->size = 0;
+
+	return 0;
+}
+
+/**
+ * @brief Fraction of traversal steps whose next node does not immediately follow the current one in memory
+ *
+ * A step is contiguous if the next node lies after the current one, within a cache line of it
+ *
+ * @param ll
+ * @return double
+ */
+double csll_fragmentation(CircularSinglyLinkedList* ll) {
+	if (ll->size < 2) return 0;
+
+	uint32_t scattered = 0;
+	ForwardNode_t* n = ll->head;
+
+	// the step from the tail back to the head is not counted
+	for (uint32_t i = ll->size - 1; i > 0; i--, n = n->next) {
+		uintptr_t from = (uintptr_t)n, to = (uintptr_t)n->next;
+
+		if (to <= from || to - from > CACHE_LINE_SIZE) scattered++;
+	}
+
+	return (double)scattered / (double)(ll->size - 1);
+}
+
+/**
+ * @brief Reallocate every node into one contiguous block, in traversal order
+ *
+ * The list's allocator is replaced by a NodePool which owns the block and which the list owns. If the list owned its
+ * previous allocator and it provides `release`, it is released; else each previous node is returned to it, such that
+ * an allocator shared with other lists remains valid. `remap`, if provided, is invoked with each node's old and new
+ * address before the old node is freed, for callers that hold node pointers
+ *
+ * @param ll
+ * @param remap
+ * @param ctx
+ * @return int - 0 if success, else -1 and the list is unmodified
+ */
+int csll_compact(
+	CircularSinglyLinkedList* ll,
+	void (*remap)(ForwardNode_t* from, ForwardNode_t* to, void* ctx),
+	void* ctx
+) {
+	if (!ll->size) return 0;
+
+	NodePool_t* pool = node_pool_make(sizeof(ForwardNode_t), ll->size);
+
+	if (!pool) return -1;
+
+	/* The first allocation carves the whole block; nothing below may fail */
+	ForwardNode_t* first = node_pool_alloc(pool);
+
+	if (!first) {
+		node_pool_destroy(pool);
+		return -1;
+	}
+
+	pool->chunk_size = CSLL_COMPACT_CHUNK_SIZE;
+
+	NodeAllocator_t* previous = ll->allocator;
+	int release_all = ll->owns_allocator && previous && previous->release;
+
+	ForwardNode_t* from = ll->head;
+	ForwardNode_t* to = first;
+	ForwardNode_t* last = NULL;
+
+	for (uint32_t i = ll->size; i > 0; i--) {
+		ForwardNode_t* next = from->next;
+
+		if (last) {
+			to = node_pool_alloc(pool);
+			last->next = to;
+		}
+
+		to->data = from->data;
+		to->list = ll;
+
+		if (remap) remap(from, to, ctx);
+		if (!release_all) csll_release_node(ll, from);
+
+		last = to;
+		from = next;
+	}
+
+	last->next = first;
+	ll->head = first;
+	ll->tail = last;
+
+	if (release_all) previous->release(previous->ctx);
+
+	ll->allocator = &pool->allocator;
+	ll->owns_allocator = 1;
+
+	return 0;
+}
+
+/**
+ * @brief Advance the head of the list by `k` nodes, such that the node `k` places after the head becomes the head
+ *
+ * No links change, but a singly linked ring must be walked `k % size` steps, so rotation is O(k mod n); a single
+ * step is constant time
+ *
+ * @param ll
+ * @param k
+ * @return ForwardNode_t* - the new head, or NULL if the list is empty
+ */
+ForwardNode_t* csll_rotate(CircularSinglyLinkedList* ll, uint32_t k) {
+	if (!ll->head) return NULL;
+
+	for (k %= ll->size; k > 0; k--) {
+		ll->tail = ll->head;
+		ll->head = ll->head->next;
+	}
+
+	return ll->head;
+}
+
+/**
+ * @brief Initialize a round-robin cursor whose first yield is the head of the list
+ *
+ * @param c
+ * @param ll
+ */
+void csll_rr_init(csll_rr_cursor_t* c, CircularSinglyLinkedList* ll) {
+	c->ll = ll;
+	c->prev = NULL;
+	c->node = NULL;
+}
+
+/**
+ * @brief Advance the cursor to the next node, wrapping from the tail to the head, in constant time
+ *
+ * @param c
+ * @return ForwardNode_t* - the next node, or NULL if the list is empty
+ */
+ForwardNode_t* csll_rr_next(csll_rr_cursor_t* c) {
+	if (!c->ll->head) {
+		c->prev = NULL;
+		c->node = NULL;
+
+		return NULL;
+	}
+
+	if (c->node) c->prev = c->node;
+	else if (!c->prev) c->prev = c->ll->tail;
+
+	c->node = c->prev->next;
+
+	return c->node;
+}
+
+/**
+ * @brief Advance the cursor by `k` nodes, as would `k` calls to csll_rr_next, walking only `k % size` steps
+ *
+ * A cursor without a current node (fresh, or just after a removal) first takes one step onto a node, after which the
+ * remaining `k - 1` steps are reduced modulo the size
+ *
+ * @param c
+ * @param k
+ * @return ForwardNode_t* - the node the cursor is then on, or NULL if the list is empty
+ */
+ForwardNode_t* csll_rr_skip(csll_rr_cursor_t* c, uint32_t k) {
+	if (!c->ll->head) return csll_rr_next(c);
+
+	// the first step lands on a node, and only then does the walk repeat every `size` steps
+	if (!c->node && k) {
+		csll_rr_next(c);
+		k--;
+	}
+
+	for (k %= c->ll->size; k > 0; k--) csll_rr_next(c);
+
+	return c->node;
+}
+
+/**
+ * @brief Remove the cursor's current node in constant time; the next call to csll_rr_next yields its successor
+ *
+ * If nodes were inserted between the current node and its tracked predecessor, the predecessor is found by walking the
+ * list
+ *
+ * @param c
+ * @return ForwardNode_t* - the removed node, for the caller to release, or NULL if the cursor has no current node
+ */
+ForwardNode_t* csll_rr_remove(csll_rr_cursor_t* c) {
+	CircularSinglyLinkedList* ll = c->ll;
+	ForwardNode_t* node = c->node;
+
+	if (!node) return NULL;
+
+	if (ll->size == 1) {
+		ll->head = NULL;
+		ll->tail = NULL;
+		c->prev = NULL;
+	} else {
+		if (c->prev->next != node) c->prev = __csll_find_node_before(ll, node);
+
+		c->prev->next = node->next;
+
+		if (node == ll->head) ll->head = node->next;
+		if (node == ll->tail) ll->tail = c->prev;
+	}
+
+	node->list = NULL;
+	c->node = NULL;
+
+	ll->size--;
+
+	return node;
 }
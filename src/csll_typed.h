@@ -0,0 +1,197 @@
+#ifndef LIBCARTILAGE_CSLL_TYPED_H
+#define LIBCARTILAGE_CSLL_TYPED_H
+
+#include "libcartilage.h"
+
+#include <stdlib.h>
+
+/*****************************
+ *	Typed CircularSinglyLinkedList
+ *****************************/
+
+/**
+ * @brief Visit each node of a typed list, head to tail; the list must not be modified meanwhile
+ *
+ * `node` must be a variable of the list's node pointer type
+ */
+#define CSLL_TYPED_FOREACH(ll, node) \
+	for ((node) = (ll)->head; (node); (node) = (node)->next == (ll)->head ? NULL : (node)->next)
+
+/**
+ * @brief Generate a circular singly linked list of `T`, stored inline in each node
+ *
+ * Emits the types `name##_node_t` and `name##_t`, and `static inline` functions prefixed `name##_` which mirror the
+ * `csll_*` API; values are copied in and out rather than referenced through a `void*`. As with the CSLL, the list
+ * tracks its tail such that tail->next == head, and nodes come from an optional NodeAllocator_t, else malloc
+ *
+ * @param name - prefix of the generated types and functions
+ * @param T - the element type
+ */
+#define CSLL_DEFINE(name, T)                                                                          \
+	typedef struct name##_node {                                                                        \
+		struct name##_node* next;                                                                         \
+		T value;                                                                                          \
+	} name##_node_t;                                                                                    \
+	                                                                                                    \
+	typedef struct name {                                                                               \
+		name##_node_t* head;                                                                              \
+		name##_node_t* tail;                                                                              \
+		uint32_t size;                                                                                    \
+		NodeAllocator_t* allocator; /* Node allocator; NULL for malloc */                                 \
+		int owns_allocator; /* Whether destroy releases the allocator rather than freeing each node */    \
+	} name##_t;                                                                                         \
+	                                                                                                    \
+	/* Instantiate an empty list of nodes from `allocator`, or malloc if NULL; the list does not own it */ \
+	static inline name##_t* name##_make_list_with_allocator(NodeAllocator_t* allocator) {               \
+		name##_t* ll = malloc(sizeof(name##_t));                                                          \
+		                                                                                                  \
+		if (!ll) return NULL;                                                                             \
+		                                                                                                  \
+		ll->head = NULL;                                                                                  \
+		ll->tail = NULL;                                                                                  \
+		ll->size = 0;                                                                                     \
+		ll->allocator = allocator;                                                                        \
+		ll->owns_allocator = 0;                                                                           \
+		                                                                                                  \
+		return ll;                                                                                        \
+	}                                                                                                   \
+	                                                                                                    \
+	/* As above, but the list owns `allocator`: destroy releases it if it provides `release` */         \
+	static inline name##_t* name##_make_list_owning_allocator(NodeAllocator_t* allocator) {             \
+		name##_t* ll = name##_make_list_with_allocator(allocator);                                        \
+		                                                                                                  \
+		if (ll) ll->owns_allocator = allocator != NULL;                                                   \
+		                                                                                                  \
+		return ll;                                                                                        \
+	}                                                                                                   \
+	                                                                                                    \
+	/* Instantiate an empty list */                                                                     \
+	static inline name##_t* name##_make_list(void) {                                                    \
+		return name##_make_list_with_allocator(NULL);                                                     \
+	}                                                                                                   \
+	                                                                                                    \
+	/* Return a node to the list's allocator */                                                         \
+	static inline void name##_release_node(name##_t* ll, name##_node_t* node) {                         \
+		if (ll->allocator) ll->allocator->free(ll->allocator->ctx, node);                                 \
+		else free(node);                                                                                  \
+	}                                                                                                   \
+	                                                                                                    \
+	/* Free all nodes of the list and the list itself, releasing an allocator the list owns */          \
+	static inline void name##_destroy_list(name##_t* ll) {                                              \
+		if (ll->owns_allocator && ll->allocator->release) {                                               \
+			ll->allocator->release(ll->allocator->ctx);                                                     \
+		} else {                                                                                          \
+			name##_node_t* n = ll->head;                                                                    \
+			                                                                                                \
+			for (uint32_t i = ll->size; i > 0; i--) {                                                       \
+				name##_node_t* next = n->next;                                                                \
+				                                                                                              \
+				name##_release_node(ll, n);                                                                   \
+				n = next;                                                                                     \
+			}                                                                                               \
+		}                                                                                                 \
+		                                                                                                  \
+		free(ll);                                                                                         \
+	}                                                                                                   \
+	                                                                                                    \
+	/* Allocate a node holding a copy of `value` and link it between the tail and the head */            \
+	static inline name##_node_t* name##_link_node(name##_t* ll, T value) {                              \
+		name##_node_t* n = ll->allocator                                                                  \
+			? ll->allocator->alloc(ll->allocator->ctx, sizeof(name##_node_t))                               \
+			: malloc(sizeof(name##_node_t));                                                                \
+		                                                                                                  \
+		if (!n) return NULL;                                                                              \
+		                                                                                                  \
+		n->value = value;                                                                                 \
+		                                                                                                  \
+		if (!ll->head) {                                                                                  \
+			ll->head = n;                                                                                   \
+			ll->tail = n;                                                                                   \
+		} else {                                                                                          \
+			ll->tail->next = n;                                                                             \
+		}                                                                                                 \
+		                                                                                                  \
+		n->next = ll->head;                                                                               \
+		ll->size++;                                                                                       \
+		                                                                                                  \
+		return n;                                                                                         \
+	}                                                                                                   \
+	                                                                                                    \
+	/* Push a copy of `value` to the back of the list; NULL if a node could not be allocated */         \
+	static inline name##_node_t* name##_push_back(name##_t* ll, T value) {                              \
+		name##_node_t* n = name##_link_node(ll, value);                                                   \
+		                                                                                                  \
+		if (n) ll->tail = n;                                                                              \
+		                                                                                                  \
+		return n;                                                                                         \
+	}                                                                                                   \
+	                                                                                                    \
+	/* Push a copy of `value` to the front of the list; NULL if a node could not be allocated */        \
+	static inline name##_node_t* name##_push_front(name##_t* ll, T value) {                             \
+		name##_node_t* n = name##_link_node(ll, value);                                                   \
+		                                                                                                  \
+		if (n) ll->head = n;                                                                              \
+		                                                                                                  \
+		return n;                                                                                         \
+	}                                                                                                   \
+	                                                                                                    \
+	/* Unlink the node following `prev`, copy its value to `out` if not NULL, and release it */          \
+	static inline void name##_unlink_after(name##_t* ll, name##_node_t* prev, T* out) {                 \
+		name##_node_t* n = prev->next;                                                                    \
+		                                                                                                  \
+		if (out) *out = n->value;                                                                         \
+		                                                                                                  \
+		if (ll->size == 1) {                                                                              \
+			ll->head = NULL;                                                                                \
+			ll->tail = NULL;                                                                                \
+		} else {                                                                                          \
+			prev->next = n->next;                                                                           \
+			                                                                                                \
+			if (n == ll->head) ll->head = n->next;                                                          \
+			if (n == ll->tail) ll->tail = prev;                                                             \
+		}                                                                                                 \
+		                                                                                                  \
+		ll->size--;                                                                                       \
+		name##_release_node(ll, n);                                                                       \
+	}                                                                                                   \
+	                                                                                                    \
+	/* Remove the first value in constant time, copying it to `out` if not NULL; -1 if empty */         \
+	static inline int name##_pop_front(name##_t* ll, T* out) {                                          \
+		if (!ll->head) return -1;                                                                         \
+		                                                                                                  \
+		name##_unlink_after(ll, ll->tail, out);                                                           \
+		                                                                                                  \
+		return 0;                                                                                         \
+	}                                                                                                   \
+	                                                                                                    \
+	/* Remove the last value, copying it to `out` if not NULL; -1 if empty. Walks the list once */      \
+	static inline int name##_pop(name##_t* ll, T* out) {                                                \
+		if (!ll->head) return -1;                                                                         \
+		                                                                                                  \
+		name##_node_t* prev = ll->head;                                                                   \
+		                                                                                                  \
+		while (prev->next != ll->tail) prev = prev->next;                                                 \
+		                                                                                                  \
+		name##_unlink_after(ll, prev, out);                                                               \
+		                                                                                                  \
+		return 0;                                                                                         \
+	}                                                                                                   \
+	                                                                                                    \
+	/* Pointer to the first value, or NULL if empty */                                                  \
+	static inline T* name##_front(name##_t* ll) {                                                       \
+		return ll->head ? &ll->head->value : NULL;                                                        \
+	}                                                                                                   \
+	                                                                                                    \
+	/* Pointer to the last value, or NULL if empty */                                                   \
+	static inline T* name##_back(name##_t* ll) {                                                        \
+		return ll->tail ? &ll->tail->value : NULL;                                                        \
+	}                                                                                                   \
+	                                                                                                    \
+	/* Iterate over the list and invoke `callback` with a pointer to each value */                      \
+	static inline void name##_iterate(name##_t* ll, void (*callback)(T*)) {                             \
+		name##_node_t* n = ll->head;                                                                      \
+		                                                                                                  \
+		for (uint32_t i = 0; i < ll->size; i++, n = n->next) callback(&n->value);                         \
+	}
+
+#endif /* LIBCARTILAGE_CSLL_TYPED_H */
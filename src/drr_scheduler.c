@@ -0,0 +1,189 @@
+/**
+ * @file drr_scheduler.c
+ * @author Matthew Zito (goldmund@freenode)
+ * @brief Implements a deficit round-robin scheduler over a circular singly linked list
+ * @version 0.1
+ * @date 2021-07-11
+ *
+ * @copyright Copyright (c) 2021 Matthew Zito (goldmund)
+ *
+ */
+
+#include "libcartilage.h"
+
+#include <stdlib.h>
+
+/* Nodes and members per NodePool chunk */
+#define DRR_CHUNK_SIZE 64
+
+/**
+ * @brief Unlink the cursor's current member from the ring and free it
+ * @private
+ *
+ * @param s
+ */
+void __drr_unlink_current(drr_scheduler_t* s) {
+	ForwardNode_t* node = csll_rr_remove(&s->cursor);
+
+	node_pool_free(s->members, node->data);
+	csll_release_node(s->ring, node);
+}
+
+/**
+ * @brief Instantiate an empty scheduler
+ *
+ * @return drr_scheduler_t* - NULL if allocation failed
+ */
+drr_scheduler_t* drr_make(void) {
+	drr_scheduler_t* s = malloc(sizeof(drr_scheduler_t));
+	NodePool_t* nodes = node_pool_make(sizeof(ForwardNode_t), DRR_CHUNK_SIZE);
+	NodePool_t* members = node_pool_make(sizeof(drr_member_t), DRR_CHUNK_SIZE);
+
+	if (!s || !nodes || !members) goto fail;
+
+	if (!(s->ring = csll_make_list_owning_allocator(&nodes->allocator))) goto fail;
+
+	csll_rr_init(&s->cursor, s->ring);
+	s->members = members;
+	s->size = 0;
+
+	return s;
+
+fail:
+	if (nodes) node_pool_destroy(nodes);
+	if (members) node_pool_destroy(members);
+	free(s);
+
+	return NULL;
+}
+
+/**
+ * @brief Free the scheduler along with its members; member data is not freed
+ *
+ * @param s
+ */
+void drr_destroy(drr_scheduler_t* s) {
+	csll_destroy_list(s->ring);
+	node_pool_destroy(s->members);
+	free(s);
+}
+
+/**
+ * @brief Add a member holding `data` at the tail of the ring in constant time
+ *
+ * @param s
+ * @param data
+ * @param quantum - picks per round; must be at least 1
+ * @return drr_member_t* - the member's handle, or NULL if `quantum` is 0 or allocation failed
+ */
+drr_member_t* drr_add(drr_scheduler_t* s, void* data, uint32_t quantum) {
+	if (!quantum) return NULL;
+
+	drr_member_t* m = node_pool_alloc(s->members);
+
+	if (!m) return NULL;
+
+	ForwardNode_t* tail = s->ring->tail;
+
+	if (!(m->node = csll_push_back(s->ring, m))) {
+		node_pool_free(s->members, m);
+		return NULL;
+	}
+
+	m->data = data;
+	m->quantum = quantum;
+	m->deficit = 0;
+	m->removed = 0;
+
+	// the new tail now precedes the head; if that is the cursor's current node, keep its removal constant time
+	if (s->cursor.node && s->cursor.prev == tail && s->cursor.node == m->node->next) s->cursor.prev = m->node;
+
+	s->size++;
+
+	return m;
+}
+
+/**
+ * @brief Remove a member in constant time, invalidating its handle
+ *
+ * The last member picked is unlinked immediately; any other member is marked and unlinked when the cursor reaches it,
+ * such that the work is amortized over picks
+ *
+ * @param s
+ * @param m
+ * @return int - 0 if success, else -1 if the member is already pending removal
+ */
+int drr_remove(drr_scheduler_t* s, drr_member_t* m) {
+	if (m->removed) return -1;
+
+	s->size--;
+
+	if (m->node == s->cursor.node) {
+		__drr_unlink_current(s);
+	} else {
+		m->removed = 1;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Pick the next member in amortized constant time
+ *
+ * @param s
+ * @return drr_member_t* - the member, or NULL if the scheduler is empty
+ */
+drr_member_t* drr_pick(drr_scheduler_t* s) {
+	if (!s->size) return NULL;
+
+	drr_member_t* m = s->cursor.node ? s->cursor.node->data : NULL;
+
+	// every member is granted at least one pick per visit, so this loops only to unlink members pending removal
+	while (!m || !m->deficit) {
+		m = csll_rr_next(&s->cursor)->data;
+
+		if (m->removed) {
+			__drr_unlink_current(s);
+			m = NULL;
+		} else {
+			m->deficit = m->quantum;
+		}
+	}
+
+	m->deficit--;
+
+	return m;
+}
+
+/**
+ * @brief Pick up to `n` members into `out`, as would `n` calls to drr_pick
+ *
+ * @param s
+ * @param out
+ * @param n
+ * @return uint32_t - the number of members picked; 0 if the scheduler is empty, else `n`
+ */
+uint32_t drr_pick_batch(drr_scheduler_t* s, drr_member_t** out, uint32_t n) {
+	if (!s->size) return 0;
+
+	for (uint32_t i = 0; i < n;) {
+		drr_member_t* m = drr_pick(s);
+
+		out[i++] = m;
+
+		// the rest of the member's round can be handed out without revisiting the ring
+		for (; m->deficit && i < n; m->deficit--) out[i++] = m;
+	}
+
+	return n;
+}
+
+/**
+ * @brief Get the number of members, excluding those pending removal
+ *
+ * @param s
+ * @return uint32_t
+ */
+uint32_t drr_size(drr_scheduler_t* s) {
+	return s->size;
+}
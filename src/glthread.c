@@ -13,6 +13,9 @@
 
 #include <stdlib.h>
 
+/* Enough bins of 2^i-node runs to sort any chain that fits in memory */
+#define GLTHREAD_SORT_BINS 64
+
 /**
  * @brief Initialize a new glthread
  *
@@ -209,3 +212,457 @@ glthread_t* glthread_dequeue_first(glthread_t* head) {
 
 	return tmp;
 }
+
+/**
+ * @brief Stably merge two sorted, NULL-terminated chains by their `next` links; `prev` links are left stale
+ * @private
+ *
+ * @param a
+ * @param b
+ * @param comparator
+ * @param offset
+ * @return glthread_t* - the first node of the merged chain
+ */
+glthread_t* __glthread_merge_chains(glthread_t* a, glthread_t* b, int(*comparator)(void*, void*), int offset) {
+	glthread_t dummy;
+	glthread_t* last = &dummy;
+
+	while (a && b) {
+		// take from `b` only if it strictly precedes, such that equal nodes keep their order
+		if (comparator(GET_DATA_FROM_OFFSET(b, offset), GET_DATA_FROM_OFFSET(a, offset)) == -1) {
+			last->next = b;
+			b = b->next;
+		} else {
+			last->next = a;
+			a = a->next;
+		}
+
+		last = last->next;
+	}
+
+	last->next = a ? a : b;
+
+	return dummy.next;
+}
+
+/**
+ * @brief Hang `first` off of `head` and restore the `prev` links of the chain
+ * @private
+ *
+ * @param head
+ * @param first
+ * @return glthread_t* - the last node of the chain, or NULL if it is empty
+ */
+glthread_t* __glthread_relink(glthread_t* head, glthread_t* first) {
+	glthread_t* prev = head;
+
+	head->next = first;
+
+	for (glthread_t* curr = first; curr; curr = curr->next) {
+		curr->prev = prev;
+		prev = curr;
+	}
+
+	return prev == head ? NULL : prev;
+}
+
+/**
+ * @brief Sort the chain hanging off `head`
+ * @private
+ *
+ * Bottom-up: each node is carried into bins of sorted runs of 2^i nodes, as with binary addition
+ *
+ * @param head
+ * @param comparator
+ * @param offset
+ * @return glthread_t* - the last node of the sorted chain, or NULL if it is empty
+ */
+glthread_t* __glthread_sort(glthread_t* head, int(*comparator)(void*, void*), int offset) {
+	glthread_t* bins[GLTHREAD_SORT_BINS] = { NULL };
+	glthread_t* curr = head->next;
+
+	while (curr) {
+		glthread_t* run = curr;
+		int i = 0;
+
+		curr = curr->next;
+		run->next = NULL;
+
+		// older runs hold earlier nodes, and so are always the left side of the merge
+		for (; bins[i]; i++) {
+			run = __glthread_merge_chains(bins[i], run, comparator, offset);
+			bins[i] = NULL;
+		}
+
+		bins[i] = run;
+	}
+
+	glthread_t* sorted = NULL;
+
+	for (int i = 0; i < GLTHREAD_SORT_BINS; i++) {
+		if (bins[i]) sorted = __glthread_merge_chains(bins[i], sorted, comparator, offset);
+	}
+
+	return __glthread_relink(head, sorted);
+}
+
+/**
+ * @brief Sort the glthread chain in place; stable, O(n log n), and allocation-free
+ *
+ * @param head
+ * @param comparator
+ * @param offset
+ */
+void glthread_sort(glthread_t* head, int(*comparator)(void*, void*), int offset) {
+	__glthread_sort(head, comparator, offset);
+}
+
+/**
+ * @brief Merge the sorted chain hanging off `other` into the sorted chain hanging off `head`, leaving `other` empty
+ *
+ * Where nodes compare equal, those of `head` come first
+ *
+ * @param head
+ * @param other
+ * @param comparator
+ * @param offset
+ */
+void glthread_merge(glthread_t* head, glthread_t* other, int(*comparator)(void*, void*), int offset) {
+	if (head == other) return;
+
+	__glthread_relink(head, __glthread_merge_chains(head->next, other->next, comparator, offset));
+
+	other->next = NULL;
+}
+
+/**
+ * @brief Unlink every node for which `!!predicate(data, ctx) == match`, in a single traversal
+ * @private
+ *
+ * @param head
+ * @param predicate
+ * @param ctx
+ * @param offset
+ * @param match
+ * @param last - set to the last remaining node, or NULL if none remain
+ * @param removed - incremented per unlinked node
+ * @return glthread_t* - the first unlinked node
+ */
+glthread_t* __glthread_unlink_where(
+	glthread_t* head,
+	int(*predicate)(void*, void*),
+	void* ctx,
+	int offset,
+	int match,
+	glthread_t** last,
+	unsigned int* removed
+) {
+	glthread_t chain = { 0 };
+	glthread_t* chain_tail = &chain;
+	glthread_t* prev = head;
+	glthread_t* curr = head->next;
+
+	while (curr) {
+		glthread_t* next = curr->next;
+
+		if (!!predicate(GET_DATA_FROM_OFFSET(curr, offset), ctx) == match) {
+			prev->next = next;
+			if (next) next->prev = prev;
+
+			curr->prev = chain_tail == &chain ? NULL : chain_tail;
+			curr->next = NULL;
+			chain_tail->next = curr;
+			chain_tail = curr;
+
+			(*removed)++;
+		} else {
+			prev = curr;
+		}
+
+		curr = next;
+	}
+
+	*last = prev == head ? NULL : prev;
+
+	return chain.next;
+}
+
+/**
+ * @brief Pass each struct of a detached chain to `dispose`
+ * @private
+ *
+ * @param chain
+ * @param dispose
+ * @param ctx
+ * @param offset
+ */
+void __glthread_dispose_chain(glthread_t* chain, void(*dispose)(void*, void*), void* ctx, int offset) {
+	while (chain && dispose) {
+		glthread_t* next = chain->next;
+
+		dispose(GET_DATA_FROM_OFFSET(chain, offset), ctx);
+		chain = next;
+	}
+}
+
+/**
+ * @brief Unlink, in a single traversal, every node for which `predicate` returns non-zero
+ *
+ * `predicate` is invoked with the struct at `offset` behind each node, and `ctx`. The removed nodes keep their
+ * relative order and are handed back as a chain whose first node's prev and last node's next are NULL
+ *
+ * @param head
+ * @param predicate
+ * @param ctx
+ * @param offset
+ * @return glthread_t* - the first removed node, or NULL if none matched
+ */
+glthread_t* glthread_remove_if(glthread_t* head, int(*predicate)(void*, void*), void* ctx, int offset) {
+	glthread_t* last;
+	unsigned int removed = 0;
+
+	return __glthread_unlink_where(head, predicate, ctx, offset, 1, &last, &removed);
+}
+
+/**
+ * @brief Keep only the nodes for which `predicate` returns non-zero, in a single traversal
+ *
+ * Each removed node is unlinked and its struct then passed to `dispose`, if provided, with `ctx`, e.g. to free it
+ *
+ * @param head
+ * @param predicate
+ * @param dispose
+ * @param ctx
+ * @param offset
+ * @return unsigned int - the number of nodes removed
+ */
+unsigned int glthread_retain(
+	glthread_t* head,
+	int(*predicate)(void*, void*),
+	void(*dispose)(void*, void*),
+	void* ctx,
+	int offset
+) {
+	glthread_t* last;
+	unsigned int removed = 0;
+	glthread_t* chain = __glthread_unlink_where(head, predicate, ctx, offset, 0, &last, &removed);
+
+	__glthread_dispose_chain(chain, dispose, ctx, offset);
+
+	return removed;
+}
+
+/**
+ * @brief Initialize a new, empty glthread list
+ *
+ * @param list
+ */
+void glthread_list_init(glthread_list_t* list) {
+	glthread_init(&list->head);
+	list->tail = NULL;
+	list->size = 0;
+}
+
+/**
+ * @brief Push new glthread node to tail in constant time
+ *
+ * @param list
+ * @param next
+ */
+void glthread_list_push(glthread_list_t* list, glthread_t* next) {
+	glthread_init(next);
+
+	glthread_insert_after(list->tail ? list->tail : &list->head, next);
+
+	list->tail = next;
+	list->size++;
+}
+
+/**
+ * @brief Push new glthread node to head in constant time
+ *
+ * @param list
+ * @param next
+ */
+void glthread_list_push_front(glthread_list_t* list, glthread_t* next) {
+	glthread_init(next);
+
+	glthread_insert_after(&list->head, next);
+
+	if (!list->tail) list->tail = next;
+	list->size++;
+}
+
+/**
+ * @brief Remove the tail node in constant time
+ *
+ * @param list
+ * @return glthread_t* - the removed node, or NULL if the list is empty
+ */
+glthread_t* glthread_list_pop(glthread_list_t* list) {
+	glthread_t* tmp = list->tail;
+
+	if (!tmp) return NULL;
+
+	glthread_list_remove(list, tmp);
+
+	return tmp;
+}
+
+/**
+ * @brief Dequeue the head node in constant time
+ *
+ * @param list
+ * @return glthread_t* - the removed node, or NULL if the list is empty
+ */
+glthread_t* glthread_list_dequeue_first(glthread_list_t* list) {
+	glthread_t* tmp = list->head.next;
+
+	if (!tmp) return NULL;
+
+	glthread_list_remove(list, tmp);
+
+	return tmp;
+}
+
+/**
+ * @brief Insert a new glthread node after the given mark, where mark is a node of the list
+ *
+ * @param list
+ * @param mark
+ * @param next
+ */
+void glthread_list_insert_after(glthread_list_t* list, glthread_t* mark, glthread_t* next) {
+	glthread_init(next);
+
+	glthread_insert_after(mark, next);
+
+	if (mark == list->tail) list->tail = next;
+	list->size++;
+}
+
+/**
+ * @brief Insert a new glthread node before the given mark, where mark is a node of the list
+ *
+ * @param list
+ * @param mark
+ * @param next
+ */
+void glthread_list_insert_before(glthread_list_t* list, glthread_t* mark, glthread_t* next) {
+	glthread_init(next);
+
+	// every node of the list has a predecessor, if only the sentinel head
+	glthread_insert_after(mark->prev, next);
+
+	list->size++;
+}
+
+/**
+ * @brief Remove a given glthread node from the list
+ *
+ * @param list
+ * @param mark
+ */
+void glthread_list_remove(glthread_list_t* list, glthread_t* mark) {
+	if (mark == list->tail) {
+		list->tail = mark->prev == &list->head ? NULL : mark->prev;
+	}
+
+	glthread_remove(mark);
+
+	list->size--;
+}
+
+/**
+ * @brief Delete all nodes in a given glthread list
+ *
+ * @param list
+ */
+void glthread_list_del_list(glthread_list_t* list) {
+	glthread_del_list(&list->head);
+
+	list->tail = NULL;
+	list->size = 0;
+}
+
+/**
+ * @brief Get current size of glthread list in constant time
+ *
+ * @param list
+ * @return unsigned int
+ */
+unsigned int glthread_list_size(glthread_list_t* list) {
+	return list->size;
+}
+
+/**
+ * @brief Sort the glthread list in place; see glthread_sort
+ *
+ * @param list
+ * @param comparator
+ * @param offset
+ */
+void glthread_list_sort(glthread_list_t* list, int(*comparator)(void*, void*), int offset) {
+	list->tail = __glthread_sort(&list->head, comparator, offset);
+}
+
+/**
+ * @brief Merge the sorted list `other` into the sorted list `list`, leaving `other` empty; see glthread_merge
+ *
+ * @param list
+ * @param other
+ * @param comparator
+ * @param offset
+ */
+void glthread_list_merge(glthread_list_t* list, glthread_list_t* other, int(*comparator)(void*, void*), int offset) {
+	if (list == other) return;
+
+	list->tail = __glthread_relink(&list->head, __glthread_merge_chains(list->head.next, other->head.next, comparator, offset));
+	list->size += other->size;
+
+	glthread_list_init(other);
+}
+
+/**
+ * @brief Unlink, in a single traversal, every node for which `predicate` returns non-zero; see glthread_remove_if
+ *
+ * @param list
+ * @param predicate
+ * @param ctx
+ * @param offset
+ * @return glthread_t* - the first removed node, or NULL if none matched
+ */
+glthread_t* glthread_list_remove_if(glthread_list_t* list, int(*predicate)(void*, void*), void* ctx, int offset) {
+	unsigned int removed = 0;
+	glthread_t* chain = __glthread_unlink_where(&list->head, predicate, ctx, offset, 1, &list->tail, &removed);
+
+	list->size -= removed;
+
+	return chain;
+}
+
+/**
+ * @brief Keep only the nodes for which `predicate` returns non-zero, in a single traversal; see glthread_retain
+ *
+ * @param list
+ * @param predicate
+ * @param dispose
+ * @param ctx
+ * @param offset
+ * @return unsigned int - the number of nodes removed
+ */
+unsigned int glthread_list_retain(
+	glthread_list_t* list,
+	int(*predicate)(void*, void*),
+	void(*dispose)(void*, void*),
+	void* ctx,
+	int offset
+) {
+	unsigned int removed = 0;
+	glthread_t* chain = __glthread_unlink_where(&list->head, predicate, ctx, offset, 0, &list->tail, &removed);
+
+	list->size -= removed;
+	__glthread_dispose_chain(chain, dispose, ctx, offset);
+
+	return removed;
+}
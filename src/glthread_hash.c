@@ -0,0 +1,282 @@
+/**
+ * @file glthread_hash.c
+ * @author Matthew Zito (goldmund@freenode)
+ * @brief Implements an intrusive chained hash table with glthread buckets and incremental resizing
+ * @version 0.1
+ * @date 2021-07-11
+ *
+ * @copyright Copyright (c) 2021 Matthew Zito (goldmund)
+ *
+ */
+
+#include "libcartilage.h"
+
+#include <stdlib.h>
+
+#define GLTHREAD_HASH_MIN_BITS 3
+/* Old buckets migrated per insert or removal; at least 2 ensures a migration completes before the next doubling */
+#define GLTHREAD_HASH_MIGRATE_STEP 2
+/* 2^64 / phi; spreads user hashes, including the identity, across the high bits used for indexing */
+#define GLTHREAD_HASH_MULTIPLIER UINT64_C(0x9E3779B97F4A7C15)
+
+/**
+ * @brief Map a hash to a bucket of a table with 2^bits buckets
+ * @private
+ *
+ * @param hash
+ * @param bits
+ * @return size_t
+ */
+size_t __glthread_hash_index(uint64_t hash, unsigned int bits) {
+	return (hash * GLTHREAD_HASH_MULTIPLIER) >> (64 - bits);
+}
+
+/**
+ * @brief Retrieve the key of the object embedding `glthread`
+ * @private
+ *
+ * @param h
+ * @param glthread
+ * @return void*
+ */
+void* __glthread_hash_key(glthread_hash_t* h, glthread_t* glthread) {
+	return (char*)GET_DATA_FROM_OFFSET(glthread, h->offset) + h->key_offset;
+}
+
+/**
+ * @brief Resolve the bucket for a hash, which is in the old table if it has not yet been migrated
+ * @private
+ *
+ * @param h
+ * @param hash
+ * @return glthread_t*
+ */
+glthread_t* __glthread_hash_bucket(glthread_hash_t* h, uint64_t hash) {
+	if (h->old_buckets) {
+		size_t i = __glthread_hash_index(hash, h->bits - 1);
+
+		if (i >= h->migrated) return &h->old_buckets[i];
+	}
+
+	return &h->buckets[__glthread_hash_index(hash, h->bits)];
+}
+
+/**
+ * @brief Find the glthread of the object with the given key
+ * @private
+ *
+ * @param h
+ * @param key
+ * @return glthread_t* - or NULL if not present
+ */
+glthread_t* __glthread_hash_lookup(glthread_hash_t* h, const void* key) {
+	glthread_t* curr = __glthread_hash_bucket(h, h->hash(key))->next;
+
+	for (; curr; curr = curr->next) {
+		if (h->eq(__glthread_hash_key(h, curr), key)) return curr;
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Rehash up to `n` old buckets into the current table, and free the old table once it is empty
+ * @private
+ *
+ * @param h
+ * @param n
+ */
+void __glthread_hash_migrate(glthread_hash_t* h, size_t n) {
+	size_t old_capacity = (size_t)1 << (h->bits - 1);
+
+	for (; h->old_buckets && n; n--) {
+		glthread_t* curr = h->old_buckets[h->migrated++].next;
+
+		while (curr) {
+			glthread_t* next = curr->next;
+			size_t i = __glthread_hash_index(h->hash(__glthread_hash_key(h, curr)), h->bits);
+
+			glthread_init(curr);
+			glthread_insert_after(&h->buckets[i], curr);
+
+			curr = next;
+		}
+
+		if (h->migrated == old_capacity) {
+			free(h->old_buckets);
+
+			h->old_buckets = NULL;
+			h->migrated = 0;
+		}
+	}
+}
+
+/**
+ * @brief Double the table; the current table becomes the old table, to be migrated incrementally
+ * @private
+ *
+ * @param h
+ * @return int - 0 if success, else -1
+ */
+int __glthread_hash_grow(glthread_hash_t* h) {
+	if (h->old_buckets) __glthread_hash_migrate(h, SIZE_MAX);
+
+	glthread_t* buckets = calloc((size_t)1 << (h->bits + 1), sizeof(glthread_t));
+
+	if (!buckets) return -1;
+
+	h->old_buckets = h->buckets;
+	h->buckets = buckets;
+	h->bits++;
+
+	return 0;
+}
+
+/**
+ * @brief Initialize a new, empty hash table with room for `capacity` objects before it must grow
+ *
+ * @param h
+ * @param capacity
+ * @param hash
+ * @param eq
+ * @param offset - offset of the glthread within the object
+ * @param key_offset - offset of the key within the object
+ * @return int - 0 if success, else -1
+ */
+int glthread_hash_init(
+	glthread_hash_t* h,
+	size_t capacity,
+	uint64_t (*hash)(const void* key),
+	int (*eq)(const void* a, const void* b),
+	int offset,
+	int key_offset
+) {
+	h->bits = GLTHREAD_HASH_MIN_BITS;
+
+	while (((size_t)1 << h->bits) < capacity) h->bits++;
+
+	// zeroed glthreads are initialized glthreads
+	if (!(h->buckets = calloc((size_t)1 << h->bits, sizeof(glthread_t)))) return -1;
+
+	h->old_buckets = NULL;
+	h->migrated = 0;
+	h->size = 0;
+	h->hash = hash;
+	h->eq = eq;
+	h->offset = offset;
+	h->key_offset = key_offset;
+
+	return 0;
+}
+
+/**
+ * @brief Free the table's buckets; the objects are not freed, and their glthreads are left as they were
+ *
+ * @param h
+ */
+void glthread_hash_destroy(glthread_hash_t* h) {
+	free(h->buckets);
+	free(h->old_buckets);
+}
+
+/**
+ * @brief Insert the object embedding `glthread`
+ *
+ * If the table cannot grow, the object is inserted regardless and the table is left to exceed its load factor
+ *
+ * @param h
+ * @param glthread
+ * @return int - 0 if success, or -1 if an object with an equal key is present
+ */
+int glthread_hash_insert(glthread_hash_t* h, glthread_t* glthread) {
+	void* key = __glthread_hash_key(h, glthread);
+
+	if (__glthread_hash_lookup(h, key)) return -1;
+
+	if (h->size >= (size_t)1 << h->bits) __glthread_hash_grow(h);
+
+	glthread_init(glthread);
+	glthread_insert_after(__glthread_hash_bucket(h, h->hash(key)), glthread);
+
+	h->size++;
+
+	__glthread_hash_migrate(h, GLTHREAD_HASH_MIGRATE_STEP);
+
+	return 0;
+}
+
+/**
+ * @brief Find the object with the given key
+ *
+ * @param h
+ * @param key
+ * @return void* - the object, or NULL if not present
+ */
+void* glthread_hash_find(glthread_hash_t* h, const void* key) {
+	glthread_t* glthread = __glthread_hash_lookup(h, key);
+
+	return glthread ? GET_DATA_FROM_OFFSET(glthread, h->offset) : NULL;
+}
+
+/**
+ * @brief Remove the object with the given key
+ *
+ * @param h
+ * @param key
+ * @return void* - the object, or NULL if not present
+ */
+void* glthread_hash_remove(glthread_hash_t* h, const void* key) {
+	glthread_t* glthread = __glthread_hash_lookup(h, key);
+
+	if (!glthread) return NULL;
+
+	glthread_hash_remove_node(h, glthread);
+
+	return GET_DATA_FROM_OFFSET(glthread, h->offset);
+}
+
+/**
+ * @brief Remove the object embedding `glthread`, which must be in the table, without a lookup
+ *
+ * @param h
+ * @param glthread
+ */
+void glthread_hash_remove_node(glthread_hash_t* h, glthread_t* glthread) {
+	glthread_remove(glthread);
+
+	h->size--;
+
+	__glthread_hash_migrate(h, GLTHREAD_HASH_MIGRATE_STEP);
+}
+
+/**
+ * @brief Iterate over the table's objects, in no particular order
+ *
+ * @param h
+ * @param callback
+ */
+void glthread_hash_iterate(glthread_hash_t* h, void (*callback)(void*)) {
+	glthread_t* curr;
+
+	for (size_t i = 0; i < (size_t)1 << h->bits; i++) {
+		ITERATE_GLTHREAD_BEGIN(&h->buckets[i], curr) {
+			callback(GET_DATA_FROM_OFFSET(curr, h->offset));
+		} ITERATE_GLTHREAD_END(&h->buckets[i], curr);
+	}
+
+	for (size_t i = h->migrated; h->old_buckets && i < (size_t)1 << (h->bits - 1); i++) {
+		ITERATE_GLTHREAD_BEGIN(&h->old_buckets[i], curr) {
+			callback(GET_DATA_FROM_OFFSET(curr, h->offset));
+		} ITERATE_GLTHREAD_END(&h->old_buckets[i], curr);
+	}
+}
+
+/**
+ * @brief Get current size of the table
+ *
+ * @param h
+ * @return size_t
+ */
+size_t glthread_hash_size(glthread_hash_t* h) {
+	return h->size;
+}
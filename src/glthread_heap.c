@@ -0,0 +1,225 @@
+/**
+ * @file glthread_heap.c
+ * @author Matthew Zito (goldmund@freenode)
+ * @brief Implements an intrusive pairing heap
+ * @version 0.1
+ * @date 2021-07-11
+ *
+ * @copyright Copyright (c) 2021 Matthew Zito (goldmund)
+ *
+ */
+
+#include "libcartilage.h"
+
+#include <stdlib.h>
+
+/**
+ * @brief Whether node `a` precedes node `b` per the heap's comparator
+ * @private
+ *
+ * @param heap
+ * @param a
+ * @param b
+ * @return int
+ */
+int __glthread_heap_precedes(glthread_heap_t* heap, glthread_heap_node_t* a, glthread_heap_node_t* b) {
+	return heap->comparator(GET_DATA_FROM_OFFSET(a, heap->offset),
+		GET_DATA_FROM_OFFSET(b, heap->offset)) == -1;
+}
+
+/**
+ * @brief Link two root nodes such that the preceding one becomes the parent of the other
+ * @private
+ *
+ * @param heap
+ * @param a
+ * @param b
+ * @return glthread_heap_node_t* - the new root
+ */
+glthread_heap_node_t* __glthread_heap_meld(glthread_heap_t* heap, glthread_heap_node_t* a, glthread_heap_node_t* b) {
+	if (!a) return b;
+	if (!b) return a;
+
+	if (__glthread_heap_precedes(heap, b, a)) {
+		glthread_heap_node_t* tmp = a;
+		a = b;
+		b = tmp;
+	}
+
+	b->prev = a;
+	b->next = a->child;
+	if (a->child) a->child->prev = b;
+	a->child = b;
+
+	a->next = NULL;
+	a->prev = NULL;
+
+	return a;
+}
+
+/**
+ * @brief Combine a list of siblings into a single tree using the two-pass pairing strategy
+ * @private
+ *
+ * @param heap
+ * @param first
+ * @return glthread_heap_node_t* - the new root
+ */
+glthread_heap_node_t* __glthread_heap_merge_pairs(glthread_heap_t* heap, glthread_heap_node_t* first) {
+	glthread_heap_node_t* pairs = NULL;
+
+	// first pass: meld siblings pairwise left to right, stacking the results via next
+	while (first) {
+		glthread_heap_node_t* a = first;
+		glthread_heap_node_t* b = a->next;
+		glthread_heap_node_t* merged;
+
+		if (b) {
+			first = b->next;
+			b->next = NULL;
+			b->prev = NULL;
+		} else {
+			first = NULL;
+		}
+
+		a->next = NULL;
+		a->prev = NULL;
+
+		merged = __glthread_heap_meld(heap, a, b);
+		merged->next = pairs;
+		pairs = merged;
+	}
+
+	// second pass: meld the stacked pairs right to left
+	glthread_heap_node_t* root = NULL;
+
+	while (pairs) {
+		glthread_heap_node_t* next = pairs->next;
+
+		pairs->next = NULL;
+		root = __glthread_heap_meld(heap, root, pairs);
+		pairs = next;
+	}
+
+	return root;
+}
+
+/**
+ * @brief Unlink a non-root node, along with its subtree, from its parent and siblings
+ * @private
+ *
+ * @param node
+ */
+void __glthread_heap_detach(glthread_heap_node_t* node) {
+	if (node->prev->child == node) {
+		node->prev->child = node->next;
+	} else {
+		node->prev->next = node->next;
+	}
+
+	if (node->next) node->next->prev = node->prev;
+
+	node->next = NULL;
+	node->prev = NULL;
+}
+
+/**
+ * @brief Initialize a new, empty heap
+ *
+ * @param heap
+ * @param comparator
+ * @param offset
+ */
+void glthread_heap_init(glthread_heap_t* heap, int(*comparator)(void*, void*), int offset) {
+	heap->root = NULL;
+	heap->size = 0;
+	heap->comparator = comparator;
+	heap->offset = offset;
+}
+
+/**
+ * @brief Insert a node into the heap in constant time
+ *
+ * @param heap
+ * @param node
+ */
+void glthread_heap_insert(glthread_heap_t* heap, glthread_heap_node_t* node) {
+	node->child = NULL;
+	node->next = NULL;
+	node->prev = NULL;
+
+	heap->root = __glthread_heap_meld(heap, heap->root, node);
+	heap->size++;
+}
+
+/**
+ * @brief Returns the first node of the heap without removing it, or NULL if the heap is empty
+ *
+ * @param heap
+ * @return glthread_heap_node_t*
+ */
+glthread_heap_node_t* glthread_heap_peek(glthread_heap_t* heap) {
+	return heap->root;
+}
+
+/**
+ * @brief Remove and return the first node of the heap in amortized O(log n), or NULL if the heap is empty
+ *
+ * @param heap
+ * @return glthread_heap_node_t*
+ */
+glthread_heap_node_t* glthread_heap_extract(glthread_heap_t* heap) {
+	glthread_heap_node_t* root = heap->root;
+
+	if (!root) return NULL;
+
+	heap->root = __glthread_heap_merge_pairs(heap, root->child);
+	heap->size--;
+
+	root->child = NULL;
+
+	return root;
+}
+
+/**
+ * @brief Restore heap order after the data of `node` was changed such that it moved toward the front
+ *
+ * @param heap
+ * @param node
+ */
+void glthread_heap_decrease_key(glthread_heap_t* heap, glthread_heap_node_t* node) {
+	if (node == heap->root) return;
+
+	__glthread_heap_detach(node);
+	heap->root = __glthread_heap_meld(heap, heap->root, node);
+}
+
+/**
+ * @brief Remove an arbitrary node from the heap in amortized O(log n)
+ *
+ * @param heap
+ * @param node
+ */
+void glthread_heap_remove(glthread_heap_t* heap, glthread_heap_node_t* node) {
+	if (node == heap->root) {
+		glthread_heap_extract(heap);
+		return;
+	}
+
+	__glthread_heap_detach(node);
+
+	heap->root = __glthread_heap_meld(heap, heap->root, __glthread_heap_merge_pairs(heap, node->child));
+	heap->size--;
+
+	node->child = NULL;
+}
+
+/**
+ * @brief Get current size of heap
+ *
+ * @param heap
+ * @return unsigned int
+ */
+unsigned int glthread_heap_size(glthread_heap_t* heap) {
+	return heap->size;
+}
@@ -0,0 +1,104 @@
+#ifndef LIBCARTILAGE_GLTHREAD_TYPED_H
+#define LIBCARTILAGE_GLTHREAD_TYPED_H
+
+#include "libcartilage.h"
+
+/*****************************
+ *	Typed GlThread
+ *****************************/
+
+/**
+ * @brief Generate type-safe accessors and ordered operations for glthread chains of `T` linked through `member`
+ *
+ * The counterparts of glthread_priority_insert and glthread_merge, with the offset of `member` fixed at compile time
+ * via offsetof and the ordering expanded in place of an indirect comparator call. `precedes` is an expression over the
+ * `const T*` parameters `a` and `b` which is true if a sorts strictly before b, e.g. `a->key < b->key`; wrap it in
+ * parentheses if it contains a top-level comma. The chains are those hanging off a sentinel `head`, as elsewhere
+ *
+ * Emits `static inline` functions prefixed `name##_`
+ *
+ * @param name - prefix of the generated functions
+ * @param T - the struct type
+ * @param member - the glthread_t member of `T`
+ * @param precedes - the ordering expression
+ */
+#define GLTHREAD_DEFINE(name, T, member, precedes)                                                    \
+	/* The struct embedding `glthread`, or NULL if `glthread` is NULL */                                \
+	static inline T* name##_from_glthread(glthread_t* glthread) {                                       \
+		return glthread ? (T*)((char*)glthread - offsetof(T, member)) : NULL;                             \
+	}                                                                                                   \
+	                                                                                                    \
+	/* The first struct of the chain hanging off `head`, or NULL if it is empty */                      \
+	static inline T* name##_first(glthread_t* head) {                                                   \
+		return name##_from_glthread(head->next);                                                          \
+	}                                                                                                   \
+	                                                                                                    \
+	/* The struct following `item` in its chain, or NULL if `item` is the last */                       \
+	static inline T* name##_next(T* item) {                                                             \
+		return name##_from_glthread(item->member.next);                                                   \
+	}                                                                                                   \
+	                                                                                                    \
+	/* Whether `a` sorts strictly before `b` */                                                         \
+	static inline int name##_precedes(const T* a, const T* b) {                                         \
+		return (precedes);                                                                                \
+	}                                                                                                   \
+	                                                                                                    \
+	/* Insert `item` before the first struct it precedes, i.e. after any that compare equal */           \
+	static inline void name##_priority_insert(glthread_t* head, T* item) {                              \
+		glthread_t* glthread = &item->member;                                                             \
+		glthread_t* prev = head;                                                                          \
+		                                                                                                  \
+		while (prev->next && !name##_precedes(item, name##_from_glthread(prev->next))) prev = prev->next; \
+		                                                                                                  \
+		glthread->prev = prev;                                                                            \
+		glthread->next = prev->next;                                                                      \
+		                                                                                                  \
+		if (prev->next) prev->next->prev = glthread;                                                      \
+		                                                                                                  \
+		prev->next = glthread;                                                                            \
+	}                                                                                                   \
+	                                                                                                    \
+	/* The first struct of the sorted chain which compares equal to `key`, or NULL; stops at the first */ \
+	/* struct that `key` precedes */                                                                    \
+	static inline T* name##_find(glthread_t* head, const T* key) {                                      \
+		for (glthread_t* curr = head->next; curr; curr = curr->next) {                                    \
+			T* item = name##_from_glthread(curr);                                                           \
+			                                                                                                \
+			if (name##_precedes(key, item)) return NULL;                                                    \
+			if (!name##_precedes(item, key)) return item;                                                   \
+		}                                                                                                 \
+		                                                                                                  \
+		return NULL;                                                                                      \
+	}                                                                                                   \
+	                                                                                                    \
+	/* Merge the sorted chain hanging off `other` into that hanging off `head`, leaving `other` empty; */ \
+	/* where structs compare equal, those of `head` come first */                                       \
+	static inline void name##_merge(glthread_t* head, glthread_t* other) {                              \
+		if (head == other) return;                                                                        \
+		                                                                                                  \
+		glthread_t* a = head->next;                                                                       \
+		glthread_t* b = other->next;                                                                      \
+		glthread_t* last = head;                                                                          \
+		                                                                                                  \
+		while (a && b) {                                                                                  \
+			if (name##_precedes(name##_from_glthread(b), name##_from_glthread(a))) {                        \
+				last->next = b;                                                                               \
+				b->prev = last;                                                                               \
+				b = b->next;                                                                                  \
+			} else {                                                                                        \
+				last->next = a;                                                                               \
+				a->prev = last;                                                                               \
+				a = a->next;                                                                                  \
+			}                                                                                               \
+			                                                                                                \
+			last = last->next;                                                                              \
+		}                                                                                                 \
+		                                                                                                  \
+		last->next = a ? a : b;                                                                           \
+		                                                                                                  \
+		if (last->next) last->next->prev = last;                                                          \
+		                                                                                                  \
+		other->next = NULL;                                                                               \
+	}
+
+#endif /* LIBCARTILAGE_GLTHREAD_TYPED_H */
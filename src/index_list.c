@@ -0,0 +1,499 @@
+/**
+ * @file index_list.c
+ * @author Matthew Zito (goldmund@freenode)
+ * @brief Implements an array-backed Circular Singly Linked List addressed by 32-bit indices
+ * @version 0.1
+ * @date 2021-07-11
+ *
+ * @copyright Copyright (c) 2021 Matthew Zito (goldmund)
+ *
+ */
+
+#include "libcartilage.h"
+
+#include <stdlib.h>
+
+#define ILIST_MIN_CAPACITY 16
+
+static const IndexHandle_t ILIST_NULL_HANDLE = { ILIST_NIL, 0 };
+
+/**
+ * @brief Build the handle for the live node at `index`
+ * @private
+ *
+ * @param ll
+ * @param index
+ * @return IndexHandle_t
+ */
+IndexHandle_t __ilist_handle(IndexList_t* ll, uint32_t index) {
+	IndexHandle_t h = { index, ll->nodes[index].generation };
+
+	return h;
+}
+
+/**
+ * @brief Take a node from the free-index stack, or from the untouched tail of the array, growing it if need be
+ * @private
+ *
+ * @param ll
+ * @param value
+ * @return uint32_t - the node's index, or ILIST_NIL if the array could not grow
+ */
+uint32_t __ilist_alloc_node(IndexList_t* ll, void* value) {
+	uint32_t index = ll->free_top;
+
+	if (index != ILIST_NIL) {
+		ll->free_top = ll->nodes[index].next;
+	} else {
+		if (ll->used == ll->capacity) {
+			if (ll->capacity > (ILIST_NIL - 1) / 2) return ILIST_NIL;
+
+			uint32_t capacity = ll->capacity * 2;
+			IndexNode_t* nodes = realloc(ll->nodes, capacity * sizeof(IndexNode_t));
+
+			if (!nodes) return ILIST_NIL;
+
+			ll->nodes = nodes;
+			ll->capacity = capacity;
+		}
+
+		index = ll->used++;
+		ll->nodes[index].generation = 0;
+	}
+
+	IndexNode_t* n = &ll->nodes[index];
+
+	n->data = value;
+	n->next = ILIST_NIL;
+	n->generation++;
+
+	return index;
+}
+
+/**
+ * @brief Invalidate outstanding handles to the node at `index` and push it onto the free-index stack
+ * @private
+ *
+ * @param ll
+ * @param index
+ */
+void __ilist_free_node(IndexList_t* ll, uint32_t index) {
+	IndexNode_t* n = &ll->nodes[index];
+
+	n->generation++;
+	n->next = ll->free_top;
+	ll->free_top = index;
+}
+
+/**
+ * @brief Bootstrap a new head node
+ * @private
+ *
+ * @param ll
+ * @param index
+ */
+void __ilist_new_head(IndexList_t* ll, uint32_t index) {
+	ll->head = index;
+	ll->tail = index;
+	ll->nodes[index].next = index;
+
+	ll->size++;
+}
+
+/**
+ * @brief Find the index of the node prior to the given target
+ * @private
+ *
+ * The node before the head is the tail, which is resolved in constant time;
+ * any other target requires a walk from the head
+ *
+ * @param ll
+ * @param target
+ * @return uint32_t
+ */
+uint32_t __ilist_find_node_before(IndexList_t* ll, uint32_t target) {
+	if (target == ll->head) return ll->tail;
+
+	uint32_t tmp = ll->head;
+
+	while (ll->nodes[tmp].next != target) tmp = ll->nodes[tmp].next;
+
+	return tmp;
+}
+
+/**
+ * @brief Link the detached node at `index` after `at`, where `at` must be a member of the list
+ * @private
+ *
+ * @param ll
+ * @param index
+ * @param at
+ */
+void __ilist_link_after(IndexList_t* ll, uint32_t index, uint32_t at) {
+	ll->nodes[index].next = ll->nodes[at].next;
+	ll->nodes[at].next = index;
+
+	if (at == ll->tail) ll->tail = index;
+}
+
+/**
+ * @brief Move given node after `at`, where `node` and `at` must be a member of the list
+ * @private
+ *
+ * @param ll
+ * @param node
+ * @param at
+ */
+void __ilist_move(IndexList_t* ll, uint32_t node, uint32_t at) {
+	uint32_t tmp = __ilist_find_node_before(ll, node);
+
+	if (node == ll->head) ll->head = ll->nodes[node].next;
+	if (node == ll->tail) ll->tail = tmp;
+
+	ll->nodes[tmp].next = ll->nodes[node].next;
+
+	__ilist_link_after(ll, node, at);
+}
+
+/**
+ * @brief Instantiate an empty index list with room for `capacity` nodes before it must grow
+ *
+ * @param capacity
+ * @return IndexList_t*
+ */
+IndexList_t* ilist_make_list(uint32_t capacity) {
+	IndexList_t* ll = malloc(sizeof(IndexList_t));
+
+	if (!ll) return NULL;
+
+	if (capacity < ILIST_MIN_CAPACITY) capacity = ILIST_MIN_CAPACITY;
+
+	ll->nodes = malloc(capacity * sizeof(IndexNode_t));
+
+	if (!ll->nodes) {
+		free(ll);
+		return NULL;
+	}
+
+	ll->capacity = capacity;
+	ll->used = 0;
+	ll->free_top = ILIST_NIL;
+	ll->head = ILIST_NIL;
+	ll->tail = ILIST_NIL;
+	ll->size = 0;
+
+	return ll;
+}
+
+/**
+ * @brief Free the node array and the list itself; node data is not freed
+ *
+ * @param ll
+ */
+void ilist_destroy_list(IndexList_t* ll) {
+	free(ll->nodes);
+	free(ll);
+}
+
+/**
+ * @brief Returns 1 if `node` refers to a node currently in the list, else 0
+ *
+ * @param ll
+ * @param node
+ * @return int
+ */
+int ilist_is_valid(IndexList_t* ll, IndexHandle_t node) {
+	return node.index < ll->used
+		&& (node.generation & 1)
+		&& ll->nodes[node.index].generation == node.generation;
+}
+
+/**
+ * @brief Returns the data of the node referred to by `node`, or NULL if the handle is stale
+ *
+ * @param ll
+ * @param node
+ * @return void*
+ */
+void* ilist_get(IndexList_t* ll, IndexHandle_t node) {
+	if (!ilist_is_valid(ll, node)) return NULL;
+
+	return ll->nodes[node.index].data;
+}
+
+/**
+ * @brief Push a new node with value `value` to the back of the list
+ *
+ * @param ll
+ * @param value
+ * @return IndexHandle_t - the new node, or a handle with index ILIST_NIL if the node array could not grow
+ */
+IndexHandle_t ilist_push_back(IndexList_t* ll, void* value) {
+	uint32_t index = __ilist_alloc_node(ll, value);
+
+	if (index == ILIST_NIL) return ILIST_NULL_HANDLE;
+
+	if (ll->head == ILIST_NIL) {
+		__ilist_new_head(ll, index);
+	} else {
+		__ilist_link_after(ll, index, ll->tail);
+		ll->size++;
+	}
+
+	return __ilist_handle(ll, index);
+}
+
+/**
+ * @brief Push a new node with value `value` to the front of the list
+ *
+ * @param ll
+ * @param value
+ * @return IndexHandle_t - the new node, or a handle with index ILIST_NIL if the node array could not grow
+ */
+IndexHandle_t ilist_push_front(IndexList_t* ll, void* value) {
+	uint32_t index = __ilist_alloc_node(ll, value);
+
+	if (index == ILIST_NIL) return ILIST_NULL_HANDLE;
+
+	if (ll->head == ILIST_NIL) {
+		__ilist_new_head(ll, index);
+	} else {
+		ll->nodes[index].next = ll->head;
+		ll->nodes[ll->tail].next = index;
+		ll->head = index;
+		ll->size++;
+	}
+
+	return __ilist_handle(ll, index);
+}
+
+/**
+ * @brief Iterate over the list and invoke `callback` with each node's data
+ *
+ * @param ll
+ * @param callback
+ */
+void ilist_iterate(IndexList_t* ll, void (*callback)(void*)) {
+	uint32_t n = ll->head;
+
+	for (uint32_t i = ll->size; i > 0; i--) {
+		IndexNode_t* node = &ll->nodes[n];
+
+		n = node->next;
+		callback(node->data);
+	}
+}
+
+/**
+ * @brief Returns the next list node, if extant; else, a handle with index ILIST_NIL
+ *
+ * @param ll
+ * @param node
+ * @return IndexHandle_t
+ */
+IndexHandle_t ilist_next(IndexList_t* ll, IndexHandle_t node) {
+	if (!ilist_is_valid(ll, node)) return ILIST_NULL_HANDLE;
+
+	return __ilist_handle(ll, ll->nodes[node.index].next);
+}
+
+/**
+ * @brief Returns the previous list node, if extant; else, a handle with index ILIST_NIL
+ *
+ * @param ll
+ * @param node
+ * @return IndexHandle_t
+ */
+IndexHandle_t ilist_prev(IndexList_t* ll, IndexHandle_t node) {
+	if (!ilist_is_valid(ll, node)) return ILIST_NULL_HANDLE;
+
+	return __ilist_handle(ll, __ilist_find_node_before(ll, node.index));
+}
+
+/**
+ * @brief Remove a given node from the list, invalidating its handle
+ *
+ * @param ll
+ * @param node
+ * @return void* - the node's data, or NULL if the handle is stale
+ */
+void* ilist_remove_node(IndexList_t* ll, IndexHandle_t node) {
+	if (!ilist_is_valid(ll, node)) return NULL;
+
+	uint32_t index = node.index;
+
+	if (ll->size == 1) {
+		ll->head = ILIST_NIL;
+		ll->tail = ILIST_NIL;
+	} else {
+		uint32_t tmp = __ilist_find_node_before(ll, index);
+
+		ll->nodes[tmp].next = ll->nodes[index].next;
+
+		if (index == ll->head) ll->head = ll->nodes[index].next;
+		if (index == ll->tail) ll->tail = tmp;
+	}
+
+	void* data = ll->nodes[index].data;
+
+	__ilist_free_node(ll, index);
+	ll->size--;
+
+	return data;
+}
+
+/**
+ * @brief Remove the last node from the list
+ *
+ * Unlinking the tail requires its predecessor, so this walks the list once
+ *
+ * @param ll
+ * @return void* - the node's data, or NULL if the list is empty
+ */
+void* ilist_pop(IndexList_t* ll) {
+	if (ll->head == ILIST_NIL) return NULL;
+
+	return ilist_remove_node(ll, __ilist_handle(ll, ll->tail));
+}
+
+/**
+ * @brief Remove the first node from the list in constant time
+ *
+ * @param ll
+ * @return void* - the node's data, or NULL if the list is empty
+ */
+void* ilist_pop_front(IndexList_t* ll) {
+	if (ll->head == ILIST_NIL) return NULL;
+
+	return ilist_remove_node(ll, __ilist_handle(ll, ll->head));
+}
+
+/**
+ * @brief Insert a new node with value `value` immediately after `mark`
+ *
+ * If `mark` is stale, the list is not modified
+ *
+ * @param ll
+ * @param value
+ * @param mark
+ * @return IndexHandle_t - the new node, or a handle with index ILIST_NIL
+ */
+IndexHandle_t ilist_insert_after(IndexList_t* ll, void* value, IndexHandle_t mark) {
+	if (!ilist_is_valid(ll, mark)) return ILIST_NULL_HANDLE;
+
+	uint32_t index = __ilist_alloc_node(ll, value);
+
+	if (index == ILIST_NIL) return ILIST_NULL_HANDLE;
+
+	__ilist_link_after(ll, index, mark.index);
+	ll->size++;
+
+	return __ilist_handle(ll, index);
+}
+
+/**
+ * @brief Insert a new node with value `value` immediately before `mark`
+ *
+ * If `mark` is stale, the list is not modified
+ *
+ * @param ll
+ * @param value
+ * @param mark
+ * @return IndexHandle_t - the new node, or a handle with index ILIST_NIL
+ */
+IndexHandle_t ilist_insert_before(IndexList_t* ll, void* value, IndexHandle_t mark) {
+	if (!ilist_is_valid(ll, mark)) return ILIST_NULL_HANDLE;
+
+	return ilist_insert_after(ll, value, __ilist_handle(ll, __ilist_find_node_before(ll, mark.index)));
+}
+
+/**
+ * @brief Move a given node to its new position before `mark`
+ *
+ * If either handle is stale; node == mark; or node.next == mark, the list is not modified
+ *
+ * @param ll
+ * @param node
+ * @param mark
+ * @return int - 0 if success, else -1
+ */
+int ilist_move_before(IndexList_t* ll, IndexHandle_t node, IndexHandle_t mark) {
+	if (!ilist_is_valid(ll, node) || !ilist_is_valid(ll, mark)) return -1;
+
+	if (node.index == mark.index || ll->nodes[node.index].next == mark.index) return -1;
+
+	__ilist_move(ll, node.index, __ilist_find_node_before(ll, mark.index));
+	return 0;
+}
+
+/**
+ * @brief Move a given node to its new position after `mark`
+ *
+ * If either handle is stale; node == mark; or mark.next == node, the list is not modified
+ *
+ * @param ll
+ * @param node
+ * @param mark
+ * @return int - 0 if success, else -1
+ */
+int ilist_move_after(IndexList_t* ll, IndexHandle_t node, IndexHandle_t mark) {
+	if (!ilist_is_valid(ll, node) || !ilist_is_valid(ll, mark)) return -1;
+
+	if (node.index == mark.index || ll->nodes[mark.index].next == node.index) return -1;
+
+	__ilist_move(ll, node.index, mark.index);
+	return 0;
+}
+
+/**
+ * @brief Insert a copy of another list at the back of the caller list
+ *
+ * The lists may be the same, but must not be NULL
+ *
+ * @param ll
+ * @param other
+ * @return IndexList_t*
+ */
+IndexList_t* ilist_push_back_list(IndexList_t* ll, IndexList_t* other) {
+	if (!other || !ll) return NULL;
+
+	uint32_t n = other->head;
+
+	/* Walk by index; pushing may reallocate `other->nodes` when the lists are the same */
+	for (uint32_t i = other->size; i > 0; i--) {
+		uint32_t next = other->nodes[n].next;
+
+		ilist_push_back(ll, other->nodes[n].data);
+		n = next;
+	}
+
+	return ll;
+}
+
+/**
+ * @brief Insert a copy of another list at the front of the caller list
+ *
+ * The lists may be the same, but must not be NULL
+ *
+ * @param ll
+ * @param other
+ * @return IndexList_t*
+ */
+IndexList_t* ilist_push_front_list(IndexList_t* ll, IndexList_t* other) {
+	if (!other || !ll) return NULL;
+
+	if (!other->size) return ll;
+
+	uint32_t n = other->head;
+	uint32_t size = other->size;
+
+	/* Copies are chained after the new head; the originals (and thus the walk over `other`) are never relinked */
+	IndexHandle_t last = ilist_push_front(ll, other->nodes[n].data);
+
+	for (uint32_t i = size - 1; i > 0; i--) {
+		n = other->nodes[n].next;
+		last = ilist_insert_after(ll, other->nodes[n].data, last);
+	}
+
+	return ll;
+}
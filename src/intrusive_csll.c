@@ -0,0 +1,324 @@
+/**
+ * @file intrusive_csll.c
+ * @author Matthew Zito (goldmund@freenode)
+ * @brief Implements an intrusive Circular Singly Linked List
+ * @version 0.1
+ * @date 2021-07-11
+ *
+ * @copyright Copyright (c) 2021 Matthew Zito (goldmund)
+ *
+ */
+
+#include "libcartilage.h"
+
+#include <stdlib.h>
+
+/**
+ * @brief Bootstrap a new head node
+ * @private
+ *
+ * @param ll
+ * @param node
+ * @return icsll_node_t*
+ */
+icsll_node_t* __icsll_new_head(icsll_t* ll, icsll_node_t* node) {
+	ll->head = node;
+	ll->tail = node;
+	node->next = node;
+
+	node->list = ll;
+	ll->size++;
+	return node;
+}
+
+/**
+ * @brief Find the node prior to the given target, which must be a member of the list
+ * @private
+ *
+ * The node before the head is the tail, which is resolved in constant time;
+ * any other target requires a walk from the head
+ *
+ * @param ll
+ * @param target
+ * @return icsll_node_t*
+ */
+icsll_node_t* __icsll_find_node_before(icsll_t* ll, icsll_node_t* target) {
+	if (target == ll->head) return ll->tail;
+
+	icsll_node_t* tmp = ll->head;
+
+	while (tmp->next != target) tmp = tmp->next;
+
+	return tmp;
+}
+
+/**
+ * @brief Move given node after `at`, where `node` and `at` must be a member of the list
+ * @private
+ *
+ * @param ll
+ * @param node
+ * @param at
+ * @return icsll_node_t*
+ */
+icsll_node_t* __icsll_move(icsll_t* ll, icsll_node_t* node, icsll_node_t* at) {
+	icsll_node_t* tmp = __icsll_find_node_before(ll, node);
+
+	if (node == ll->head) ll->head = node->next;
+	if (node == ll->tail) ll->tail = tmp;
+
+	tmp->next = node->next;
+	node->next = at->next;
+	at->next = node;
+
+	if (at == ll->tail) ll->tail = node;
+
+	return node;
+}
+
+/**
+ * @brief Initialize an empty intrusive list whose links live at `offset` within each element
+ *
+ * @param ll
+ * @param offset
+ */
+void icsll_init(icsll_t* ll, int offset) {
+	ll->head = NULL;
+	ll->tail = NULL;
+	ll->size = 0;
+	ll->offset = offset;
+}
+
+/**
+ * @brief Initialize a detached link; a link must be detached before it is inserted
+ *
+ * @param node
+ */
+void icsll_node_init(icsll_node_t* node) {
+	node->next = NULL;
+	node->list = NULL;
+}
+
+/**
+ * @brief Push `node` to the back of the list
+ *
+ * @param ll
+ * @param node
+ * @return icsll_node_t* - the node, or NULL if it already belongs to a list
+ */
+icsll_node_t* icsll_push_back(icsll_t* ll, icsll_node_t* node) {
+	if (!node || node->list) return NULL;
+
+	if (!ll->head) return __icsll_new_head(ll, node);
+
+	ll->tail->next = node;
+	node->next = ll->head;
+	ll->tail = node;
+
+	node->list = ll;
+	ll->size++;
+
+	return node;
+}
+
+/**
+ * @brief Push `node` to the front of the list
+ *
+ * @param ll
+ * @param node
+ * @return icsll_node_t* - the node, or NULL if it already belongs to a list
+ */
+icsll_node_t* icsll_push_front(icsll_t* ll, icsll_node_t* node) {
+	if (!node || node->list) return NULL;
+
+	if (!ll->head) return __icsll_new_head(ll, node);
+
+	node->next = ll->head;
+	ll->head = node;
+	ll->tail->next = node;
+
+	node->list = ll;
+	ll->size++;
+
+	return node;
+}
+
+/**
+ * @brief Iterate over the list and invoke `callback` with each element (i.e. the struct containing each link)
+ *
+ * @param ll
+ * @param callback
+ */
+void icsll_iterate(icsll_t* ll, void (*callback)(void*)) {
+	icsll_node_t* n = ll->head;
+
+	/* `next` is read before the callback so that the callback may free the element */
+	for (uint32_t i = ll->size; i > 0; i--) {
+		icsll_node_t* next = n->next;
+
+		callback(GET_DATA_FROM_OFFSET(n, ll->offset));
+		n = next;
+	}
+}
+
+/**
+ * @brief Returns the next list node, if extant; else, NULL
+ *
+ * @param ll
+ * @param node
+ * @return icsll_node_t*
+ */
+icsll_node_t* icsll_next(icsll_t* ll, icsll_node_t* node) {
+	if (!node || node->list != ll) return NULL;
+
+	return node->next;
+}
+
+/**
+ * @brief Returns the previous list node, if extant; else, NULL
+ *
+ * @param ll
+ * @param node
+ * @return icsll_node_t*
+ */
+icsll_node_t* icsll_prev(icsll_t* ll, icsll_node_t* node) {
+	if (!node || node->list != ll) return NULL;
+
+	return __icsll_find_node_before(ll, node);
+}
+
+/**
+ * @brief Remove a given node from the list, leaving it detached
+ *
+ * @param ll
+ * @param node
+ * @return icsll_node_t*
+ */
+icsll_node_t* icsll_remove_node(icsll_t* ll, icsll_node_t* node) {
+	if (!ll->head || !node || node->list != ll) return NULL;
+
+	if (ll->size == 1) {
+		ll->head = NULL;
+		ll->tail = NULL;
+	} else {
+		icsll_node_t* tmp = __icsll_find_node_before(ll, node);
+
+		tmp->next = node->next;
+
+		if (node == ll->head) ll->head = node->next;
+		if (node == ll->tail) ll->tail = tmp;
+	}
+
+	icsll_node_init(node);
+	ll->size--;
+
+	return node;
+}
+
+/**
+ * @brief Remove the last node from the list
+ *
+ * Unlinking the tail requires its predecessor, so this walks the list once
+ *
+ * @param ll
+ * @return icsll_node_t*
+ */
+icsll_node_t* icsll_pop(icsll_t* ll) {
+	if (!ll->head) return NULL;
+
+	return icsll_remove_node(ll, ll->tail);
+}
+
+/**
+ * @brief Remove the first node from the list in constant time
+ *
+ * @param ll
+ * @return icsll_node_t*
+ */
+icsll_node_t* icsll_pop_front(icsll_t* ll) {
+	if (!ll->head) return NULL;
+
+	return icsll_remove_node(ll, ll->head);
+}
+
+/**
+ * @brief Insert `node` immediately after `mark`
+ *
+ * If `mark` is not an element of the list, or `node` belongs to a list, the list is not modified
+ *
+ * @param ll
+ * @param node
+ * @param mark
+ * @return icsll_node_t* - the node, or NULL if the list was not modified
+ */
+icsll_node_t* icsll_insert_after(icsll_t* ll, icsll_node_t* node, icsll_node_t* mark) {
+	if (!mark || mark->list != ll || !node || node->list) return NULL;
+
+	node->next = mark->next;
+	mark->next = node;
+
+	if (mark == ll->tail) ll->tail = node;
+
+	node->list = ll;
+	ll->size++;
+
+	return node;
+}
+
+/**
+ * @brief Insert `node` immediately before `mark`
+ *
+ * If `mark` is not an element of the list, or `node` belongs to a list, the list is not modified
+ *
+ * @param ll
+ * @param node
+ * @param mark
+ * @return icsll_node_t* - the node, or NULL if the list was not modified
+ */
+icsll_node_t* icsll_insert_before(icsll_t* ll, icsll_node_t* node, icsll_node_t* mark) {
+	if (!mark || mark->list != ll) return NULL;
+
+	return icsll_insert_after(ll, node, __icsll_find_node_before(ll, mark));
+}
+
+/**
+ * @brief Move a given node to its new position after `mark`
+ *
+ * If either the given node or mark are not an element of the list; node == mark; or mark.next == node, the list is not modified
+ *
+ * @param ll
+ * @param node
+ * @param mark
+ * @return int - 0 if success, else -1
+ */
+int icsll_move_after(icsll_t* ll, icsll_node_t* node, icsll_node_t* mark) {
+	if (!node || !mark) return -1;
+
+	if (node->list != ll || node == mark || mark->list != ll) return -1;
+
+	if (mark->next == node) return -1;
+
+	__icsll_move(ll, node, mark);
+	return 0;
+}
+
+/**
+ * @brief Move a given node to its new position before `mark`
+ *
+ * If either the given node or mark are not an element of the list; node == mark; or node.next == mark, the list is not modified
+ *
+ * @param ll
+ * @param node
+ * @param mark
+ * @return int - 0 if success, else -1
+ */
+int icsll_move_before(icsll_t* ll, icsll_node_t* node, icsll_node_t* mark) {
+	if (!node || !mark) return -1;
+
+	if (node->list != ll || node == mark || mark->list != ll) return -1;
+
+	if (node->next == mark) return -1;
+
+	__icsll_move(ll, node, __icsll_find_node_before(ll, mark));
+	return 0;
+}
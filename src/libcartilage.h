@@ -1,11 +1,89 @@
 #ifndef LIBCARTILAGE_H
 #define LIBCARTILAGE_H
 
+#include <stdatomic.h>
+#include <stddef.h>
 #include <stdint.h>
+#include <stdio.h>
 
 #define COUT(c) printf(#c " = %c\n", c)
 #define DOUT(c) printf(#c " = %d\n", c)
 
+#define CACHE_LINE_SIZE 64
+
+/*****************************
+ *	NodeAllocator
+ *****************************/
+
+/**
+ * @brief Allocator interface used by lists to obtain and return nodes
+ *
+ * `release`, if provided, frees every allocation made through the allocator at once; a list invokes it only if it was
+ * constructed as the allocator's owner, such that an allocator may be shared by any number of non-owning lists
+ */
+typedef struct NodeAllocator {
+	void* (*alloc)(void* ctx, size_t size);
+	void (*free)(void* ctx, void* ptr);
+	void (*release)(void* ctx);
+	void* ctx;
+} NodeAllocator_t;
+
+/*****************************
+ *	NodePool
+ *****************************/
+
+/**
+ * @brief A chunk of contiguous pool memory
+ */
+typedef struct NodePoolChunk {
+	struct NodePoolChunk* next;
+} NodePoolChunk_t;
+
+/**
+ * @brief Slab pool that carves fixed-size nodes out of large chunks and recycles them via a free list
+ */
+typedef struct NodePool {
+	NodeAllocator_t allocator; /* Allocator interface backed by this pool */
+	NodePoolChunk_t* chunks;
+	void* free_list;
+	char* cursor; /* Next never-used slot in the newest chunk */
+	char* end;
+	size_t node_size;
+	size_t chunk_size; /* Number of nodes per chunk */
+} NodePool_t;
+
+/**
+ * @brief Instantiate a node pool for nodes of `node_size` bytes, allocating `chunk_size` nodes at a time
+ *
+ * @param node_size
+ * @param chunk_size
+ * @return NodePool_t*
+ */
+NodePool_t* node_pool_make(size_t node_size, size_t chunk_size);
+
+/**
+ * @brief Take a node from the pool
+ *
+ * @param pool
+ * @return void*
+ */
+void* node_pool_alloc(NodePool_t* pool);
+
+/**
+ * @brief Return a node to the pool for reuse
+ *
+ * @param pool
+ * @param node
+ */
+void node_pool_free(NodePool_t* pool, void* node);
+
+/**
+ * @brief Free every chunk and the pool itself in O(chunks)
+ *
+ * @param pool
+ */
+void node_pool_destroy(NodePool_t* pool);
+
 /*****************************
  *	CircularSinglyLinkedList
  *****************************/
@@ -21,10 +99,15 @@ typedef struct ForwardNode {
 
 /**
  * @brief CircularSinglyLinkedList type
+ *
+ * The list tracks its tail such that tail->next == head, which keeps pushes at either end constant time
  */
 typedef struct CircularSinglyLinkedList {
 	ForwardNode_t* head;
+	ForwardNode_t* tail;
 	uint32_t size;
+	NodeAllocator_t* allocator; /* Node allocator; NULL for malloc */
+	int owns_allocator; /* Whether csll_destroy_list releases the allocator rather than freeing each node */
 } CircularSinglyLinkedList;
 
 /**
@@ -34,6 +117,42 @@ typedef struct CircularSinglyLinkedList {
  */
 CircularSinglyLinkedList* csll_make_list(void);
 
+/**
+ * @brief Instantiate an empty circular singly linked list whose nodes are obtained from `allocator`
+ *
+ * The list does not own the allocator, which may be shared with other lists; `csll_destroy_list` frees each node
+ *
+ * @param allocator
+ * @return CircularSinglyLinkedList*
+ */
+CircularSinglyLinkedList* csll_make_list_with_allocator(NodeAllocator_t* allocator);
+
+/**
+ * @brief Instantiate an empty circular singly linked list that owns `allocator`, from which its nodes are obtained
+ *
+ * If the allocator provides `release`, `csll_destroy_list` releases it rather than freeing each node; it must not
+ * be shared with any other list
+ *
+ * @param allocator
+ * @return CircularSinglyLinkedList*
+ */
+CircularSinglyLinkedList* csll_make_list_owning_allocator(NodeAllocator_t* allocator);
+
+/**
+ * @brief Return a node that was removed from the list to the list's allocator
+ *
+ * @param ll
+ * @param node
+ */
+void csll_release_node(CircularSinglyLinkedList* ll, ForwardNode_t* node);
+
+/**
+ * @brief Free all nodes of the list and the list itself; node data is not freed
+ *
+ * @param ll
+ */
+void csll_destroy_list(CircularSinglyLinkedList* ll);
+
 ForwardNode_t* __csll_make_node(void* value);
 
 /**
@@ -41,7 +160,7 @@ ForwardNode_t* __csll_make_node(void* value);
  *
  * @param ll
  * @param value
- * @return ForwardNode_t*
+ * @return ForwardNode_t* - the new node, or NULL if it could not be allocated
  */
 ForwardNode_t* csll_push_back(CircularSinglyLinkedList* ll, void* value);
 
@@ -50,7 +169,7 @@ ForwardNode_t* csll_push_back(CircularSinglyLinkedList* ll, void* value);
  *
  * @param ll
  * @param value
- * @return ForwardNode_t*
+ * @return ForwardNode_t* - the new node, or NULL if it could not be allocated
  */
 ForwardNode_t* csll_push_front(CircularSinglyLinkedList* ll, void* value);
 
@@ -97,6 +216,45 @@ ForwardNode_t* csll_remove_node(CircularSinglyLinkedList* ll, ForwardNode_t* nod
  */
 ForwardNode_t* csll_pop(CircularSinglyLinkedList* ll);
 
+/**
+ * @brief Remove the first node from the list in constant time
+ *
+ * @param ll
+ * @return ForwardNode_t*
+ */
+ForwardNode_t* csll_pop_front(CircularSinglyLinkedList* ll);
+
+/**
+ * @brief Unlink, in a single traversal, every node for which `predicate` returns non-zero
+ *
+ * The removed nodes keep their relative order and are handed back as a NULL-terminated chain linked through `next`;
+ * the caller returns each to the list via csll_release_node
+ *
+ * @param ll
+ * @param predicate - invoked with each node and `ctx`
+ * @param ctx
+ * @return ForwardNode_t* - the first removed node, or NULL if none matched
+ */
+ForwardNode_t* csll_remove_if(CircularSinglyLinkedList* ll, int (*predicate)(ForwardNode_t*, void*), void* ctx);
+
+/**
+ * @brief Keep only the nodes for which `predicate` returns non-zero, in a single traversal, and release the rest
+ *
+ * Each removed node is passed to `dispose`, if provided, e.g. to free its data, and is then released
+ *
+ * @param ll
+ * @param predicate - invoked with each node and `ctx`
+ * @param dispose - invoked with each removed node and `ctx`
+ * @param ctx
+ * @return uint32_t - the number of nodes removed
+ */
+uint32_t csll_retain(
+	CircularSinglyLinkedList* ll,
+	int (*predicate)(ForwardNode_t*, void*),
+	void (*dispose)(ForwardNode_t*, void*),
+	void* ctx
+);
+
 /**
  * @brief Insert a new node with value `value` immediately after `mark`
  *
@@ -175,108 +333,2542 @@ CircularSinglyLinkedList* csll_push_back_list(CircularSinglyLinkedList* ll, Circ
  */
 CircularSinglyLinkedList* csll_push_front_list(CircularSinglyLinkedList* ll, CircularSinglyLinkedList* other);
 
-/*****************************
- *	GlThread
- *****************************/
+/**
+ * @brief Sort the list in place by node data; stable, O(n log n), and allocation-free
+ *
+ * a precedes b if `comparator(a->data, b->data)` returns -1
+ *
+ * @param ll
+ * @param comparator
+ */
+void csll_sort(CircularSinglyLinkedList* ll, int (*comparator)(void*, void*));
 
-#define IS_GLTHREAD_EMPTY(glthreadptr) ((glthreadptr)->next == 0 && (glthreadptr)->prev == 0)
+/**
+ * @brief Merge the nodes of the sorted list `other` into the sorted list `ll`, leaving `other` empty
+ *
+ * Where nodes compare equal, those of `ll` come first. Nodes change lists, so both lists must use the same allocator,
+ * and `other` must not own it: destroying `other` would then release the nodes it gave to `ll`
+ *
+ * @param ll
+ * @param other
+ * @param comparator
+ * @return int - 0 if success, else -1
+ */
+int csll_merge(CircularSinglyLinkedList* ll, CircularSinglyLinkedList* other, int (*comparator)(void*, void*));
 
-#define BASE(glthreadptr) ((glthreadptr)->next)
+/**
+ * @brief Fraction of traversal steps whose next node does not immediately follow the current one in memory
+ *
+ * 0 means traversal order matches address order; a list scattered across the heap tends towards 1
+ *
+ * @param ll
+ * @return double
+ */
+double csll_fragmentation(CircularSinglyLinkedList* ll);
 
-#define ITERATE_GLTHREAD_BEGIN(glthreadbegin, glthreadptr) {                                      \
-	glthread_t* _glthread_ptr = NULL;                                                               \
-	glthreadptr = BASE(glthreadbegin);                                                              \
-	                                                                                                \
-	for (; glthreadptr; glthreadptr = _glthread_ptr) {                                              \
-		_glthread_ptr = (glthreadptr)->next;                                                          \
+/**
+ * @brief Reallocate every node into one contiguous block, in traversal order
+ *
+ * The list's allocator is replaced by a NodePool which owns the block and which the list owns. If the list owned its
+ * previous allocator and it provides `release`, it is released; else each previous node is returned to it, such that
+ * an allocator shared with other lists remains valid. `remap`, if provided, is invoked with each node's old and new
+ * address before the old node is freed, for callers that hold node pointers
+ *
+ * @param ll
+ * @param remap
+ * @param ctx
+ * @return int - 0 if success, else -1 and the list is unmodified
+ */
+int csll_compact(
+	CircularSinglyLinkedList* ll,
+	void (*remap)(ForwardNode_t* from, ForwardNode_t* to, void* ctx),
+	void* ctx
+);
 
-#define ITERATE_GLTHREAD_END(glthreadend, glthreadptr)                                            \
-	}}
+/**
+ * @brief Advance the head of the list by `k` nodes, such that the node `k` places after the head becomes the head
+ *
+ * No links change, but a singly linked ring must be walked `k % size` steps, so rotation is O(k mod n); a single
+ * step is constant time
+ *
+ * @param ll
+ * @param k
+ * @return ForwardNode_t* - the new head, or NULL if the list is empty
+ */
+ForwardNode_t* csll_rotate(CircularSinglyLinkedList* ll, uint32_t k);
 
-#define GET_DATA_FROM_OFFSET(glthreadptr, offset) (void*)((char*)(glthreadptr) - offset)
+/**
+ * @brief Persistent round-robin cursor; tracks the predecessor of its current node, such that the current node can be
+ * removed in constant time
+ *
+ * The cursor survives insertions and any removals other than of its current node and predecessor, after which it must
+ * be re-initialized
+ */
+typedef struct csll_rr_cursor {
+	CircularSinglyLinkedList* ll;
+	ForwardNode_t* prev; /* Predecessor of `node`, or of the next node to be yielded; NULL to start at the head */
+	ForwardNode_t* node; /* Node last yielded; NULL before the first yield and after a removal */
+} csll_rr_cursor_t;
 
 /**
- * @brief glthread meta container
+ * @brief Initialize a round-robin cursor whose first yield is the head of the list
+ *
+ * @param c
+ * @param ll
  */
-typedef struct glthread {
-	struct glthread* prev;
-	struct glthread* next;
-} glthread_t;
+void csll_rr_init(csll_rr_cursor_t* c, CircularSinglyLinkedList* ll);
 
 /**
- * @brief Initialize a new glthread
+ * @brief Advance the cursor to the next node, wrapping from the tail to the head, in constant time
  *
- * @param glthread
+ * @param c
+ * @return ForwardNode_t* - the next node, or NULL if the list is empty
  */
-void glthread_init(glthread_t* glthread);
+ForwardNode_t* csll_rr_next(csll_rr_cursor_t* c);
 
 /**
- * @brief Insert a new glthread node after the given mark
+ * @brief Advance the cursor by `k` nodes, as would `k` calls to csll_rr_next, walking only `k % size` steps
  *
- * @param mark
- * @param next
+ * A cursor without a current node (fresh, or just after a removal) first takes one step onto a node, after which the
+ * remaining `k - 1` steps are reduced modulo the size
+ *
+ * @param c
+ * @param k
+ * @return ForwardNode_t* - the node the cursor is then on, or NULL if the list is empty
  */
-void glthread_insert_after(glthread_t* mark, glthread_t* next);
+ForwardNode_t* csll_rr_skip(csll_rr_cursor_t* c, uint32_t k);
 
 /**
- * @brief Insert a new glthread node before the given mark
+ * @brief Remove the cursor's current node in constant time; the next call to csll_rr_next yields its successor
  *
- * @param mark
- * @param next
+ * If nodes were inserted between the current node and its tracked predecessor, the predecessor is found by walking the
+ * list
+ *
+ * @param c
+ * @return ForwardNode_t* - the removed node, for the caller to release, or NULL if the cursor has no current node
  */
-void glthread_insert_before(glthread_t* mark, glthread_t* next);
+ForwardNode_t* csll_rr_remove(csll_rr_cursor_t* c);
+
+/* Number of nodes ahead of the cursor that are prefetched by CSLL_FOREACH and csll_iterate_ctx */
+#ifndef CSLL_PREFETCH_DISTANCE
+#define CSLL_PREFETCH_DISTANCE 4
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define CARTILAGE_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#define CARTILAGE_PREFETCH(addr) ((void)(addr))
+#endif
 
 /**
- * @brief Remove a given glthread node
+ * @brief Inlinable traversal cursor; keeps a second pointer `distance` nodes ahead and prefetches it,
+ * such that cache misses overlap with work on the current node
+ */
+typedef struct csll_cursor {
+	ForwardNode_t* node;
+	ForwardNode_t* ahead;
+	uint32_t remaining;
+} csll_cursor_t;
+
+/**
+ * @brief Make a cursor positioned before the head of the list, prefetching `distance` nodes ahead
  *
- * @param mark
+ * @param ll
+ * @param distance
+ * @return csll_cursor_t
  */
-void glthread_remove(glthread_t* mark);
+static inline csll_cursor_t csll_cursor_make(CircularSinglyLinkedList* ll, uint32_t distance) {
+	csll_cursor_t c = { ll->head, ll->head, ll->size };
+
+	for (uint32_t i = 0; i < distance && i < ll->size; i++) {
+		c.ahead = c.ahead->next;
+		CARTILAGE_PREFETCH(c.ahead);
+	}
+
+	return c;
+}
 
 /**
- * @brief Push new glthread node to tail
+ * @brief Advance the cursor
  *
- * @param head
- * @param next
+ * The returned node may be removed from the list before the next call; no other node may be
+ *
+ * @param c
+ * @return ForwardNode_t* - the next node, or NULL once every node has been visited
  */
-void glthread_push(glthread_t* head, glthread_t* next);
+static inline ForwardNode_t* csll_cursor_next(csll_cursor_t* c) {
+	if (!c->remaining) return NULL;
+
+	ForwardNode_t* n = c->node;
+
+	c->node = n->next;
+	c->ahead = c->ahead->next;
+
+	// in a ring no longer than the distance, `ahead` may wrap onto `n`, which the caller is free to remove
+	if (c->ahead == n) c->ahead = c->node;
+
+	CARTILAGE_PREFETCH(c->ahead);
+	c->remaining--;
+
+	return n;
+}
+
+/* Iterate over every node of `ll`, binding each to `node`; `break` ends the iteration early */
+#define CSLL_FOREACH(ll, node)                                                                    \
+	for (csll_cursor_t _csll_cursor = csll_cursor_make((ll), CSLL_PREFETCH_DISTANCE);               \
+		((node) = csll_cursor_next(&_csll_cursor));)
 
 /**
- * @brief Delete all nodes in a given glthread
+ * @brief Iterate over the list and invoke `callback` with each node and `ctx`, until the callback returns non-zero
  *
- * @param head
+ * @param ll
+ * @param callback
+ * @param ctx
+ * @return ForwardNode_t* - the node for which the callback returned non-zero, or NULL if every node was visited
  */
-void glthread_del_list(glthread_t* head);
+static inline ForwardNode_t* csll_iterate_ctx(
+	CircularSinglyLinkedList* ll,
+	int (*callback)(ForwardNode_t* node, void* ctx),
+	void* ctx
+) {
+	csll_cursor_t c = csll_cursor_make(ll, CSLL_PREFETCH_DISTANCE);
+	ForwardNode_t* n;
+
+	while ((n = csll_cursor_next(&c))) {
+		if (callback(n, ctx)) return n;
+	}
+
+	return NULL;
+}
+
+/*****************************
+ *	CircularDoublyLinkedList
+ *****************************/
 
 /**
- * @brief Get current size of glthread
+ * @brief Node type; atomic - points to next and previous Node*
+ */
+typedef struct BidirectionalNode {
+	void* data;
+	struct BidirectionalNode* next;
+	struct BidirectionalNode* prev;
+	struct CircularDoublyLinkedList* list; /* A pointer to the list to which the node belongs */
+} BidirectionalNode_t;
+
+/**
+ * @brief CircularDoublyLinkedList type
  *
- * @param head
- * @return unsigned int
+ * The tail is head->prev; every node-relative operation is constant time
  */
-unsigned int glthread_size(glthread_t* head);
+typedef struct CircularDoublyLinkedList {
+	BidirectionalNode_t* head;
+	uint32_t size;
+	NodeAllocator_t* allocator; /* Node allocator; NULL for malloc */
+	int owns_allocator; /* Whether cdll_destroy_list releases the allocator rather than freeing each node */
+} CircularDoublyLinkedList;
 
 /**
- * @brief Prioritized insertion
+ * @brief Instantiate an empty circular doubly linked list
  *
- * @param head
- * @param glthread
- * @param comparator
- * @param offset
+ * @return CircularDoublyLinkedList*
  */
-void glthread_priority_insert(
-	glthread_t* head,
-	glthread_t* glthread,
-	int(*comparator)(void*, void*),
-	int offset
-);
+CircularDoublyLinkedList* cdll_make_list(void);
 
 /**
- * @brief Dequeue the head node
+ * @brief Instantiate an empty circular doubly linked list whose nodes are obtained from `allocator`
  *
- * @param head
- * @return glthread_t*
+ * The list does not own the allocator, which may be shared with other lists; `cdll_destroy_list` frees each node
+ *
+ * @param allocator
+ * @return CircularDoublyLinkedList*
  */
-glthread_t* glthread_dequeue_first(glthread_t* head);
+CircularDoublyLinkedList* cdll_make_list_with_allocator(NodeAllocator_t* allocator);
+
+/**
+ * @brief Instantiate an empty circular doubly linked list that owns `allocator`, from which its nodes are obtained
+ *
+ * If the allocator provides `release`, `cdll_destroy_list` releases it rather than freeing each node; it must not
+ * be shared with any other list
+ *
+ * @param allocator
+ * @return CircularDoublyLinkedList*
+ */
+CircularDoublyLinkedList* cdll_make_list_owning_allocator(NodeAllocator_t* allocator);
+
+BidirectionalNode_t* __cdll_make_node(void* value);
+
+/**
+ * @brief Return a node that was removed from the list to the list's allocator
+ *
+ * @param ll
+ * @param node
+ */
+void cdll_release_node(CircularDoublyLinkedList* ll, BidirectionalNode_t* node);
+
+/**
+ * @brief Free all nodes of the list and the list itself; node data is not freed
+ *
+ * @param ll
+ */
+void cdll_destroy_list(CircularDoublyLinkedList* ll);
+
+/**
+ * @brief Push a new node with value `value` to the back of the list
+ *
+ * @param ll
+ * @param value
+ * @return BidirectionalNode_t* - the new node, or NULL if it could not be allocated
+ */
+BidirectionalNode_t* cdll_push_back(CircularDoublyLinkedList* ll, void* value);
+
+/**
+ * @brief Push a new node with value `value` to the front of the list
+ *
+ * @param ll
+ * @param value
+ * @return BidirectionalNode_t* - the new node, or NULL if it could not be allocated
+ */
+BidirectionalNode_t* cdll_push_front(CircularDoublyLinkedList* ll, void* value);
+
+/**
+ * @brief Iterate over the list and invoke `callback` with each node
+ *
+ * @param ll
+ * @param callback
+ */
+void cdll_iterate(CircularDoublyLinkedList* ll, void (*callback)(void*));
+
+/**
+ * @brief Returns the next list node, if extant; else, NULL
+ *
+ * @param ll
+ * @param node
+ * @return BidirectionalNode_t*
+ */
+BidirectionalNode_t* cdll_next(CircularDoublyLinkedList* ll, BidirectionalNode_t* node);
+
+/**
+ * @brief Returns the previous list node, if extant; else, NULL
+ *
+ * @param ll
+ * @param node
+ * @return BidirectionalNode_t*
+ */
+BidirectionalNode_t* cdll_prev(CircularDoublyLinkedList* ll, BidirectionalNode_t* node);
+
+/**
+ * @brief Remove a given node from the list
+ *
+ * @param ll
+ * @param node
+ * @return BidirectionalNode_t*
+ */
+BidirectionalNode_t* cdll_remove_node(CircularDoublyLinkedList* ll, BidirectionalNode_t* node);
+
+/**
+ * @brief Remove the last node from the list
+ *
+ * @param ll
+ * @return BidirectionalNode_t*
+ */
+BidirectionalNode_t* cdll_pop(CircularDoublyLinkedList* ll);
+
+/**
+ * @brief Remove the first node from the list
+ *
+ * @param ll
+ * @return BidirectionalNode_t*
+ */
+BidirectionalNode_t* cdll_pop_front(CircularDoublyLinkedList* ll);
+
+/**
+ * @brief Insert a new node with value `value` immediately after `mark`
+ *
+ * If `mark` is not an element of the list, the list is not modified
+ *
+ * `mark` must not be NULL
+ *
+ * @param ll
+ * @param value
+ * @param mark
+ * @return BidirectionalNode_t*
+ */
+BidirectionalNode_t* cdll_insert_after(CircularDoublyLinkedList* ll, void* value, BidirectionalNode_t* mark);
+
+/**
+ * @brief Insert a new node with value `value` immediately before `mark`
+ *
+ * If `mark` is not an element of the list, the list is not modified
+ *
+ * `mark` must not be NULL
+ *
+ * @param ll
+ * @param value
+ * @param mark
+ * @return BidirectionalNode_t*
+ */
+BidirectionalNode_t* cdll_insert_before(CircularDoublyLinkedList* ll, void* value, BidirectionalNode_t* mark);
+
+/**
+ * @brief Move a given node to its new position before `mark`
+ *
+ * If either the given node or mark are not an element of the list; node == mark; or node.next == mark, the list is not modified
+ *
+ * Both the node and mark must not be NULL
+ *
+ * @param ll
+ * @param node
+ * @param mark
+ * @return int - 0 if success, else -1
+ */
+int cdll_move_before(CircularDoublyLinkedList* ll, BidirectionalNode_t* node, BidirectionalNode_t* mark);
+
+/**
+ * @brief Move a given node to its new position after `mark`
+ *
+ * If either the given node or mark are not an element of the list; node == mark; or mark.next == node, the list is not modified
+ *
+ * Both the node and mark must not be NULL
+ *
+ * @param ll
+ * @param node
+ * @param mark
+ * @return int - 0 if success, else -1
+ */
+int cdll_move_after(CircularDoublyLinkedList* ll, BidirectionalNode_t* node, BidirectionalNode_t* mark);
+
+/**
+ * @brief Insert a copy of another list at the back of the caller list
+ *
+ * The lists may be the same, but must not be NULL
+ *
+ * @param ll
+ * @param other
+ * @return CircularDoublyLinkedList*
+ */
+CircularDoublyLinkedList* cdll_push_back_list(CircularDoublyLinkedList* ll, CircularDoublyLinkedList* other);
+
+/**
+ * @brief Insert a copy of another list at the front of the caller list
+ *
+ * The lists may be the same, but must not be NULL
+ *
+ * @param ll
+ * @param other
+ * @return CircularDoublyLinkedList*
+ */
+CircularDoublyLinkedList* cdll_push_front_list(CircularDoublyLinkedList* ll, CircularDoublyLinkedList* other);
+
+/*****************************
+ *	GlThread
+ *****************************/
+
+#define IS_GLTHREAD_EMPTY(glthreadptr) ((glthreadptr)->next == 0 && (glthreadptr)->prev == 0)
+
+#define BASE(glthreadptr) ((glthreadptr)->next)
+
+#define ITERATE_GLTHREAD_BEGIN(glthreadbegin, glthreadptr) {                                      \
+	glthread_t* _glthread_ptr = NULL;                                                               \
+	glthreadptr = BASE(glthreadbegin);                                                              \
+	                                                                                                \
+	for (; glthreadptr; glthreadptr = _glthread_ptr) {                                              \
+		_glthread_ptr = (glthreadptr)->next;                                                          \
+
+#define ITERATE_GLTHREAD_END(glthreadend, glthreadptr)                                            \
+	}}
+
+#define GET_DATA_FROM_OFFSET(glthreadptr, offset) (void*)((char*)(glthreadptr) - offset)
+
+/**
+ * @brief glthread meta container
+ */
+typedef struct glthread {
+	struct glthread* prev;
+	struct glthread* next;
+} glthread_t;
+
+/**
+ * @brief Initialize a new glthread
+ *
+ * @param glthread
+ */
+void glthread_init(glthread_t* glthread);
+
+/**
+ * @brief Insert a new glthread node after the given mark
+ *
+ * @param mark
+ * @param next
+ */
+void glthread_insert_after(glthread_t* mark, glthread_t* next);
+
+/**
+ * @brief Insert a new glthread node before the given mark
+ *
+ * @param mark
+ * @param next
+ */
+void glthread_insert_before(glthread_t* mark, glthread_t* next);
+
+/**
+ * @brief Remove a given glthread node
+ *
+ * @param mark
+ */
+void glthread_remove(glthread_t* mark);
+
+/**
+ * @brief Push new glthread node to tail
+ *
+ * @param head
+ * @param next
+ */
+void glthread_push(glthread_t* head, glthread_t* next);
+
+/**
+ * @brief Delete all nodes in a given glthread
+ *
+ * @param head
+ */
+void glthread_del_list(glthread_t* head);
+
+/**
+ * @brief Get current size of glthread
+ *
+ * @param head
+ * @return unsigned int
+ */
+unsigned int glthread_size(glthread_t* head);
+
+/**
+ * @brief Prioritized insertion
+ *
+ * @param head
+ * @param glthread
+ * @param comparator
+ * @param offset
+ */
+void glthread_priority_insert(
+	glthread_t* head,
+	glthread_t* glthread,
+	int(*comparator)(void*, void*),
+	int offset
+);
+
+/**
+ * @brief Dequeue the head node
+ *
+ * @param head
+ * @return glthread_t*
+ */
+glthread_t* glthread_dequeue_first(glthread_t* head);
+
+/**
+ * @brief Sort the glthread chain in place; stable, O(n log n), and allocation-free
+ *
+ * Nodes are ordered as with glthread_priority_insert, i.e. a precedes b if `comparator(a, b)` returns -1
+ *
+ * @param head
+ * @param comparator
+ * @param offset
+ */
+void glthread_sort(glthread_t* head, int(*comparator)(void*, void*), int offset);
+
+/**
+ * @brief Merge the sorted chain hanging off `other` into the sorted chain hanging off `head`, leaving `other` empty
+ *
+ * Where nodes compare equal, those of `head` come first
+ *
+ * @param head
+ * @param other
+ * @param comparator
+ * @param offset
+ */
+void glthread_merge(glthread_t* head, glthread_t* other, int(*comparator)(void*, void*), int offset);
+
+/**
+ * @brief Unlink, in a single traversal, every node for which `predicate` returns non-zero
+ *
+ * `predicate` is invoked with the struct at `offset` behind each node, and `ctx`. The removed nodes keep their
+ * relative order and are handed back as a chain whose first node's prev and last node's next are NULL
+ *
+ * @param head
+ * @param predicate
+ * @param ctx
+ * @param offset
+ * @return glthread_t* - the first removed node, or NULL if none matched
+ */
+glthread_t* glthread_remove_if(glthread_t* head, int(*predicate)(void*, void*), void* ctx, int offset);
+
+/**
+ * @brief Keep only the nodes for which `predicate` returns non-zero, in a single traversal
+ *
+ * Each removed node is unlinked and its struct then passed to `dispose`, if provided, with `ctx`, e.g. to free it
+ *
+ * @param head
+ * @param predicate
+ * @param dispose
+ * @param ctx
+ * @param offset
+ * @return unsigned int - the number of nodes removed
+ */
+unsigned int glthread_retain(
+	glthread_t* head,
+	int(*predicate)(void*, void*),
+	void(*dispose)(void*, void*),
+	void* ctx,
+	int offset
+);
+
+/**
+ * @brief glthread list head; tracks the tail and size of the glthread chain hanging off `head`
+ *
+ * `head` is a sentinel whose next member is the first node, and thus may be used with ITERATE_GLTHREAD_BEGIN
+ */
+typedef struct glthread_list {
+	glthread_t head;
+	glthread_t* tail; /* NULL if the list is empty */
+	unsigned int size;
+} glthread_list_t;
+
+/**
+ * @brief Initialize a new, empty glthread list
+ *
+ * @param list
+ */
+void glthread_list_init(glthread_list_t* list);
+
+/**
+ * @brief Push new glthread node to tail in constant time
+ *
+ * @param list
+ * @param next
+ */
+void glthread_list_push(glthread_list_t* list, glthread_t* next);
+
+/**
+ * @brief Push new glthread node to head in constant time
+ *
+ * @param list
+ * @param next
+ */
+void glthread_list_push_front(glthread_list_t* list, glthread_t* next);
+
+/**
+ * @brief Remove the tail node in constant time
+ *
+ * @param list
+ * @return glthread_t* - the removed node, or NULL if the list is empty
+ */
+glthread_t* glthread_list_pop(glthread_list_t* list);
+
+/**
+ * @brief Dequeue the head node in constant time
+ *
+ * @param list
+ * @return glthread_t* - the removed node, or NULL if the list is empty
+ */
+glthread_t* glthread_list_dequeue_first(glthread_list_t* list);
+
+/**
+ * @brief Insert a new glthread node after the given mark, where mark is a node of the list
+ *
+ * @param list
+ * @param mark
+ * @param next
+ */
+void glthread_list_insert_after(glthread_list_t* list, glthread_t* mark, glthread_t* next);
+
+/**
+ * @brief Insert a new glthread node before the given mark, where mark is a node of the list
+ *
+ * @param list
+ * @param mark
+ * @param next
+ */
+void glthread_list_insert_before(glthread_list_t* list, glthread_t* mark, glthread_t* next);
+
+/**
+ * @brief Remove a given glthread node from the list
+ *
+ * @param list
+ * @param mark
+ */
+void glthread_list_remove(glthread_list_t* list, glthread_t* mark);
+
+/**
+ * @brief Delete all nodes in a given glthread list
+ *
+ * @param list
+ */
+void glthread_list_del_list(glthread_list_t* list);
+
+/**
+ * @brief Get current size of glthread list in constant time
+ *
+ * @param list
+ * @return unsigned int
+ */
+unsigned int glthread_list_size(glthread_list_t* list);
+
+/**
+ * @brief Sort the glthread list in place; see glthread_sort
+ *
+ * @param list
+ * @param comparator
+ * @param offset
+ */
+void glthread_list_sort(glthread_list_t* list, int(*comparator)(void*, void*), int offset);
+
+/**
+ * @brief Merge the sorted list `other` into the sorted list `list`, leaving `other` empty; see glthread_merge
+ *
+ * @param list
+ * @param other
+ * @param comparator
+ * @param offset
+ */
+void glthread_list_merge(glthread_list_t* list, glthread_list_t* other, int(*comparator)(void*, void*), int offset);
+
+/**
+ * @brief Unlink, in a single traversal, every node for which `predicate` returns non-zero; see glthread_remove_if
+ *
+ * @param list
+ * @param predicate
+ * @param ctx
+ * @param offset
+ * @return glthread_t* - the first removed node, or NULL if none matched
+ */
+glthread_t* glthread_list_remove_if(glthread_list_t* list, int(*predicate)(void*, void*), void* ctx, int offset);
+
+/**
+ * @brief Keep only the nodes for which `predicate` returns non-zero, in a single traversal; see glthread_retain
+ *
+ * @param list
+ * @param predicate
+ * @param dispose
+ * @param ctx
+ * @param offset
+ * @return unsigned int - the number of nodes removed
+ */
+unsigned int glthread_list_retain(
+	glthread_list_t* list,
+	int(*predicate)(void*, void*),
+	void(*dispose)(void*, void*),
+	void* ctx,
+	int offset
+);
+
+/*****************************
+ *	GlThread Heap
+ *****************************/
+
+/**
+ * @brief Intrusive pairing heap link; embed in the user's struct as with glthread_t
+ */
+typedef struct glthread_heap_node {
+	struct glthread_heap_node* child;
+	struct glthread_heap_node* next; /* Next sibling */
+	struct glthread_heap_node* prev; /* Previous sibling, or the parent if this node is the leftmost child */
+} glthread_heap_node_t;
+
+/**
+ * @brief Intrusive priority queue (pairing heap)
+ *
+ * Follows the glthread_priority_insert convention: a node precedes another if
+ * `comparator(a, b)` returns -1, where a and b are the data found at `offset` before each link
+ */
+typedef struct glthread_heap {
+	glthread_heap_node_t* root;
+	unsigned int size;
+	int(*comparator)(void*, void*);
+	int offset;
+} glthread_heap_t;
+
+/**
+ * @brief Initialize a new, empty heap
+ *
+ * @param heap
+ * @param comparator
+ * @param offset
+ */
+void glthread_heap_init(glthread_heap_t* heap, int(*comparator)(void*, void*), int offset);
+
+/**
+ * @brief Insert a node into the heap in constant time
+ *
+ * @param heap
+ * @param node
+ */
+void glthread_heap_insert(glthread_heap_t* heap, glthread_heap_node_t* node);
+
+/**
+ * @brief Returns the first node of the heap without removing it, or NULL if the heap is empty
+ *
+ * @param heap
+ * @return glthread_heap_node_t*
+ */
+glthread_heap_node_t* glthread_heap_peek(glthread_heap_t* heap);
+
+/**
+ * @brief Remove and return the first node of the heap in amortized O(log n), or NULL if the heap is empty
+ *
+ * @param heap
+ * @return glthread_heap_node_t*
+ */
+glthread_heap_node_t* glthread_heap_extract(glthread_heap_t* heap);
+
+/**
+ * @brief Restore heap order after the data of `node` was changed such that it moved toward the front
+ *
+ * @param heap
+ * @param node
+ */
+void glthread_heap_decrease_key(glthread_heap_t* heap, glthread_heap_node_t* node);
+
+/**
+ * @brief Remove an arbitrary node from the heap in amortized O(log n)
+ *
+ * @param heap
+ * @param node
+ */
+void glthread_heap_remove(glthread_heap_t* heap, glthread_heap_node_t* node);
+
+/**
+ * @brief Get current size of heap
+ *
+ * @param heap
+ * @return unsigned int
+ */
+unsigned int glthread_heap_size(glthread_heap_t* heap);
+
+/*****************************
+ *	MPSC Queue
+ *****************************/
+
+/**
+ * @brief Intrusive MPSC queue link; embed in the user's struct and recover it with GET_DATA_FROM_OFFSET
+ */
+typedef struct mpsc_node {
+	_Atomic(struct mpsc_node*) next;
+} mpsc_node_t;
+
+/**
+ * @brief Lock-free multi-producer single-consumer intrusive queue (Vyukov)
+ *
+ * Any number of threads may push concurrently; only a single thread may pop
+ */
+typedef struct mpsc_queue {
+	_Alignas(CACHE_LINE_SIZE) _Atomic(mpsc_node_t*) head; /* Producer side; the most recently pushed node */
+	_Alignas(CACHE_LINE_SIZE) mpsc_node_t* tail; /* Consumer side; the next node to pop */
+	mpsc_node_t stub;
+} mpsc_queue_t;
+
+/**
+ * @brief Initialize a new, empty queue
+ *
+ * @param q
+ */
+void mpsc_queue_init(mpsc_queue_t* q);
+
+/**
+ * @brief Push a node onto the queue; wait-free and safe to call from any thread
+ *
+ * @param q
+ * @param node
+ */
+void mpsc_queue_push(mpsc_queue_t* q, mpsc_node_t* node);
+
+/**
+ * @brief Pop the oldest node from the queue; consumer only
+ *
+ * Returns NULL if the queue is empty or if the next node is still being linked by a producer
+ *
+ * @param q
+ * @return mpsc_node_t*
+ */
+mpsc_node_t* mpsc_queue_pop(mpsc_queue_t* q);
+
+/**
+ * @brief Pop up to `max` nodes into `nodes`; consumer only
+ *
+ * @param q
+ * @param nodes
+ * @param max
+ * @return unsigned int - the number of nodes popped
+ */
+unsigned int mpsc_queue_pop_batch(mpsc_queue_t* q, mpsc_node_t** nodes, unsigned int max);
+
+/**
+ * @brief Whether the queue is empty; consumer only
+ *
+ * @param q
+ * @return int
+ */
+int mpsc_queue_is_empty(mpsc_queue_t* q);
+
+/*****************************
+ *	SPSC Ring
+ *****************************/
+
+/**
+ * @brief Bounded single-producer single-consumer ring of fixed-size slots
+ *
+ * `head` and `tail` are free-running indices, each on its own cache line alongside the owning
+ * side's cached copy of the opposite index, such that the shared lines are only touched when the cache is exhausted
+ */
+typedef struct spsc_ring {
+	_Alignas(CACHE_LINE_SIZE) _Atomic(size_t) head; /* Consumer side; the next slot to read */
+	size_t cached_tail;
+	_Alignas(CACHE_LINE_SIZE) _Atomic(size_t) tail; /* Producer side; the next slot to write */
+	size_t cached_head;
+	_Alignas(CACHE_LINE_SIZE) size_t capacity; /* A power of two */
+	size_t mask;
+	size_t elem_size;
+	char* slots;
+} spsc_ring_t;
+
+/**
+ * @brief Instantiate a ring of at least `capacity` slots of `elem_size` bytes; capacity is rounded up to a power of two
+ *
+ * @param capacity
+ * @param elem_size
+ * @return spsc_ring_t* - or NULL if allocation failed, or if the rounded capacity or the slots' size overflows a size_t
+ */
+spsc_ring_t* spsc_ring_make(size_t capacity, size_t elem_size);
+
+/**
+ * @brief Free the ring and its slots
+ *
+ * @param r
+ */
+void spsc_ring_destroy(spsc_ring_t* r);
+
+/**
+ * @brief Reserve up to `n` contiguous slots for writing; producer only
+ *
+ * The slots are published to the consumer by `spsc_ring_commit`
+ *
+ * @param r
+ * @param n
+ * @param slots - set to the first reserved slot
+ * @return size_t - the number of slots reserved, which may be fewer than `n` if the ring is full or wraps
+ */
+size_t spsc_ring_reserve(spsc_ring_t* r, size_t n, void** slots);
+
+/**
+ * @brief Publish `n` slots previously obtained from `spsc_ring_reserve`; producer only
+ *
+ * @param r
+ * @param n
+ */
+void spsc_ring_commit(spsc_ring_t* r, size_t n);
+
+/**
+ * @brief Obtain up to `n` contiguous readable slots without copying; consumer only
+ *
+ * The slots are returned to the producer by `spsc_ring_release`
+ *
+ * @param r
+ * @param n
+ * @param slots - set to the first readable slot
+ * @return size_t - the number of readable slots, which may be fewer than `n` if the ring is empty or wraps
+ */
+size_t spsc_ring_peek(spsc_ring_t* r, size_t n, void** slots);
+
+/**
+ * @brief Return `n` slots previously obtained from `spsc_ring_peek` to the producer; consumer only
+ *
+ * @param r
+ * @param n
+ */
+void spsc_ring_release(spsc_ring_t* r, size_t n);
+
+/**
+ * @brief Copy an element into the ring; producer only
+ *
+ * @param r
+ * @param elem
+ * @return int - 0 if success, else -1 if the ring is full
+ */
+int spsc_ring_push(spsc_ring_t* r, const void* elem);
+
+/**
+ * @brief Copy an element out of the ring; consumer only
+ *
+ * @param r
+ * @param elem
+ * @return int - 0 if success, else -1 if the ring is empty
+ */
+int spsc_ring_pop(spsc_ring_t* r, void* elem);
+
+/**
+ * @brief Copy up to `n` elements into the ring; producer only
+ *
+ * @param r
+ * @param elems
+ * @param n
+ * @return size_t - the number of elements pushed
+ */
+size_t spsc_ring_push_batch(spsc_ring_t* r, const void* elems, size_t n);
+
+/**
+ * @brief Copy up to `n` elements out of the ring; consumer only
+ *
+ * @param r
+ * @param elems
+ * @param n
+ * @return size_t - the number of elements popped
+ */
+size_t spsc_ring_pop_batch(spsc_ring_t* r, void* elems, size_t n);
+
+/**
+ * @brief Get the number of elements in the ring; exact only when called by the producer or consumer
+ *
+ * @param r
+ * @return size_t
+ */
+size_t spsc_ring_size(spsc_ring_t* r);
+
+/*****************************
+ *	MPMC Ring
+ *****************************/
+
+/**
+ * @brief Bounded multi-producer multi-consumer ring of fixed-size slots (Vyukov)
+ *
+ * Each slot carries a sequence number which tells producers and consumers whether it is free for
+ * the current lap, such that threads only contend on the position counters
+ */
+typedef struct mpmc_ring {
+	_Alignas(CACHE_LINE_SIZE) _Atomic(size_t) enqueue_pos;
+	_Alignas(CACHE_LINE_SIZE) _Atomic(size_t) dequeue_pos;
+	_Alignas(CACHE_LINE_SIZE) size_t capacity; /* A power of two */
+	size_t mask;
+	size_t elem_size;
+	size_t cell_size; /* Sequence number plus padded element */
+	char* cells;
+} mpmc_ring_t;
+
+/**
+ * @brief Instantiate a ring of at least `capacity` slots of `elem_size` bytes; capacity is rounded up to a power of two
+ *
+ * @param capacity
+ * @param elem_size
+ * @return mpmc_ring_t* - or NULL if allocation failed, or if the rounded capacity or the slots' size overflows a size_t
+ */
+mpmc_ring_t* mpmc_ring_make(size_t capacity, size_t elem_size);
+
+/**
+ * @brief Free the ring and its slots
+ *
+ * @param r
+ */
+void mpmc_ring_destroy(mpmc_ring_t* r);
+
+/**
+ * @brief Copy an element into the ring without blocking
+ *
+ * @param r
+ * @param elem
+ * @return int - 0 if success, else -1 if the ring is full
+ */
+int mpmc_ring_try_push(mpmc_ring_t* r, const void* elem);
+
+/**
+ * @brief Copy an element out of the ring without blocking
+ *
+ * @param r
+ * @param elem
+ * @return int - 0 if success, else -1 if the ring is empty
+ */
+int mpmc_ring_try_pop(mpmc_ring_t* r, void* elem);
+
+/**
+ * @brief Copy an element into the ring, backing off until a slot is free
+ *
+ * @param r
+ * @param elem
+ */
+void mpmc_ring_push(mpmc_ring_t* r, const void* elem);
+
+/**
+ * @brief Copy an element out of the ring, backing off until one is available
+ *
+ * @param r
+ * @param elem
+ */
+void mpmc_ring_pop(mpmc_ring_t* r, void* elem);
+
+/**
+ * @brief Copy up to `n` elements into consecutive slots of the ring without blocking
+ *
+ * @param r
+ * @param elems
+ * @param n
+ * @return size_t - the number of elements pushed
+ */
+size_t mpmc_ring_try_push_batch(mpmc_ring_t* r, const void* elems, size_t n);
+
+/**
+ * @brief Copy up to `n` elements out of consecutive slots of the ring without blocking
+ *
+ * @param r
+ * @param elems
+ * @param n
+ * @return size_t - the number of elements popped
+ */
+size_t mpmc_ring_try_pop_batch(mpmc_ring_t* r, void* elems, size_t n);
+
+/*****************************
+ *	Unrolled CircularSinglyLinkedList
+ *****************************/
+
+/* Number of values per unrolled node, such that a node spans exactly two cache lines */
+#define UCSLL_NODE_CAPACITY ((2 * CACHE_LINE_SIZE - 2 * sizeof(void*)) / sizeof(void*))
+
+/**
+ * @brief Unrolled node type; holds up to UCSLL_NODE_CAPACITY contiguous values
+ */
+typedef struct UnrolledNode {
+	struct UnrolledNode* next;
+	uint32_t count; /* Number of occupied slots in `data` */
+	void* data[UCSLL_NODE_CAPACITY];
+} UnrolledNode_t;
+
+/**
+ * @brief Unrolled CircularSinglyLinkedList type
+ *
+ * Values are addressed by position rather than by node, since a value may move between nodes when they are split or merged;
+ * as with the CSLL, tail->next == head
+ */
+typedef struct UnrolledCircularSinglyLinkedList {
+	UnrolledNode_t* head;
+	UnrolledNode_t* tail;
+	uint32_t size; /* Number of values */
+	uint32_t nodes; /* Number of nodes */
+} UnrolledCircularSinglyLinkedList;
+
+/**
+ * @brief Instantiate an empty unrolled circular singly linked list
+ *
+ * @return UnrolledCircularSinglyLinkedList*
+ */
+UnrolledCircularSinglyLinkedList* ucsll_make_list(void);
+
+/**
+ * @brief Free all nodes of the list and the list itself; values are not freed
+ *
+ * @param ll
+ */
+void ucsll_destroy_list(UnrolledCircularSinglyLinkedList* ll);
+
+/**
+ * @brief Push `value` to the back of the list
+ *
+ * @param ll
+ * @param value
+ * @return int - 0 if success, else -1
+ */
+int ucsll_push_back(UnrolledCircularSinglyLinkedList* ll, void* value);
+
+/**
+ * @brief Push `value` to the front of the list
+ *
+ * @param ll
+ * @param value
+ * @return int - 0 if success, else -1
+ */
+int ucsll_push_front(UnrolledCircularSinglyLinkedList* ll, void* value);
+
+/**
+ * @brief Remove the last value from the list
+ *
+ * @param ll
+ * @return void* - the value, or NULL if the list is empty
+ */
+void* ucsll_pop(UnrolledCircularSinglyLinkedList* ll);
+
+/**
+ * @brief Remove the first value from the list
+ *
+ * @param ll
+ * @return void* - the value, or NULL if the list is empty
+ */
+void* ucsll_pop_front(UnrolledCircularSinglyLinkedList* ll);
+
+/**
+ * @brief Returns the value at position `index`
+ *
+ * @param ll
+ * @param index
+ * @return void* - the value, or NULL if `index` is out of range
+ */
+void* ucsll_get(UnrolledCircularSinglyLinkedList* ll, uint32_t index);
+
+/**
+ * @brief Insert `value` immediately before the value at position `index`
+ *
+ * A full node is split in half to make room; `index` == size appends
+ *
+ * @param ll
+ * @param value
+ * @param index
+ * @return int - 0 if success, else -1
+ */
+int ucsll_insert_before(UnrolledCircularSinglyLinkedList* ll, void* value, uint32_t index);
+
+/**
+ * @brief Insert `value` immediately after the value at position `index`
+ *
+ * @param ll
+ * @param value
+ * @param index
+ * @return int - 0 if success, else -1
+ */
+int ucsll_insert_after(UnrolledCircularSinglyLinkedList* ll, void* value, uint32_t index);
+
+/**
+ * @brief Remove the value at position `index`
+ *
+ * A node left less than half full is merged with, or refilled from, its successor
+ *
+ * @param ll
+ * @param index
+ * @return void* - the value, or NULL if `index` is out of range
+ */
+void* ucsll_remove_at(UnrolledCircularSinglyLinkedList* ll, uint32_t index);
+
+/**
+ * @brief Iterate over the list and invoke `callback` with each value
+ *
+ * @param ll
+ * @param callback
+ */
+void ucsll_iterate(UnrolledCircularSinglyLinkedList* ll, void (*callback)(void*));
+
+/*****************************
+ *	Intrusive CircularSinglyLinkedList
+ *****************************/
+
+/**
+ * @brief Intrusive CSLL link; embed in the user's struct and recover it with GET_DATA_FROM_OFFSET
+ */
+typedef struct icsll_node {
+	struct icsll_node* next;
+	struct icsll* list; /* A pointer to the list to which the node belongs; NULL if detached */
+} icsll_node_t;
+
+/**
+ * @brief Intrusive CircularSinglyLinkedList type
+ *
+ * Mirrors the CSLL, but links nodes embedded at `offset` within the user's data, such that no operation allocates;
+ * as with the CSLL, tail->next == head
+ */
+typedef struct icsll {
+	icsll_node_t* head;
+	icsll_node_t* tail;
+	uint32_t size;
+	int offset; /* Offset of the icsll_node_t within the user's struct */
+} icsll_t;
+
+/**
+ * @brief Initialize an empty intrusive list whose links live at `offset` within each element
+ *
+ * @param ll
+ * @param offset
+ */
+void icsll_init(icsll_t* ll, int offset);
+
+/**
+ * @brief Initialize a detached link; a link must be detached before it is inserted
+ *
+ * @param node
+ */
+void icsll_node_init(icsll_node_t* node);
+
+/**
+ * @brief Push `node` to the back of the list
+ *
+ * @param ll
+ * @param node
+ * @return icsll_node_t* - the node, or NULL if it already belongs to a list
+ */
+icsll_node_t* icsll_push_back(icsll_t* ll, icsll_node_t* node);
+
+/**
+ * @brief Push `node` to the front of the list
+ *
+ * @param ll
+ * @param node
+ * @return icsll_node_t* - the node, or NULL if it already belongs to a list
+ */
+icsll_node_t* icsll_push_front(icsll_t* ll, icsll_node_t* node);
+
+/**
+ * @brief Iterate over the list and invoke `callback` with each element (i.e. the struct containing each link)
+ *
+ * @param ll
+ * @param callback
+ */
+void icsll_iterate(icsll_t* ll, void (*callback)(void*));
+
+/**
+ * @brief Returns the next list node, if extant; else, NULL
+ *
+ * @param ll
+ * @param node
+ * @return icsll_node_t*
+ */
+icsll_node_t* icsll_next(icsll_t* ll, icsll_node_t* node);
+
+/**
+ * @brief Returns the previous list node, if extant; else, NULL
+ *
+ * @param ll
+ * @param node
+ * @return icsll_node_t*
+ */
+icsll_node_t* icsll_prev(icsll_t* ll, icsll_node_t* node);
+
+/**
+ * @brief Remove a given node from the list, leaving it detached
+ *
+ * @param ll
+ * @param node
+ * @return icsll_node_t*
+ */
+icsll_node_t* icsll_remove_node(icsll_t* ll, icsll_node_t* node);
+
+/**
+ * @brief Remove the last node from the list
+ *
+ * @param ll
+ * @return icsll_node_t*
+ */
+icsll_node_t* icsll_pop(icsll_t* ll);
+
+/**
+ * @brief Remove the first node from the list in constant time
+ *
+ * @param ll
+ * @return icsll_node_t*
+ */
+icsll_node_t* icsll_pop_front(icsll_t* ll);
+
+/**
+ * @brief Insert `node` immediately after `mark`
+ *
+ * If `mark` is not an element of the list, or `node` belongs to a list, the list is not modified
+ *
+ * @param ll
+ * @param node
+ * @param mark
+ * @return icsll_node_t* - the node, or NULL if the list was not modified
+ */
+icsll_node_t* icsll_insert_after(icsll_t* ll, icsll_node_t* node, icsll_node_t* mark);
+
+/**
+ * @brief Insert `node` immediately before `mark`
+ *
+ * If `mark` is not an element of the list, or `node` belongs to a list, the list is not modified
+ *
+ * @param ll
+ * @param node
+ * @param mark
+ * @return icsll_node_t* - the node, or NULL if the list was not modified
+ */
+icsll_node_t* icsll_insert_before(icsll_t* ll, icsll_node_t* node, icsll_node_t* mark);
+
+/**
+ * @brief Move a given node to its new position before `mark`
+ *
+ * If either the given node or mark are not an element of the list; node == mark; or node.next == mark, the list is not modified
+ *
+ * @param ll
+ * @param node
+ * @param mark
+ * @return int - 0 if success, else -1
+ */
+int icsll_move_before(icsll_t* ll, icsll_node_t* node, icsll_node_t* mark);
+
+/**
+ * @brief Move a given node to its new position after `mark`
+ *
+ * If either the given node or mark are not an element of the list; node == mark; or mark.next == node, the list is not modified
+ *
+ * @param ll
+ * @param node
+ * @param mark
+ * @return int - 0 if success, else -1
+ */
+int icsll_move_after(icsll_t* ll, icsll_node_t* node, icsll_node_t* mark);
+
+/*****************************
+ *	IndexList
+ *****************************/
+
+#define ILIST_NIL UINT32_MAX
+
+/**
+ * @brief Index list node type; links are indices into the list's node array
+ *
+ * `generation` is odd while the node is in use and even while it sits on the free stack
+ */
+typedef struct IndexNode {
+	void* data;
+	uint32_t next; /* Index of the next node; while free, of the next free node */
+	uint32_t generation;
+} IndexNode_t;
+
+/**
+ * @brief Handle to an index list node; valid until the node is removed
+ */
+typedef struct IndexHandle {
+	uint32_t index;
+	uint32_t generation;
+} IndexHandle_t;
+
+/**
+ * @brief IndexList type; a circular singly linked list whose nodes live in one growable array
+ *
+ * Handles are validated against the node's generation in constant time, which stands in for the CSLL's `node->list` check;
+ * as with the CSLL, the tail's next is the head
+ */
+typedef struct IndexList {
+	IndexNode_t* nodes;
+	uint32_t capacity;
+	uint32_t used; /* Number of slots ever handed out; slots beyond are untouched */
+	uint32_t free_top; /* Top of the free-index stack, or ILIST_NIL */
+	uint32_t head;
+	uint32_t tail;
+	uint32_t size;
+} IndexList_t;
+
+/**
+ * @brief Instantiate an empty index list with room for `capacity` nodes before it must grow
+ *
+ * @param capacity
+ * @return IndexList_t*
+ */
+IndexList_t* ilist_make_list(uint32_t capacity);
+
+/**
+ * @brief Free the node array and the list itself; node data is not freed
+ *
+ * @param ll
+ */
+void ilist_destroy_list(IndexList_t* ll);
+
+/**
+ * @brief Returns 1 if `node` refers to a node currently in the list, else 0
+ *
+ * @param ll
+ * @param node
+ * @return int
+ */
+int ilist_is_valid(IndexList_t* ll, IndexHandle_t node);
+
+/**
+ * @brief Returns the data of the node referred to by `node`, or NULL if the handle is stale
+ *
+ * @param ll
+ * @param node
+ * @return void*
+ */
+void* ilist_get(IndexList_t* ll, IndexHandle_t node);
+
+/**
+ * @brief Push a new node with value `value` to the back of the list
+ *
+ * @param ll
+ * @param value
+ * @return IndexHandle_t - the new node, or a handle with index ILIST_NIL if the node array could not grow
+ */
+IndexHandle_t ilist_push_back(IndexList_t* ll, void* value);
+
+/**
+ * @brief Push a new node with value `value` to the front of the list
+ *
+ * @param ll
+ * @param value
+ * @return IndexHandle_t - the new node, or a handle with index ILIST_NIL if the node array could not grow
+ */
+IndexHandle_t ilist_push_front(IndexList_t* ll, void* value);
+
+/**
+ * @brief Iterate over the list and invoke `callback` with each node's data
+ *
+ * @param ll
+ * @param callback
+ */
+void ilist_iterate(IndexList_t* ll, void (*callback)(void*));
+
+/**
+ * @brief Returns the next list node, if extant; else, a handle with index ILIST_NIL
+ *
+ * @param ll
+ * @param node
+ * @return IndexHandle_t
+ */
+IndexHandle_t ilist_next(IndexList_t* ll, IndexHandle_t node);
+
+/**
+ * @brief Returns the previous list node, if extant; else, a handle with index ILIST_NIL
+ *
+ * @param ll
+ * @param node
+ * @return IndexHandle_t
+ */
+IndexHandle_t ilist_prev(IndexList_t* ll, IndexHandle_t node);
+
+/**
+ * @brief Remove a given node from the list, invalidating its handle
+ *
+ * @param ll
+ * @param node
+ * @return void* - the node's data, or NULL if the handle is stale
+ */
+void* ilist_remove_node(IndexList_t* ll, IndexHandle_t node);
+
+/**
+ * @brief Remove the last node from the list
+ *
+ * @param ll
+ * @return void* - the node's data, or NULL if the list is empty
+ */
+void* ilist_pop(IndexList_t* ll);
+
+/**
+ * @brief Remove the first node from the list in constant time
+ *
+ * @param ll
+ * @return void* - the node's data, or NULL if the list is empty
+ */
+void* ilist_pop_front(IndexList_t* ll);
+
+/**
+ * @brief Insert a new node with value `value` immediately after `mark`
+ *
+ * If `mark` is stale, the list is not modified
+ *
+ * @param ll
+ * @param value
+ * @param mark
+ * @return IndexHandle_t - the new node, or a handle with index ILIST_NIL
+ */
+IndexHandle_t ilist_insert_after(IndexList_t* ll, void* value, IndexHandle_t mark);
+
+/**
+ * @brief Insert a new node with value `value` immediately before `mark`
+ *
+ * If `mark` is stale, the list is not modified
+ *
+ * @param ll
+ * @param value
+ * @param mark
+ * @return IndexHandle_t - the new node, or a handle with index ILIST_NIL
+ */
+IndexHandle_t ilist_insert_before(IndexList_t* ll, void* value, IndexHandle_t mark);
+
+/**
+ * @brief Move a given node to its new position before `mark`
+ *
+ * If either handle is stale; node == mark; or node.next == mark, the list is not modified
+ *
+ * @param ll
+ * @param node
+ * @param mark
+ * @return int - 0 if success, else -1
+ */
+int ilist_move_before(IndexList_t* ll, IndexHandle_t node, IndexHandle_t mark);
+
+/**
+ * @brief Move a given node to its new position after `mark`
+ *
+ * If either handle is stale; node == mark; or mark.next == node, the list is not modified
+ *
+ * @param ll
+ * @param node
+ * @param mark
+ * @return int - 0 if success, else -1
+ */
+int ilist_move_after(IndexList_t* ll, IndexHandle_t node, IndexHandle_t mark);
+
+/**
+ * @brief Insert a copy of another list at the back of the caller list
+ *
+ * The lists may be the same, but must not be NULL
+ *
+ * @param ll
+ * @param other
+ * @return IndexList_t*
+ */
+IndexList_t* ilist_push_back_list(IndexList_t* ll, IndexList_t* other);
+
+/**
+ * @brief Insert a copy of another list at the front of the caller list
+ *
+ * The lists may be the same, but must not be NULL
+ *
+ * @param ll
+ * @param other
+ * @return IndexList_t*
+ */
+IndexList_t* ilist_push_front_list(IndexList_t* ll, IndexList_t* other);
+
+/*****************************
+ *	Snapshot
+ *****************************/
+
+#define SNAPSHOT_MAGIC "CRTLSNAP"
+#define SNAPSHOT_VERSION 1
+
+/**
+ * @brief Size of one on-disk record of `record_size` payload bytes, padded such that every record is 8-byte aligned
+ */
+#define SNAPSHOT_STRIDE(record_size) ((sizeof(SnapshotRecord_t) + (record_size) + 7) & ~(size_t)7)
+
+/**
+ * @brief Snapshot file header; the records follow it
+ */
+typedef struct SnapshotHeader {
+	char magic[8];
+	uint32_t version;
+	uint32_t record_size;
+	uint64_t count;
+	int64_t head; /* Offset of the first record from the start of the file, or 0 if empty */
+} SnapshotHeader_t;
+
+/**
+ * @brief On-disk record; links are self-relative, such that the file is position independent
+ *
+ * As with the CSLL, the last record links back to the first
+ */
+typedef struct SnapshotRecord {
+	int64_t next; /* Offset of the next record relative to this one */
+	unsigned char data[];
+} SnapshotRecord_t;
+
+/**
+ * @brief Streaming snapshot writer; records are appended one at a time, so nothing is buffered beyond a single record
+ */
+typedef struct SnapshotWriter {
+	FILE* fp;
+	unsigned char* record; /* Staging buffer for one record */
+	uint32_t record_size;
+	uint64_t count;
+} SnapshotWriter_t;
+
+/**
+ * @brief A snapshot opened for in-place traversal
+ *
+ * Where mmap is available the file is mapped copy-on-write: loading is constant time, pages are faulted in as they are
+ * traversed, and writes to records never reach the file
+ */
+typedef struct Snapshot {
+	SnapshotHeader_t* header;
+	size_t length;
+} Snapshot_t;
+
+/**
+ * @brief Create (or truncate) the snapshot file at `path` and prepare to append records of `record_size` bytes
+ *
+ * @param w
+ * @param path
+ * @param record_size
+ * @return int - 0 if success, else -1
+ */
+int snapshot_writer_open(SnapshotWriter_t* w, const char* path, uint32_t record_size);
+
+/**
+ * @brief Append a copy of the `record_size` bytes at `record`
+ *
+ * @param w
+ * @param record
+ * @return int - 0 if success, else -1
+ */
+int snapshot_writer_append(SnapshotWriter_t* w, const void* record);
+
+/**
+ * @brief Close the ring, finalize the header and close the file
+ *
+ * @param w
+ * @return int - 0 if every write succeeded, else -1
+ */
+int snapshot_writer_close(SnapshotWriter_t* w);
+
+/**
+ * @brief Write a snapshot of the list, in list order, where each node's data points to a record of `record_size` bytes
+ *
+ * @param ll
+ * @param path
+ * @param record_size
+ * @return int - 0 if success, else -1
+ */
+int csll_snapshot_save(CircularSinglyLinkedList* ll, const char* path, uint32_t record_size);
+
+/**
+ * @brief Write a snapshot of the records threaded onto the glthread at `base_glthread`, in list order
+ *
+ * Each record is the `record_size`-byte struct embedding the glthread at `offset`; the embedded glthread is
+ * zeroed in the snapshot, as its pointers would be meaningless once reloaded
+ *
+ * @param base_glthread
+ * @param offset
+ * @param path
+ * @param record_size
+ * @return int - 0 if success, else -1
+ */
+int glthread_snapshot_save(glthread_t* base_glthread, int offset, const char* path, uint32_t record_size);
+
+/**
+ * @brief Open the snapshot at `path` for in-place traversal
+ *
+ * The header is validated, as is that every record fits within the file; records' links are trusted,
+ * see `snapshot_verify`
+ *
+ * @param path
+ * @return Snapshot_t* - or NULL if the file cannot be opened or is not a valid snapshot
+ */
+Snapshot_t* snapshot_map(const char* path);
+
+/**
+ * @brief Release a snapshot; records obtained from it are invalidated
+ *
+ * @param s
+ */
+void snapshot_unmap(Snapshot_t* s);
+
+/**
+ * @brief Walk every link and check that it lands on a record within the file and that the ring closes; O(n)
+ *
+ * @param s
+ * @return int - 0 if the snapshot is well-formed, else -1
+ */
+int snapshot_verify(Snapshot_t* s);
+
+/**
+ * @brief Iterate over the snapshot's records in list order, passing each record's data to the callback
+ *
+ * @param s
+ * @param callback
+ */
+void snapshot_iterate(Snapshot_t* s, void (*callback)(void*));
+
+/**
+ * @brief Retrieve the snapshot's first record
+ *
+ * @param s
+ * @return SnapshotRecord_t* - or NULL if the snapshot is empty
+ */
+static inline SnapshotRecord_t* snapshot_head(Snapshot_t* s) {
+	if (!s->header->count) return NULL;
+
+	return (SnapshotRecord_t*)((char*)s->header + s->header->head);
+}
+
+/**
+ * @brief Follow a record's link; the last record's next is the head
+ *
+ * @param r
+ * @return SnapshotRecord_t*
+ */
+static inline SnapshotRecord_t* snapshot_next(SnapshotRecord_t* r) {
+	return (SnapshotRecord_t*)((char*)r + r->next);
+}
+
+/*****************************
+ *	Region
+ *****************************/
+
+/**
+ * @brief Self-relative pointer: the distance in bytes from the offptr itself to its target
+ *
+ * A structure linked by offptrs is position independent, and may be mapped at a different address in every process.
+ * Targets are 8-byte aligned, so the odd value OFFPTR_NULL, which no target can produce, encodes NULL; 0 is a pointer to itself
+ */
+typedef int64_t offptr_t;
+
+#define OFFPTR_NULL 1
+
+/**
+ * @brief Resolve an offptr
+ *
+ * @param p
+ * @return void* - or NULL
+ */
+static inline void* offptr_get(const offptr_t* p) {
+	return *p == OFFPTR_NULL ? NULL : (char*)p + *p;
+}
+
+/**
+ * @brief Point an offptr at `target`, which must live in the same mapping as the offptr itself
+ *
+ * @param p
+ * @param target - or NULL
+ */
+static inline void offptr_set(offptr_t* p, const void* target) {
+	*p = target ? (const char*)target - (const char*)p : OFFPTR_NULL;
+}
+
+#define REGION_MAGIC "CRTLRGN1"
+#define REGION_ALIGN 16
+
+/**
+ * @brief Region header; placed at the start of a mapping, followed by the blocks it hands out
+ *
+ * Every field is either a plain integer or an offptr, so the header is valid in every process that maps the region.
+ * The region does not synchronize; processes that modify it concurrently must coordinate
+ */
+typedef struct Region {
+	char magic[8];
+	uint64_t size; /* Size of the mapping */
+	uint64_t cursor; /* Offset of the first never-used byte */
+	offptr_t free_list; /* Freed blocks, reused for allocations of the same rounded size */
+	offptr_t root; /* Entry point, such that processes attaching to the region can find its contents */
+} Region_t;
+
+/**
+ * @brief Format the `size` bytes at `base` as an empty region
+ *
+ * @param base - REGION_ALIGN-aligned, e.g. the address returned by mmap
+ * @param size
+ * @return Region_t* - or NULL if `size` cannot hold the region header
+ */
+Region_t* region_init(void* base, size_t size);
+
+/**
+ * @brief Adopt a region that was formatted by `region_init`, possibly in another process and at another address
+ *
+ * @param base
+ * @return Region_t* - or NULL if `base` does not hold a region
+ */
+Region_t* region_attach(void* base);
+
+/**
+ * @brief Allocate `size` bytes, REGION_ALIGN-aligned, from the region
+ *
+ * @param r
+ * @param size
+ * @return void* - or NULL if the region is exhausted
+ */
+void* region_alloc(Region_t* r, size_t size);
+
+/**
+ * @brief Return a block obtained from `region_alloc` to the region
+ *
+ * @param r
+ * @param ptr
+ */
+void region_free(Region_t* r, void* ptr);
+
+/**
+ * @brief Retrieve the region's root
+ *
+ * @param r
+ * @return void* - or NULL if unset
+ */
+void* region_root(Region_t* r);
+
+/**
+ * @brief Set the region's root, which must live in the region
+ *
+ * @param r
+ * @param root
+ */
+void region_set_root(Region_t* r, void* root);
+
+/*****************************
+ *	Offset GlThread
+ *****************************/
+
+/**
+ * @brief glthread whose links are offptrs; embed in a struct that lives in a region
+ */
+typedef struct oglthread {
+	offptr_t prev;
+	offptr_t next;
+} oglthread_t;
+
+#define ITERATE_OGLTHREAD_BEGIN(oglthreadbegin, oglthreadptr) {                                   \
+	oglthread_t* _oglthread_ptr = NULL;                                                             \
+	oglthreadptr = oglthread_next(oglthreadbegin);                                                  \
+	                                                                                                \
+	for (; oglthreadptr; oglthreadptr = _oglthread_ptr) {                                           \
+		_oglthread_ptr = oglthread_next(oglthreadptr);                                                \
+
+#define ITERATE_OGLTHREAD_END(oglthreadend, oglthreadptr)                                         \
+	}}
+
+/**
+ * @brief Retrieve the next glthread
+ *
+ * @param glthread
+ * @return oglthread_t* - or NULL
+ */
+static inline oglthread_t* oglthread_next(oglthread_t* glthread) {
+	return (oglthread_t*)offptr_get(&glthread->next);
+}
+
+/**
+ * @brief Retrieve the previous glthread
+ *
+ * @param glthread
+ * @return oglthread_t* - or NULL
+ */
+static inline oglthread_t* oglthread_prev(oglthread_t* glthread) {
+	return (oglthread_t*)offptr_get(&glthread->prev);
+}
+
+/**
+ * @brief Initialize a new glthread
+ *
+ * @param glthread
+ */
+void oglthread_init(oglthread_t* glthread);
+
+/**
+ * @brief Insert a new glthread node after the given mark
+ *
+ * @param mark
+ * @param next
+ */
+void oglthread_insert_after(oglthread_t* mark, oglthread_t* next);
+
+/**
+ * @brief Insert a new glthread node before the given mark
+ *
+ * @param mark
+ * @param next
+ */
+void oglthread_insert_before(oglthread_t* mark, oglthread_t* next);
+
+/**
+ * @brief Remove the given glthread node from its list
+ *
+ * @param mark
+ */
+void oglthread_remove(oglthread_t* mark);
+
+/**
+ * @brief Append a glthread node to the end of the list
+ *
+ * @param head
+ * @param next
+ */
+void oglthread_push(oglthread_t* head, oglthread_t* next);
+
+/**
+ * @brief Delete all nodes in a given glthread
+ *
+ * @param head
+ */
+void oglthread_del_list(oglthread_t* head);
+
+/**
+ * @brief Get current size of glthread
+ *
+ * @param head
+ * @return unsigned int
+ */
+unsigned int oglthread_size(oglthread_t* head);
+
+/**
+ * @brief Prioritized insertion
+ *
+ * As with glthread_priority_insert, the node is inserted before the first node for which `comparator` returns -1,
+ * else at the tail
+ *
+ * @param head
+ * @param glthread
+ * @param comparator
+ * @param offset
+ */
+void oglthread_priority_insert(
+	oglthread_t* head,
+	oglthread_t* glthread,
+	int(*comparator)(void*, void*),
+	int offset
+);
+
+/**
+ * @brief Dequeue the head node
+ *
+ * @param head
+ * @return oglthread_t* - or NULL if the glthread is empty
+ */
+oglthread_t* oglthread_dequeue_first(oglthread_t* head);
+
+/*****************************
+ *	Offset CircularSinglyLinkedList
+ *****************************/
+
+/**
+ * @brief CSLL node whose links are offptrs; `data` must point into the region, or be NULL
+ */
+typedef struct OffsetForwardNode {
+	offptr_t data;
+	offptr_t next;
+	offptr_t list; /* The list to which the node belongs */
+} OffsetForwardNode_t;
+
+/**
+ * @brief CSLL that lives in, and allocates its nodes from, a region
+ *
+ * As with the CSLL, tail->next == head
+ */
+typedef struct OffsetCircularSinglyLinkedList {
+	offptr_t head;
+	offptr_t tail;
+	offptr_t region;
+	uint32_t size;
+} OffsetCircularSinglyLinkedList;
+
+/**
+ * @brief Instantiate an empty list in the region
+ *
+ * @param r
+ * @return OffsetCircularSinglyLinkedList* - or NULL if the region is exhausted
+ */
+OffsetCircularSinglyLinkedList* ocsll_make_list(Region_t* r);
+
+/**
+ * @brief Return all nodes of the list and the list itself to the region; node data is not freed
+ *
+ * @param ll
+ */
+void ocsll_destroy_list(OffsetCircularSinglyLinkedList* ll);
+
+/**
+ * @brief Return a node that was removed from the list to the region
+ *
+ * @param ll
+ * @param node
+ */
+void ocsll_release_node(OffsetCircularSinglyLinkedList* ll, OffsetForwardNode_t* node);
+
+/**
+ * @brief Retrieve the list's head
+ *
+ * @param ll
+ * @return OffsetForwardNode_t* - or NULL if the list is empty
+ */
+static inline OffsetForwardNode_t* ocsll_head(OffsetCircularSinglyLinkedList* ll) {
+	return (OffsetForwardNode_t*)offptr_get(&ll->head);
+}
+
+/**
+ * @brief Retrieve the node following `node`; the tail's next is the head
+ *
+ * @param node
+ * @return OffsetForwardNode_t*
+ */
+static inline OffsetForwardNode_t* ocsll_next(OffsetForwardNode_t* node) {
+	return (OffsetForwardNode_t*)offptr_get(&node->next);
+}
+
+/**
+ * @brief Retrieve the node's data
+ *
+ * @param node
+ * @return void*
+ */
+static inline void* ocsll_data(OffsetForwardNode_t* node) {
+	return offptr_get(&node->data);
+}
+
+/**
+ * @brief Push a new node with value `value` to the back of the list
+ *
+ * @param ll
+ * @param value
+ * @return OffsetForwardNode_t* - or NULL if the region is exhausted
+ */
+OffsetForwardNode_t* ocsll_push_back(OffsetCircularSinglyLinkedList* ll, void* value);
+
+/**
+ * @brief Push a new node with value `value` to the front of the list
+ *
+ * @param ll
+ * @param value
+ * @return OffsetForwardNode_t* - or NULL if the region is exhausted
+ */
+OffsetForwardNode_t* ocsll_push_front(OffsetCircularSinglyLinkedList* ll, void* value);
+
+/**
+ * @brief Iterate over the list and invoke `callback` with each node
+ *
+ * @param ll
+ * @param callback
+ */
+void ocsll_iterate(OffsetCircularSinglyLinkedList* ll, void (*callback)(void*));
+
+/**
+ * @brief Remove the given node from the list; the node is not released
+ *
+ * @param ll
+ * @param node
+ * @return OffsetForwardNode_t* - or NULL if the node is not a member of the list
+ */
+OffsetForwardNode_t* ocsll_remove_node(OffsetCircularSinglyLinkedList* ll, OffsetForwardNode_t* node);
+
+/**
+ * @brief Remove the last node from the list
+ *
+ * @param ll
+ * @return OffsetForwardNode_t* - or NULL if the list is empty
+ */
+OffsetForwardNode_t* ocsll_pop(OffsetCircularSinglyLinkedList* ll);
+
+/**
+ * @brief Remove the first node from the list in constant time
+ *
+ * @param ll
+ * @return OffsetForwardNode_t* - or NULL if the list is empty
+ */
+OffsetForwardNode_t* ocsll_pop_front(OffsetCircularSinglyLinkedList* ll);
+
+/**
+ * @brief Returns the previous list node, or NULL if the node is not a member of the list
+ *
+ * The list is singly linked, so this walks the list unless the node is the head
+ *
+ * @param ll
+ * @param node
+ * @return OffsetForwardNode_t*
+ */
+OffsetForwardNode_t* ocsll_prev(OffsetCircularSinglyLinkedList* ll, OffsetForwardNode_t* node);
+
+/**
+ * @brief Insert a new node with value `value` immediately after `mark`
+ *
+ * If `mark` is not an element of the list, the list is not modified
+ *
+ * @param ll
+ * @param value
+ * @param mark
+ * @return OffsetForwardNode_t* - or NULL if `mark` is not a member or the region is exhausted
+ */
+OffsetForwardNode_t* ocsll_insert_after(OffsetCircularSinglyLinkedList* ll, void* value, OffsetForwardNode_t* mark);
+
+/**
+ * @brief Insert a new node with value `value` immediately before `mark`
+ *
+ * If `mark` is not an element of the list, the list is not modified
+ *
+ * As with csll_insert_before, a node inserted before the head becomes the tail
+ *
+ * @param ll
+ * @param value
+ * @param mark
+ * @return OffsetForwardNode_t* - or NULL if `mark` is not a member or the region is exhausted
+ */
+OffsetForwardNode_t* ocsll_insert_before(OffsetCircularSinglyLinkedList* ll, void* value, OffsetForwardNode_t* mark);
+
+/**
+ * @brief Move a given node to its new position after `mark`
+ *
+ * If either the given node or mark are not an element of the list; node == mark; or mark.next == node, the list is not modified
+ *
+ * @param ll
+ * @param node
+ * @param mark
+ * @return int - 0 if success, else -1
+ */
+int ocsll_move_after(OffsetCircularSinglyLinkedList* ll, OffsetForwardNode_t* node, OffsetForwardNode_t* mark);
+
+/**
+ * @brief Move a given node to its new position before `mark`
+ *
+ * If either the given node or mark are not an element of the list; node == mark; or node.next == mark, the list is not modified
+ *
+ * As with csll_move_before, a node moved before the head becomes the tail
+ *
+ * @param ll
+ * @param node
+ * @param mark
+ * @return int - 0 if success, else -1
+ */
+int ocsll_move_before(OffsetCircularSinglyLinkedList* ll, OffsetForwardNode_t* node, OffsetForwardNode_t* mark);
+
+/**
+ * @brief Insert a copy of another list at the back of the caller list
+ *
+ * The lists may be the same, but must not be NULL; copies reference the same data, which must lie in `ll`'s region
+ *
+ * @param ll
+ * @param other
+ * @return OffsetCircularSinglyLinkedList*
+ */
+OffsetCircularSinglyLinkedList* ocsll_push_back_list(OffsetCircularSinglyLinkedList* ll, OffsetCircularSinglyLinkedList* other);
+
+/**
+ * @brief Insert a copy of another list at the front of the caller list
+ *
+ * The lists may be the same, but must not be NULL; copies reference the same data, which must lie in `ll`'s region
+ *
+ * @param ll
+ * @param other
+ * @return OffsetCircularSinglyLinkedList*
+ */
+OffsetCircularSinglyLinkedList* ocsll_push_front_list(OffsetCircularSinglyLinkedList* ll, OffsetCircularSinglyLinkedList* other);
+
+/*****************************
+ *	Timer Wheel
+ *****************************/
+
+#define TIMER_WHEEL_BITS 8
+#define TIMER_WHEEL_SLOTS (1 << TIMER_WHEEL_BITS)
+#define TIMER_WHEEL_LEVELS 4
+
+/**
+ * @brief Intrusive timer; embed in the user's struct and recover it with GET_DATA_FROM_OFFSET
+ */
+typedef struct wheel_timer {
+	glthread_t glthread; /* Links the timer into its slot; both links are NULL while the timer is not armed */
+	uint64_t expires; /* Tick at which the timer fires */
+} wheel_timer_t;
+
+/**
+ * @brief Hashed hierarchical timing wheel
+ *
+ * Level l holds the timers due within 2^(8(l+1)) ticks, hashed by bits 8l..8l+7 of their expiry; each time the level
+ * below wraps, one slot is cascaded down a level. Timers due beyond the top level's range wait in it, and are
+ * re-hashed until they are in range
+ */
+typedef struct timer_wheel {
+	glthread_t slots[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS]; /* Sentinel heads */
+	uint64_t now; /* Next tick to be processed */
+	size_t size; /* Number of armed timers */
+} timer_wheel_t;
+
+/**
+ * @brief Initialize a new, empty timing wheel whose next tick is `now`
+ *
+ * @param w
+ * @param now
+ */
+void timer_wheel_init(timer_wheel_t* w, uint64_t now);
+
+/**
+ * @brief Initialize a new, unarmed timer
+ *
+ * @param t
+ */
+void wheel_timer_init(wheel_timer_t* t);
+
+/**
+ * @brief Determine whether the timer is armed
+ *
+ * @param t
+ * @return int - 1 if armed, else 0
+ */
+static inline int wheel_timer_is_armed(wheel_timer_t* t) {
+	return t->glthread.prev != NULL;
+}
+
+/**
+ * @brief Arm the timer to fire at tick `expires` in constant time, re-arming it if it is already armed
+ *
+ * A timer due at or before the wheel's next tick fires on that tick
+ *
+ * @param w
+ * @param t
+ * @param expires
+ */
+void timer_wheel_arm(timer_wheel_t* w, wheel_timer_t* t, uint64_t expires);
+
+/**
+ * @brief Disarm the timer in constant time
+ *
+ * @param w
+ * @param t
+ * @return int - 0 if the timer was armed, else -1
+ */
+int timer_wheel_cancel(timer_wheel_t* w, wheel_timer_t* t);
+
+/**
+ * @brief Process every tick up to and including `now`, firing the timers that expire
+ *
+ * Each tick's timers are detached from their slot in one step and fired as a batch; every timer is disarmed before
+ * `callback` is invoked with it, so the callback may re-arm it, or arm or cancel any other timer
+ *
+ * @param w
+ * @param now
+ * @param callback
+ * @param ctx
+ * @return size_t - the number of timers fired
+ */
+size_t timer_wheel_advance(timer_wheel_t* w, uint64_t now, void (*callback)(wheel_timer_t*, void*), void* ctx);
+
+/*****************************
+ *	GlThread Hash
+ *****************************/
+
+/**
+ * @brief Intrusive chained hash table whose buckets are glthread chains
+ *
+ * Objects embed a `glthread_t` at `offset` and a key at `key_offset`; `hash` and `eq` operate on keys. The table
+ * grows by doubling once it holds as many objects as buckets. Rather than rehashing at once, each subsequent insert
+ * or removal migrates a few buckets of the old table, and lookups consult whichever table holds the key's bucket
+ */
+typedef struct glthread_hash {
+	glthread_t* buckets; /* Sentinel heads */
+	glthread_t* old_buckets; /* Table being migrated from, with 2^(bits - 1) buckets, or NULL */
+	unsigned int bits; /* The table has 2^bits buckets */
+	size_t migrated; /* Number of old buckets migrated so far */
+	size_t size;
+	uint64_t (*hash)(const void* key);
+	int (*eq)(const void* a, const void* b); /* Nonzero if the keys are equal */
+	int offset;
+	int key_offset;
+} glthread_hash_t;
+
+/**
+ * @brief Initialize a new, empty hash table with room for `capacity` objects before it must grow
+ *
+ * @param h
+ * @param capacity
+ * @param hash
+ * @param eq
+ * @param offset - offset of the glthread within the object
+ * @param key_offset - offset of the key within the object
+ * @return int - 0 if success, else -1
+ */
+int glthread_hash_init(
+	glthread_hash_t* h,
+	size_t capacity,
+	uint64_t (*hash)(const void* key),
+	int (*eq)(const void* a, const void* b),
+	int offset,
+	int key_offset
+);
+
+/**
+ * @brief Free the table's buckets; the objects are not freed, and their glthreads are left as they were
+ *
+ * @param h
+ */
+void glthread_hash_destroy(glthread_hash_t* h);
+
+/**
+ * @brief Insert the object embedding `glthread`
+ *
+ * If the table cannot grow, the object is inserted regardless and the table is left to exceed its load factor
+ *
+ * @param h
+ * @param glthread
+ * @return int - 0 if success, or -1 if an object with an equal key is present
+ */
+int glthread_hash_insert(glthread_hash_t* h, glthread_t* glthread);
+
+/**
+ * @brief Find the object with the given key
+ *
+ * @param h
+ * @param key
+ * @return void* - the object, or NULL if not present
+ */
+void* glthread_hash_find(glthread_hash_t* h, const void* key);
+
+/**
+ * @brief Remove the object with the given key
+ *
+ * @param h
+ * @param key
+ * @return void* - the object, or NULL if not present
+ */
+void* glthread_hash_remove(glthread_hash_t* h, const void* key);
+
+/**
+ * @brief Remove the object embedding `glthread`, which must be in the table, without a lookup
+ *
+ * @param h
+ * @param glthread
+ */
+void glthread_hash_remove_node(glthread_hash_t* h, glthread_t* glthread);
+
+/**
+ * @brief Iterate over the table's objects, in no particular order
+ *
+ * @param h
+ * @param callback
+ */
+void glthread_hash_iterate(glthread_hash_t* h, void (*callback)(void*));
+
+/**
+ * @brief Get current size of the table
+ *
+ * @param h
+ * @return size_t
+ */
+size_t glthread_hash_size(glthread_hash_t* h);
+
+/*****************************
+ *	Work-Stealing Deque
+ *****************************/
+
+/**
+ * @brief Circular array backing a work-stealing deque
+ * @private
+ */
+typedef struct ws_deque_array {
+	struct ws_deque_array* retired; /* The array this one replaced */
+	int64_t mask; /* Capacity - 1; capacity is a power of two */
+	_Atomic(void*) slots[];
+} ws_deque_array_t;
+
+/**
+ * @brief Lock-free work-stealing deque of non-NULL pointers (Chase-Lev, with the C11 orderings of Le et al.)
+ *
+ * The owning thread pushes and pops at the bottom, LIFO; any other thread steals from the top, FIFO. The array
+ * doubles when full. Thieves may still be reading an array after it is replaced, so replaced arrays are kept until
+ * the deque is destroyed
+ */
+typedef struct ws_deque {
+	_Alignas(CACHE_LINE_SIZE) _Atomic(int64_t) top;
+	_Alignas(CACHE_LINE_SIZE) _Atomic(int64_t) bottom;
+	_Atomic(ws_deque_array_t*) array;
+} ws_deque_t;
+
+/**
+ * @brief Instantiate an empty deque with room for at least `capacity` elements before it must grow
+ *
+ * @param capacity
+ * @return ws_deque_t* - or NULL if allocation failed, or if `capacity` exceeds the largest power of two whose slots
+ * fit in a size_t
+ */
+ws_deque_t* ws_deque_make(size_t capacity);
+
+/**
+ * @brief Free the deque and every array it has used; no thread may be using it
+ *
+ * @param d
+ */
+void ws_deque_destroy(ws_deque_t* d);
+
+/**
+ * @brief Push an element onto the bottom of the deque; owner only
+ *
+ * @param d
+ * @param elem - must not be NULL
+ * @return int - 0 if success, else -1 if the deque was full and could not grow
+ */
+int ws_deque_push(ws_deque_t* d, void* elem);
+
+/**
+ * @brief Pop the most recently pushed element from the bottom of the deque; owner only
+ *
+ * @param d
+ * @return void* - the element, or NULL if the deque is empty or a thief took the last element
+ */
+void* ws_deque_pop(ws_deque_t* d);
+
+/**
+ * @brief Steal the least recently pushed element from the top of the deque; any thread
+ *
+ * @param d
+ * @return void* - the element, or NULL if the deque is empty or another thread took the element first
+ */
+void* ws_deque_steal(ws_deque_t* d);
+
+/**
+ * @brief Approximate number of elements in the deque; exact only while no other thread is using it
+ *
+ * @param d
+ * @return size_t
+ */
+size_t ws_deque_size(ws_deque_t* d);
+
+/*****************************
+ *	DRR Scheduler
+ *****************************/
+
+/**
+ * @brief Scheduler member; a handle owned by the scheduler, valid from drr_add until drr_remove
+ */
+typedef struct drr_member {
+	void* data;
+	uint32_t quantum; /* Picks granted per round; changes take effect from the member's next round */
+	uint32_t deficit; /* Picks left in the member's current round */
+	ForwardNode_t* node; /* The member's node in the ring */
+	int removed; /* Set by drr_remove; the member is unlinked and freed once the scheduler's cursor reaches it */
+} drr_member_t;
+
+/**
+ * @brief Deficit round-robin scheduler over a ring of weighted members
+ *
+ * Each time the cursor reaches a member, the member is granted `quantum` picks, which it then receives consecutively.
+ * Members live in a CircularSinglyLinkedList whose nodes, like the members themselves, come from NodePools
+ */
+typedef struct drr_scheduler {
+	CircularSinglyLinkedList* ring;
+	csll_rr_cursor_t cursor;
+	NodePool_t* members;
+	uint32_t size; /* Number of members not pending removal */
+} drr_scheduler_t;
+
+/**
+ * @brief Instantiate an empty scheduler
+ *
+ * @return drr_scheduler_t* - NULL if allocation failed
+ */
+drr_scheduler_t* drr_make(void);
+
+/**
+ * @brief Free the scheduler along with its members; member data is not freed
+ *
+ * @param s
+ */
+void drr_destroy(drr_scheduler_t* s);
+
+/**
+ * @brief Add a member holding `data` at the tail of the ring in constant time
+ *
+ * @param s
+ * @param data
+ * @param quantum - picks per round; must be at least 1
+ * @return drr_member_t* - the member's handle, or NULL if `quantum` is 0 or allocation failed
+ */
+drr_member_t* drr_add(drr_scheduler_t* s, void* data, uint32_t quantum);
+
+/**
+ * @brief Remove a member in constant time, invalidating its handle
+ *
+ * The last member picked is unlinked immediately; any other member is marked and unlinked when the cursor reaches it,
+ * such that the work is amortized over picks
+ *
+ * @param s
+ * @param m
+ * @return int - 0 if success, else -1 if the member is already pending removal
+ */
+int drr_remove(drr_scheduler_t* s, drr_member_t* m);
+
+/**
+ * @brief Pick the next member in amortized constant time
+ *
+ * @param s
+ * @return drr_member_t* - the member, or NULL if the scheduler is empty
+ */
+drr_member_t* drr_pick(drr_scheduler_t* s);
+
+/**
+ * @brief Pick up to `n` members into `out`, as would `n` calls to drr_pick
+ *
+ * @param s
+ * @param out
+ * @param n
+ * @return uint32_t - the number of members picked; 0 if the scheduler is empty, else `n`
+ */
+uint32_t drr_pick_batch(drr_scheduler_t* s, drr_member_t** out, uint32_t n);
+
+/**
+ * @brief Get the number of members, excluding those pending removal
+ *
+ * @param s
+ * @return uint32_t
+ */
+uint32_t drr_size(drr_scheduler_t* s);
 
 #endif
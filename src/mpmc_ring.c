@@ -0,0 +1,267 @@
+/**
+ * @file mpmc_ring.c
+ * @author Matthew Zito (goldmund@freenode)
+ * @brief Implements a bounded lock-free multi-producer multi-consumer ring
+ * @version 0.1
+ * @date 2021-07-11
+ *
+ * @copyright Copyright (c) 2021 Matthew Zito (goldmund)
+ *
+ */
+
+#include "libcartilage.h"
+
+#include <stdalign.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#define __mpmc_ring_yield() SwitchToThread()
+#else
+#include <sched.h>
+#define __mpmc_ring_yield() sched_yield()
+#endif
+
+#define MPMC_RING_SPIN_LIMIT 64
+
+/* The largest power of two representable in a size_t */
+#define MPMC_RING_MAX_POW2 ((SIZE_MAX >> 1) + 1)
+
+/**
+ * @brief Slot header; the element follows at MPMC_RING_HEADER_SIZE
+ * @private
+ */
+typedef struct mpmc_cell {
+	_Atomic(size_t) seq;
+} mpmc_cell_t;
+
+#define MPMC_RING_HEADER_SIZE \
+	((sizeof(mpmc_cell_t) + alignof(max_align_t) - 1) & ~(alignof(max_align_t) - 1))
+
+/**
+ * @brief Get the cell for position `pos`
+ * @private
+ *
+ * @param r
+ * @param pos
+ * @return mpmc_cell_t*
+ */
+mpmc_cell_t* __mpmc_ring_cell(mpmc_ring_t* r, size_t pos) {
+	return (mpmc_cell_t*)(r->cells + (pos & r->mask) * r->cell_size);
+}
+
+/**
+ * @brief Spin briefly, then yield the processor; `spins` tracks the number of failed attempts
+ * @private
+ *
+ * @param spins
+ */
+void __mpmc_ring_backoff(unsigned int* spins) {
+	if (*spins < MPMC_RING_SPIN_LIMIT) {
+		for (unsigned int i = 0; i < (1u << (*spins / 8)); i++) {
+			atomic_signal_fence(memory_order_seq_cst);
+		}
+
+		(*spins)++;
+	} else {
+		__mpmc_ring_yield();
+	}
+}
+
+/**
+ * @brief Claim up to `n` consecutive positions whose cells are in the state expected for `offset`
+ * @private
+ *
+ * A cell at position `pos` is free for producers if its sequence number is `pos`, and full for consumers
+ * if it is `pos + 1`; the claim succeeds for the leading run of cells in the expected state
+ *
+ * @param r
+ * @param counter - enqueue_pos or dequeue_pos
+ * @param offset - 0 for producers, 1 for consumers
+ * @param n
+ * @param pos - set to the first claimed position
+ * @return size_t - the number of positions claimed
+ */
+size_t __mpmc_ring_claim(mpmc_ring_t* r, _Atomic(size_t)* counter, size_t offset, size_t n, size_t* pos) {
+	size_t p = atomic_load_explicit(counter, memory_order_relaxed);
+
+	for (;;) {
+		size_t k = 0;
+		int stale = 0;
+
+		while (k < n) {
+			size_t seq = atomic_load_explicit(&__mpmc_ring_cell(r, p + k)->seq, memory_order_acquire);
+			intptr_t diff = (intptr_t)seq - (intptr_t)(p + k + offset);
+
+			if (diff == 0) {
+				k++;
+				continue;
+			}
+
+			// another thread claimed position p first
+			stale = diff > 0 && k == 0;
+			break;
+		}
+
+		if (stale) {
+			p = atomic_load_explicit(counter, memory_order_relaxed);
+			continue;
+		}
+
+		if (k == 0) return 0;
+
+		if (atomic_compare_exchange_weak_explicit(counter, &p, p + k, memory_order_relaxed, memory_order_relaxed)) {
+			*pos = p;
+			return k;
+		}
+	}
+}
+
+/**
+ * @brief Instantiate a ring of at least `capacity` slots of `elem_size` bytes; capacity is rounded up to a power of two
+ *
+ * @param capacity
+ * @param elem_size
+ * @return mpmc_ring_t* - or NULL if allocation failed, or if the rounded capacity or the slots' size overflows a size_t
+ */
+mpmc_ring_t* mpmc_ring_make(size_t capacity, size_t elem_size) {
+	// rounding up past the largest power of two would never terminate
+	if (capacity > MPMC_RING_MAX_POW2) return NULL;
+
+	// nor may padding the element out to a cell wrap around
+	if (elem_size > SIZE_MAX - MPMC_RING_HEADER_SIZE - (alignof(max_align_t) - 1)) return NULL;
+
+	// a single slot could not distinguish full from empty across laps
+	size_t cap = 2;
+	while (cap < capacity) cap <<= 1;
+
+	size_t cell_size = (MPMC_RING_HEADER_SIZE + elem_size + alignof(max_align_t) - 1) & ~(alignof(max_align_t) - 1);
+
+	if (cap > SIZE_MAX / cell_size) return NULL;
+
+	mpmc_ring_t* r = aligned_alloc(CACHE_LINE_SIZE, sizeof(mpmc_ring_t));
+
+	if (!r) return NULL;
+
+	r->capacity = cap;
+	r->mask = cap - 1;
+	r->elem_size = elem_size;
+	r->cell_size = cell_size;
+	r->cells = malloc(cap * cell_size);
+
+	if (!r->cells) {
+		free(r);
+		return NULL;
+	}
+
+	for (size_t i = 0; i < cap; i++) {
+		atomic_init(&__mpmc_ring_cell(r, i)->seq, i);
+	}
+
+	atomic_init(&r->enqueue_pos, 0);
+	atomic_init(&r->dequeue_pos, 0);
+
+	return r;
+}
+
+/**
+ * @brief Free the ring and its slots
+ *
+ * @param r
+ */
+void mpmc_ring_destroy(mpmc_ring_t* r) {
+	free(r->cells);
+	free(r);
+}
+
+/**
+ * @brief Copy up to `n` elements into consecutive slots of the ring without blocking
+ *
+ * @param r
+ * @param elems
+ * @param n
+ * @return size_t - the number of elements pushed
+ */
+size_t mpmc_ring_try_push_batch(mpmc_ring_t* r, const void* elems, size_t n) {
+	size_t pos;
+	size_t k = __mpmc_ring_claim(r, &r->enqueue_pos, 0, n, &pos);
+
+	for (size_t i = 0; i < k; i++) {
+		mpmc_cell_t* cell = __mpmc_ring_cell(r, pos + i);
+
+		memcpy((char*)cell + MPMC_RING_HEADER_SIZE, (const char*)elems + i * r->elem_size, r->elem_size);
+		atomic_store_explicit(&cell->seq, pos + i + 1, memory_order_release);
+	}
+
+	return k;
+}
+
+/**
+ * @brief Copy up to `n` elements out of consecutive slots of the ring without blocking
+ *
+ * @param r
+ * @param elems
+ * @param n
+ * @return size_t - the number of elements popped
+ */
+size_t mpmc_ring_try_pop_batch(mpmc_ring_t* r, void* elems, size_t n) {
+	size_t pos;
+	size_t k = __mpmc_ring_claim(r, &r->dequeue_pos, 1, n, &pos);
+
+	for (size_t i = 0; i < k; i++) {
+		mpmc_cell_t* cell = __mpmc_ring_cell(r, pos + i);
+
+		memcpy((char*)elems + i * r->elem_size, (char*)cell + MPMC_RING_HEADER_SIZE, r->elem_size);
+		// mark the cell free for the producer of the next lap
+		atomic_store_explicit(&cell->seq, pos + i + r->capacity, memory_order_release);
+	}
+
+	return k;
+}
+
+/**
+ * @brief Copy an element into the ring without blocking
+ *
+ * @param r
+ * @param elem
+ * @return int - 0 if success, else -1 if the ring is full
+ */
+int mpmc_ring_try_push(mpmc_ring_t* r, const void* elem) {
+	return mpmc_ring_try_push_batch(r, elem, 1) ? 0 : -1;
+}
+
+/**
+ * @brief Copy an element out of the ring without blocking
+ *
+ * @param r
+ * @param elem
+ * @return int - 0 if success, else -1 if the ring is empty
+ */
+int mpmc_ring_try_pop(mpmc_ring_t* r, void* elem) {
+	return mpmc_ring_try_pop_batch(r, elem, 1) ? 0 : -1;
+}
+
+/**
+ * @brief Copy an element into the ring, backing off until a slot is free
+ *
+ * @param r
+ * @param elem
+ */
+void mpmc_ring_push(mpmc_ring_t* r, const void* elem) {
+	unsigned int spins = 0;
+
+	while (mpmc_ring_try_push(r, elem) == -1) __mpmc_ring_backoff(&spins);
+}
+
+/**
+ * @brief Copy an element out of the ring, backing off until one is available
+ *
+ * @param r
+ * @param elem
+ */
+void mpmc_ring_pop(mpmc_ring_t* r, void* elem) {
+	unsigned int spins = 0;
+
+	while (mpmc_ring_try_pop(r, elem) == -1) __mpmc_ring_backoff(&spins);
+}
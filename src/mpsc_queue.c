@@ -0,0 +1,119 @@
+/**
+ * @file mpsc_queue.c
+ * @author Matthew Zito (goldmund@freenode)
+ * @brief Implements a lock-free intrusive multi-producer single-consumer queue
+ * @version 0.1
+ * @date 2021-07-11
+ *
+ * @copyright Copyright (c) 2021 Matthew Zito (goldmund)
+ *
+ */
+
+#include "libcartilage.h"
+
+#include <stdlib.h>
+
+/**
+ * @brief Initialize a new, empty queue
+ *
+ * @param q
+ */
+void mpsc_queue_init(mpsc_queue_t* q) {
+	atomic_init(&q->stub.next, NULL);
+	atomic_init(&q->head, &q->stub);
+	q->tail = &q->stub;
+}
+
+/**
+ * @brief Push a node onto the queue; wait-free and safe to call from any thread
+ *
+ * Between the exchange and the store the chain is briefly broken; the consumer treats that window as empty
+ *
+ * @param q
+ * @param node
+ */
+void mpsc_queue_push(mpsc_queue_t* q, mpsc_node_t* node) {
+	atomic_store_explicit(&node->next, NULL, memory_order_relaxed);
+
+	mpsc_node_t* prev = atomic_exchange_explicit(&q->head, node, memory_order_acq_rel);
+
+	atomic_store_explicit(&prev->next, node, memory_order_release);
+}
+
+/**
+ * @brief Pop the oldest node from the queue; consumer only
+ *
+ * Returns NULL if the queue is empty or if the next node is still being linked by a producer
+ *
+ * @param q
+ * @return mpsc_node_t*
+ */
+mpsc_node_t* mpsc_queue_pop(mpsc_queue_t* q) {
+	mpsc_node_t* tail = q->tail;
+	mpsc_node_t* next = atomic_load_explicit(&tail->next, memory_order_acquire);
+
+	// skip over the stub
+	if (tail == &q->stub) {
+		if (!next) return NULL;
+
+		q->tail = next;
+		tail = next;
+		next = atomic_load_explicit(&next->next, memory_order_acquire);
+	}
+
+	if (next) {
+		q->tail = next;
+		return tail;
+	}
+
+	mpsc_node_t* head = atomic_load_explicit(&q->head, memory_order_acquire);
+
+	// a producer has swapped head but not yet linked its node
+	if (tail != head) return NULL;
+
+	// `tail` is the last node; re-push the stub such that `tail` gains a successor
+	mpsc_queue_push(q, &q->stub);
+
+	next = atomic_load_explicit(&tail->next, memory_order_acquire);
+
+	if (next) {
+		q->tail = next;
+		return tail;
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Pop up to `max` nodes into `nodes`; consumer only
+ *
+ * @param q
+ * @param nodes
+ * @param max
+ * @return unsigned int - the number of nodes popped
+ */
+unsigned int mpsc_queue_pop_batch(mpsc_queue_t* q, mpsc_node_t** nodes, unsigned int max) {
+	unsigned int n = 0;
+
+	while (n < max) {
+		mpsc_node_t* node = mpsc_queue_pop(q);
+
+		if (!node) break;
+
+		nodes[n++] = node;
+	}
+
+	return n;
+}
+
+/**
+ * @brief Whether the queue is empty; consumer only
+ *
+ * @param q
+ * @return int
+ */
+int mpsc_queue_is_empty(mpsc_queue_t* q) {
+	return q->tail == &q->stub
+		&& !atomic_load_explicit(&q->stub.next, memory_order_acquire)
+		&& atomic_load_explicit(&q->head, memory_order_acquire) == &q->stub;
+}
@@ -0,0 +1,147 @@
+/**
+ * @file node_pool.c
+ * @author Matthew Zito (goldmund@freenode)
+ * @brief Implements a slab pool for fixed-size list nodes
+ * @version 0.1
+ * @date 2021-07-11
+ *
+ * @copyright Copyright (c) 2021 Matthew Zito (goldmund)
+ *
+ */
+
+#include "libcartilage.h"
+
+#include <stdalign.h>
+#include <stdlib.h>
+
+/**
+ * @brief Size of the chunk header, padded such that the nodes which follow it are maximally aligned
+ * @private
+ */
+#define NODE_POOL_HEADER_SIZE \
+	((sizeof(NodePoolChunk_t) + alignof(max_align_t) - 1) & ~(alignof(max_align_t) - 1))
+
+/**
+ * @brief NodeAllocator_t adapters
+ * @private
+ */
+void* __node_pool_alloc(void* ctx, size_t size) {
+	(void)size;
+	return node_pool_alloc(ctx);
+}
+
+void __node_pool_free(void* ctx, void* ptr) {
+	node_pool_free(ctx, ptr);
+}
+
+void __node_pool_release(void* ctx) {
+	node_pool_destroy(ctx);
+}
+
+/**
+ * @brief Allocate a new chunk and make it the bump allocation target
+ * @private
+ *
+ * @param pool
+ * @return int - 0 if success, else -1
+ */
+int __node_pool_grow(NodePool_t* pool) {
+	NodePoolChunk_t* chunk = malloc(NODE_POOL_HEADER_SIZE + pool->node_size * pool->chunk_size);
+
+	if (!chunk) return -1;
+
+	chunk->next = pool->chunks;
+	pool->chunks = chunk;
+
+	pool->cursor = (char*)chunk + NODE_POOL_HEADER_SIZE;
+	pool->end = pool->cursor + pool->node_size * pool->chunk_size;
+
+	return 0;
+}
+
+/**
+ * @brief Instantiate a node pool for nodes of `node_size` bytes, allocating `chunk_size` nodes at a time
+ *
+ * @param node_size
+ * @param chunk_size
+ * @return NodePool_t*
+ */
+NodePool_t* node_pool_make(size_t node_size, size_t chunk_size) {
+	NodePool_t* pool = malloc(sizeof(NodePool_t));
+
+	if (!pool) return NULL;
+
+	// free slots store the free list link in place
+	if (node_size < sizeof(void*)) node_size = sizeof(void*);
+
+	pool->node_size = (node_size + alignof(max_align_t) - 1) & ~(alignof(max_align_t) - 1);
+	pool->chunk_size = chunk_size ? chunk_size : 1;
+	pool->chunks = NULL;
+	pool->free_list = NULL;
+	pool->cursor = NULL;
+	pool->end = NULL;
+
+	pool->allocator.alloc = __node_pool_alloc;
+	pool->allocator.free = __node_pool_free;
+	pool->allocator.release = __node_pool_release;
+	pool->allocator.ctx = pool;
+
+	return pool;
+}
+
+/**
+ * @brief Take a node from the pool
+ *
+ * Recycled nodes are preferred; otherwise the node is carved from the newest chunk
+ *
+ * @param pool
+ * @return void*
+ */
+void* node_pool_alloc(NodePool_t* pool) {
+	if (pool->free_list) {
+		void* node = pool->free_list;
+		pool->free_list = *(void**)node;
+
+		return node;
+	}
+
+	if (pool->cursor == pool->end && __node_pool_grow(pool) == -1) {
+		return NULL;
+	}
+
+	void* node = pool->cursor;
+	pool->cursor += pool->node_size;
+
+	return node;
+}
+
+/**
+ * @brief Return a node to the pool for reuse
+ *
+ * @param pool
+ * @param node
+ */
+void node_pool_free(NodePool_t* pool, void* node) {
+	if (!node) return;
+
+	*(void**)node = pool->free_list;
+	pool->free_list = node;
+}
+
+/**
+ * @brief Free every chunk and the pool itself in O(chunks)
+ *
+ * @param pool
+ */
+void node_pool_destroy(NodePool_t* pool) {
+	NodePoolChunk_t* chunk = pool->chunks;
+
+	while (chunk) {
+		NodePoolChunk_t* next = chunk->next;
+
+		free(chunk);
+		chunk = next;
+	}
+
+	free(pool);
+}
@@ -0,0 +1,420 @@
+/**
+ * @file offset_csll.c
+ * @author Matthew Zito (goldmund@freenode)
+ * @brief Implements a Circular Singly Linked List that lives in a region and is linked by self-relative offsets
+ * @version 0.1
+ * @date 2021-07-11
+ *
+ * @copyright Copyright (c) 2021 Matthew Zito (goldmund)
+ *
+ */
+
+#include "libcartilage.h"
+
+/**
+ * @brief Allocate a node from the list's region
+ * @private
+ *
+ * @param ll
+ * @param value
+ * @return OffsetForwardNode_t* - or NULL if the region is exhausted
+ */
+OffsetForwardNode_t* __ocsll_alloc_node(OffsetCircularSinglyLinkedList* ll, void* value) {
+	OffsetForwardNode_t* n = region_alloc(offptr_get(&ll->region), sizeof(OffsetForwardNode_t));
+
+	if (!n) return NULL;
+
+	offptr_set(&n->data, value);
+	offptr_set(&n->next, NULL);
+	offptr_set(&n->list, ll);
+
+	return n;
+}
+
+/**
+ * @brief Bootstrap a new head node
+ * @private
+ *
+ * @param ll
+ * @param n
+ * @return OffsetForwardNode_t*
+ */
+OffsetForwardNode_t* __ocsll_new_head(OffsetCircularSinglyLinkedList* ll, OffsetForwardNode_t* n) {
+	offptr_set(&ll->head, n);
+	offptr_set(&ll->tail, n);
+	offptr_set(&n->next, n);
+
+	ll->size++;
+
+	return n;
+}
+
+/**
+ * @brief Link a new node between the tail and the head
+ * @private
+ *
+ * @param ll
+ * @param n
+ */
+void __ocsll_link_at_end(OffsetCircularSinglyLinkedList* ll, OffsetForwardNode_t* n) {
+	OffsetForwardNode_t* tail = offptr_get(&ll->tail);
+
+	offptr_set(&n->next, offptr_get(&ll->head));
+	offptr_set(&tail->next, n);
+
+	ll->size++;
+}
+
+/**
+ * @brief Find the node prior to the given target
+ * @private
+ *
+ * The node before the head is the tail, which is resolved in constant time; any other target requires a walk from the
+ * head
+ *
+ * @param ll
+ * @param target
+ * @return OffsetForwardNode_t*
+ */
+OffsetForwardNode_t* __ocsll_find_node_before(OffsetCircularSinglyLinkedList* ll, OffsetForwardNode_t* target) {
+	OffsetForwardNode_t* tmp = ocsll_head(ll);
+
+	if (target == tmp) return offptr_get(&ll->tail);
+
+	while (ocsll_next(tmp) != target) tmp = ocsll_next(tmp);
+
+	return tmp;
+}
+
+/**
+ * @brief Move given node after `at`, where `node` and `at` must be a member of the list
+ * @private
+ *
+ * @param ll
+ * @param node
+ * @param at
+ */
+void __ocsll_move(OffsetCircularSinglyLinkedList* ll, OffsetForwardNode_t* node, OffsetForwardNode_t* at) {
+	OffsetForwardNode_t* tmp = __ocsll_find_node_before(ll, node);
+
+	if (node == ocsll_head(ll)) offptr_set(&ll->head, ocsll_next(node));
+	if (node == offptr_get(&ll->tail)) offptr_set(&ll->tail, tmp);
+
+	offptr_set(&tmp->next, ocsll_next(node));
+	offptr_set(&node->next, ocsll_next(at));
+	offptr_set(&at->next, node);
+
+	if (at == offptr_get(&ll->tail)) offptr_set(&ll->tail, node);
+}
+
+/**
+ * @brief Whether the node is a member of the list
+ * @private
+ *
+ * @param ll
+ * @param node
+ * @return int
+ */
+int __ocsll_is_member(OffsetCircularSinglyLinkedList* ll, OffsetForwardNode_t* node) {
+	return node && offptr_get(&node->list) == ll;
+}
+
+/**
+ * @brief Instantiate an empty list in the region
+ *
+ * @param r
+ * @return OffsetCircularSinglyLinkedList* - or NULL if the region is exhausted
+ */
+OffsetCircularSinglyLinkedList* ocsll_make_list(Region_t* r) {
+	OffsetCircularSinglyLinkedList* ll = region_alloc(r, sizeof(OffsetCircularSinglyLinkedList));
+
+	if (!ll) return NULL;
+
+	offptr_set(&ll->head, NULL);
+	offptr_set(&ll->tail, NULL);
+	offptr_set(&ll->region, r);
+	ll->size = 0;
+
+	return ll;
+}
+
+/**
+ * @brief Return all nodes of the list and the list itself to the region; node data is not freed
+ *
+ * @param ll
+ */
+void ocsll_destroy_list(OffsetCircularSinglyLinkedList* ll) {
+	Region_t* r = offptr_get(&ll->region);
+	OffsetForwardNode_t* n = ocsll_head(ll);
+
+	for (uint32_t i = 0; i < ll->size; i++) {
+		OffsetForwardNode_t* next = ocsll_next(n);
+
+		region_free(r, n);
+		n = next;
+	}
+
+	region_free(r, ll);
+}
+
+/**
+ * @brief Return a node that was removed from the list to the region
+ *
+ * @param ll
+ * @param node
+ */
+void ocsll_release_node(OffsetCircularSinglyLinkedList* ll, OffsetForwardNode_t* node) {
+	region_free(offptr_get(&ll->region), node);
+}
+
+/**
+ * @brief Push a new node with value `value` to the back of the list
+ *
+ * @param ll
+ * @param value
+ * @return OffsetForwardNode_t* - or NULL if the region is exhausted
+ */
+OffsetForwardNode_t* ocsll_push_back(OffsetCircularSinglyLinkedList* ll, void* value) {
+	OffsetForwardNode_t* n = __ocsll_alloc_node(ll, value);
+
+	if (!n) return NULL;
+
+	if (!ll->size) return __ocsll_new_head(ll, n);
+
+	__ocsll_link_at_end(ll, n);
+	offptr_set(&ll->tail, n);
+
+	return n;
+}
+
+/**
+ * @brief Push a new node with value `value` to the front of the list
+ *
+ * @param ll
+ * @param value
+ * @return OffsetForwardNode_t* - or NULL if the region is exhausted
+ */
+OffsetForwardNode_t* ocsll_push_front(OffsetCircularSinglyLinkedList* ll, void* value) {
+	OffsetForwardNode_t* n = __ocsll_alloc_node(ll, value);
+
+	if (!n) return NULL;
+
+	if (!ll->size) return __ocsll_new_head(ll, n);
+
+	__ocsll_link_at_end(ll, n);
+	offptr_set(&ll->head, n);
+
+	return n;
+}
+
+/**
+ * @brief Iterate over the list and invoke `callback` with each node
+ *
+ * @param ll
+ * @param callback
+ */
+void ocsll_iterate(OffsetCircularSinglyLinkedList* ll, void (*callback)(void*)) {
+	OffsetForwardNode_t* n = ocsll_head(ll);
+
+	for (uint32_t i = 0; i < ll->size; i++, n = ocsll_next(n)) callback(n);
+}
+
+/**
+ * @brief Remove the given node from the list; the node is not released
+ *
+ * @param ll
+ * @param node
+ * @return OffsetForwardNode_t* - or NULL if the node is not a member of the list
+ */
+OffsetForwardNode_t* ocsll_remove_node(OffsetCircularSinglyLinkedList* ll, OffsetForwardNode_t* node) {
+	if (!ll->size || !__ocsll_is_member(ll, node)) return NULL;
+
+	if (ll->size == 1) {
+		offptr_set(&ll->head, NULL);
+		offptr_set(&ll->tail, NULL);
+	} else {
+		OffsetForwardNode_t* tmp = __ocsll_find_node_before(ll, node);
+
+		offptr_set(&tmp->next, ocsll_next(node));
+
+		if (node == ocsll_head(ll)) offptr_set(&ll->head, ocsll_next(node));
+		if (node == offptr_get(&ll->tail)) offptr_set(&ll->tail, tmp);
+	}
+
+	offptr_set(&node->list, NULL);
+
+	ll->size--;
+
+	return node;
+}
+
+/**
+ * @brief Remove the last node from the list
+ *
+ * Unlinking the tail requires its predecessor, so this walks the list once
+ *
+ * @param ll
+ * @return OffsetForwardNode_t* - or NULL if the list is empty
+ */
+OffsetForwardNode_t* ocsll_pop(OffsetCircularSinglyLinkedList* ll) {
+	return ocsll_remove_node(ll, offptr_get(&ll->tail));
+}
+
+/**
+ * @brief Remove the first node from the list in constant time
+ *
+ * @param ll
+ * @return OffsetForwardNode_t* - or NULL if the list is empty
+ */
+OffsetForwardNode_t* ocsll_pop_front(OffsetCircularSinglyLinkedList* ll) {
+	return ocsll_remove_node(ll, ocsll_head(ll));
+}
+
+/**
+ * @brief Returns the previous list node, or NULL if the node is not a member of the list
+ *
+ * The list is singly linked, so this walks the list unless the node is the head
+ *
+ * @param ll
+ * @param node
+ * @return OffsetForwardNode_t*
+ */
+OffsetForwardNode_t* ocsll_prev(OffsetCircularSinglyLinkedList* ll, OffsetForwardNode_t* node) {
+	if (!__ocsll_is_member(ll, node)) return NULL;
+
+	return __ocsll_find_node_before(ll, node);
+}
+
+/**
+ * @brief Insert a new node with value `value` immediately after `mark`
+ *
+ * If `mark` is not an element of the list, the list is not modified
+ *
+ * @param ll
+ * @param value
+ * @param mark
+ * @return OffsetForwardNode_t* - or NULL if `mark` is not a member or the region is exhausted
+ */
+OffsetForwardNode_t* ocsll_insert_after(OffsetCircularSinglyLinkedList* ll, void* value, OffsetForwardNode_t* mark) {
+	if (!__ocsll_is_member(ll, mark)) return NULL;
+
+	OffsetForwardNode_t* n = __ocsll_alloc_node(ll, value);
+
+	if (!n) return NULL;
+
+	offptr_set(&n->next, ocsll_next(mark));
+	offptr_set(&mark->next, n);
+
+	if (mark == offptr_get(&ll->tail)) offptr_set(&ll->tail, n);
+
+	ll->size++;
+
+	return n;
+}
+
+/**
+ * @brief Insert a new node with value `value` immediately before `mark`
+ *
+ * If `mark` is not an element of the list, the list is not modified
+ *
+ * As with csll_insert_before, a node inserted before the head becomes the tail
+ *
+ * @param ll
+ * @param value
+ * @param mark
+ * @return OffsetForwardNode_t* - or NULL if `mark` is not a member or the region is exhausted
+ */
+OffsetForwardNode_t* ocsll_insert_before(OffsetCircularSinglyLinkedList* ll, void* value, OffsetForwardNode_t* mark) {
+	if (!__ocsll_is_member(ll, mark)) return NULL;
+
+	return ocsll_insert_after(ll, value, __ocsll_find_node_before(ll, mark));
+}
+
+/**
+ * @brief Move a given node to its new position after `mark`
+ *
+ * If either the given node or mark are not an element of the list; node == mark; or mark.next == node, the list is not modified
+ *
+ * @param ll
+ * @param node
+ * @param mark
+ * @return int - 0 if success, else -1
+ */
+int ocsll_move_after(OffsetCircularSinglyLinkedList* ll, OffsetForwardNode_t* node, OffsetForwardNode_t* mark) {
+	if (!__ocsll_is_member(ll, node) || !__ocsll_is_member(ll, mark) || node == mark) return -1;
+
+	if (ocsll_next(mark) == node) return -1;
+
+	__ocsll_move(ll, node, mark);
+	return 0;
+}
+
+/**
+ * @brief Move a given node to its new position before `mark`
+ *
+ * If either the given node or mark are not an element of the list; node == mark; or node.next == mark, the list is not modified
+ *
+ * As with csll_move_before, a node moved before the head becomes the tail
+ *
+ * @param ll
+ * @param node
+ * @param mark
+ * @return int - 0 if success, else -1
+ */
+int ocsll_move_before(OffsetCircularSinglyLinkedList* ll, OffsetForwardNode_t* node, OffsetForwardNode_t* mark) {
+	if (!__ocsll_is_member(ll, node) || !__ocsll_is_member(ll, mark) || node == mark) return -1;
+
+	if (ocsll_next(node) == mark) return -1;
+
+	__ocsll_move(ll, node, __ocsll_find_node_before(ll, mark));
+	return 0;
+}
+
+/**
+ * @brief Insert a copy of another list at the back of the caller list
+ *
+ * The lists may be the same, but must not be NULL; copies reference the same data, which must lie in `ll`'s region
+ *
+ * @param ll
+ * @param other
+ * @return OffsetCircularSinglyLinkedList*
+ */
+OffsetCircularSinglyLinkedList* ocsll_push_back_list(OffsetCircularSinglyLinkedList* ll, OffsetCircularSinglyLinkedList* other) {
+	if (!other || !ll) return NULL;
+
+	OffsetForwardNode_t* n = ocsll_head(other);
+
+	for (uint32_t i = other->size; i > 0; i--, n = ocsll_next(n)) {
+		ocsll_push_back(ll, ocsll_data(n));
+	}
+
+	return ll;
+}
+
+/**
+ * @brief Insert a copy of another list at the front of the caller list
+ *
+ * The lists may be the same, but must not be NULL; copies reference the same data, which must lie in `ll`'s region
+ *
+ * @param ll
+ * @param other
+ * @return OffsetCircularSinglyLinkedList*
+ */
+OffsetCircularSinglyLinkedList* ocsll_push_front_list(OffsetCircularSinglyLinkedList* ll, OffsetCircularSinglyLinkedList* other) {
+	if (!other || !ll) return NULL;
+
+	if (!other->size) return ll;
+
+	OffsetForwardNode_t* n = ocsll_head(other);
+	uint32_t size = other->size;
+
+	/* Copies are chained after the new head; the originals (and thus the walk over `other`) are never relinked */
+	OffsetForwardNode_t* last = ocsll_push_front(ll, ocsll_data(n));
+
+	for (uint32_t i = size - 1; i > 0 && last; i--) {
+		n = ocsll_next(n);
+		last = ocsll_insert_after(ll, ocsll_data(n), last);
+	}
+
+	return ll;
+}
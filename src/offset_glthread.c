@@ -0,0 +1,162 @@
+/**
+ * @file offset_glthread.c
+ * @author Matthew Zito (goldmund@freenode)
+ * @brief Implements a GLUE Doubly Linked List linked by self-relative offsets
+ * @version 0.1
+ * @date 2021-07-11
+ *
+ * @copyright Copyright (c) 2021 Matthew Zito (goldmund)
+ *
+ */
+
+#include "libcartilage.h"
+
+/**
+ * @brief Initialize a new glthread
+ *
+ * @param glthread
+ */
+void oglthread_init(oglthread_t* glthread) {
+	offptr_set(&glthread->prev, NULL);
+	offptr_set(&glthread->next, NULL);
+}
+
+/**
+ * @brief Insert a new glthread node after the given mark
+ *
+ * @param mark
+ * @param next
+ */
+void oglthread_insert_after(oglthread_t* mark, oglthread_t* next) {
+	oglthread_t* tmp = oglthread_next(mark);
+
+	offptr_set(&mark->next, next);
+	offptr_set(&next->prev, mark);
+	offptr_set(&next->next, tmp);
+
+	if (tmp) offptr_set(&tmp->prev, next);
+}
+
+/**
+ * @brief Insert a new glthread node before the given mark
+ *
+ * @param mark
+ * @param next
+ */
+void oglthread_insert_before(oglthread_t* mark, oglthread_t* next) {
+	oglthread_t* tmp = oglthread_prev(mark);
+
+	offptr_set(&next->prev, tmp);
+	offptr_set(&next->next, mark);
+	offptr_set(&mark->prev, next);
+
+	if (tmp) offptr_set(&tmp->next, next);
+}
+
+/**
+ * @brief Remove a given glthread node
+ *
+ * @param mark
+ */
+void oglthread_remove(oglthread_t* mark) {
+	oglthread_t* prev = oglthread_prev(mark);
+	oglthread_t* next = oglthread_next(mark);
+
+	if (prev) offptr_set(&prev->next, next);
+	if (next) offptr_set(&next->prev, prev);
+
+	oglthread_init(mark);
+}
+
+/**
+ * @brief Push new glthread node to tail
+ *
+ * @param head
+ * @param next
+ */
+void oglthread_push(oglthread_t* head, oglthread_t* next) {
+	oglthread_t* last = head;
+	oglthread_t* tmp;
+
+	while ((tmp = oglthread_next(last))) last = tmp;
+
+	oglthread_insert_after(last, next);
+}
+
+/**
+ * @brief Delete all nodes in a given glthread
+ *
+ * @param head
+ */
+void oglthread_del_list(oglthread_t* head) {
+	oglthread_t* thread_node = NULL;
+
+	ITERATE_OGLTHREAD_BEGIN(head, thread_node) {
+		oglthread_remove(thread_node);
+	} ITERATE_OGLTHREAD_END(head, thread_node);
+}
+
+/**
+ * @brief Get current size of glthread
+ *
+ * @param head
+ * @return unsigned int
+ */
+unsigned int oglthread_size(oglthread_t* head) {
+	unsigned int size = 0;
+	oglthread_t* thread_node = NULL;
+
+	ITERATE_OGLTHREAD_BEGIN(head, thread_node) {
+		size++;
+	} ITERATE_OGLTHREAD_END(head, thread_node);
+
+	return size;
+}
+
+/**
+ * @brief Prioritized insertion
+ *
+ * As with glthread_priority_insert, the node is inserted before the first node for which `comparator` returns -1,
+ * else at the tail
+ *
+ * @param head
+ * @param glthread
+ * @param comparator
+ * @param offset
+ */
+void oglthread_priority_insert(
+	oglthread_t* head,
+	oglthread_t* glthread,
+	int(*comparator)(void*, void*),
+	int offset
+) {
+	oglthread_t* curr = NULL,
+		* prev = head;
+
+	oglthread_init(glthread);
+
+	ITERATE_OGLTHREAD_BEGIN(head, curr) {
+		if (comparator(GET_DATA_FROM_OFFSET(glthread, offset),
+			GET_DATA_FROM_OFFSET(curr, offset)) == -1) break;
+
+		prev = curr;
+	} ITERATE_OGLTHREAD_END(head, curr);
+
+	oglthread_insert_after(prev, glthread);
+}
+
+/**
+ * @brief Dequeue the head node
+ *
+ * @param head
+ * @return oglthread_t* - or NULL if the glthread is empty
+ */
+oglthread_t* oglthread_dequeue_first(oglthread_t* head) {
+	oglthread_t* tmp = oglthread_next(head);
+
+	if (!tmp) return NULL;
+
+	oglthread_remove(tmp);
+
+	return tmp;
+}
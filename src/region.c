@@ -0,0 +1,130 @@
+/**
+ * @file region.c
+ * @author Matthew Zito (goldmund@freenode)
+ * @brief Implements a position-independent allocator over a caller-provided mapping, e.g. shared memory
+ * @version 0.1
+ * @date 2021-07-11
+ *
+ * @copyright Copyright (c) 2021 Matthew Zito (goldmund)
+ *
+ */
+
+#include "libcartilage.h"
+
+#include <string.h>
+
+#define REGION_ALIGN_UP(n) (((n) + REGION_ALIGN - 1) & ~(uint64_t)(REGION_ALIGN - 1))
+
+/**
+ * @brief Header preceding every block; `next` is only meaningful while the block is on the free list
+ * @private
+ */
+typedef struct RegionBlock {
+	uint64_t size; /* Payload size */
+	offptr_t next;
+} RegionBlock_t;
+
+/**
+ * @brief Format the `size` bytes at `base` as an empty region
+ *
+ * @param base - REGION_ALIGN-aligned, e.g. the address returned by mmap
+ * @param size
+ * @return Region_t* - or NULL if `size` cannot hold the region header
+ */
+Region_t* region_init(void* base, size_t size) {
+	Region_t* r = base;
+
+	if (size < REGION_ALIGN_UP(sizeof(Region_t))) return NULL;
+
+	memcpy(r->magic, REGION_MAGIC, sizeof(r->magic));
+	r->size = size;
+	r->cursor = REGION_ALIGN_UP(sizeof(Region_t));
+	offptr_set(&r->free_list, NULL);
+	offptr_set(&r->root, NULL);
+
+	return r;
+}
+
+/**
+ * @brief Adopt a region that was formatted by `region_init`, possibly in another process and at another address
+ *
+ * @param base
+ * @return Region_t* - or NULL if `base` does not hold a region
+ */
+Region_t* region_attach(void* base) {
+	Region_t* r = base;
+
+	if (memcmp(r->magic, REGION_MAGIC, sizeof(r->magic))) return NULL;
+
+	return r;
+}
+
+/**
+ * @brief Allocate `size` bytes, REGION_ALIGN-aligned, from the region
+ *
+ * Freed blocks of the same rounded size are reused first; lists allocate uniformly sized nodes,
+ * so the match is usually the head of the free list
+ *
+ * @param r
+ * @param size
+ * @return void* - or NULL if the region is exhausted
+ */
+void* region_alloc(Region_t* r, size_t size) {
+	if (size > r->size) return NULL;
+
+	uint64_t rounded = REGION_ALIGN_UP(size ? size : 1);
+	offptr_t* link = &r->free_list;
+	RegionBlock_t* b;
+
+	while ((b = offptr_get(link))) {
+		if (b->size == rounded) {
+			offptr_set(link, offptr_get(&b->next));
+			return b + 1;
+		}
+
+		link = &b->next;
+	}
+
+	if (sizeof(RegionBlock_t) + rounded > r->size - r->cursor) return NULL;
+
+	b = (RegionBlock_t*)((char*)r + r->cursor);
+	b->size = rounded;
+	r->cursor += sizeof(RegionBlock_t) + rounded;
+
+	return b + 1;
+}
+
+/**
+ * @brief Return a block obtained from `region_alloc` to the region
+ *
+ * @param r
+ * @param ptr
+ */
+void region_free(Region_t* r, void* ptr) {
+	if (!ptr) return;
+
+	RegionBlock_t* b = (RegionBlock_t*)ptr - 1;
+
+	offptr_set(&b->next, offptr_get(&r->free_list));
+	offptr_set(&r->free_list, b);
+}
+
+/**
+ * @brief Retrieve the region's root
+ *
+ * @param r
+ * @return void* - or NULL if unset
+ */
+void* region_root(Region_t* r) {
+	return offptr_get(&r->root);
+}
+
+/**
+ * @brief Set the region's root, which must live in the region
+ *
+ * @param r
+ * @param root
+ */
+void region_set_root(Region_t* r, void* root) {
+	offptr_set(&r->root, root);
+}
@@ -0,0 +1,336 @@
+/**
+ * @file snapshot.c
+ * @author Matthew Zito (goldmund@freenode)
+ * @brief Implements a position-independent on-disk snapshot format for lists of fixed-size records
+ * @version 0.1
+ * @date 2021-07-11
+ *
+ * @copyright Copyright (c) 2021 Matthew Zito (goldmund)
+ *
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "libcartilage.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Write the staged record
+ * @private
+ *
+ * @param w
+ * @return int - 0 if success, else -1
+ */
+int __snapshot_writer_emit(SnapshotWriter_t* w) {
+	if (fwrite(w->record, SNAPSHOT_STRIDE(w->record_size), 1, w->fp) != 1) return -1;
+
+	w->count++;
+
+	return 0;
+}
+
+/**
+ * @brief Read or map the whole file at `path` into `s`
+ * @private
+ *
+ * @param s
+ * @param path
+ * @return int - 0 if success, else -1
+ */
+int __snapshot_load(Snapshot_t* s, const char* path) {
+#ifdef _WIN32
+	FILE* fp = fopen(path, "rb");
+
+	if (!fp) return -1;
+
+	if (fseek(fp, 0, SEEK_END) || (s->length = ftell(fp)) < sizeof(SnapshotHeader_t) || fseek(fp, 0, SEEK_SET)) {
+		fclose(fp);
+		return -1;
+	}
+
+	if (!(s->header = malloc(s->length)) || fread(s->header, s->length, 1, fp) != 1) {
+		free(s->header);
+		fclose(fp);
+		return -1;
+	}
+
+	fclose(fp);
+#else
+	struct stat st;
+	int fd = open(path, O_RDONLY);
+
+	if (fd == -1) return -1;
+
+	if (fstat(fd, &st) || (size_t)st.st_size < sizeof(SnapshotHeader_t)) {
+		close(fd);
+		return -1;
+	}
+
+	s->length = st.st_size;
+	s->header = mmap(NULL, s->length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+	close(fd);
+
+	if (s->header == MAP_FAILED) return -1;
+#endif
+
+	return 0;
+}
+
+/**
+ * @brief Release the memory backing `s`
+ * @private
+ *
+ * @param s
+ */
+void __snapshot_release(Snapshot_t* s) {
+#ifdef _WIN32
+	free(s->header);
+#else
+	munmap(s->header, s->length);
+#endif
+}
+
+/**
+ * @brief Validate the header, and that the records it describes fit within the file
+ * @private
+ *
+ * @param s
+ * @return int - 0 if valid, else -1
+ */
+int __snapshot_validate(Snapshot_t* s) {
+	SnapshotHeader_t* h = s->header;
+	size_t stride = SNAPSHOT_STRIDE(h->record_size);
+
+	if (memcmp(h->magic, SNAPSHOT_MAGIC, sizeof(h->magic)) || h->version != SNAPSHOT_VERSION) return -1;
+
+	if (!h->count) return h->head == 0 ? 0 : -1;
+
+	if (h->head < (int64_t)sizeof(SnapshotHeader_t) || h->head % 8 || (uint64_t)h->head > s->length) return -1;
+
+	return h->count <= (s->length - h->head) / stride ? 0 : -1;
+}
+
+/**
+ * @brief Create (or truncate) the snapshot file at `path` and prepare to append records of `record_size` bytes
+ *
+ * @param w
+ * @param path
+ * @param record_size
+ * @return int - 0 if success, else -1
+ */
+int snapshot_writer_open(SnapshotWriter_t* w, const char* path, uint32_t record_size) {
+	SnapshotHeader_t header = { .version = SNAPSHOT_VERSION, .record_size = record_size };
+
+	memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+
+	if (!(w->record = calloc(1, SNAPSHOT_STRIDE(record_size)))) return -1;
+
+	if (!(w->fp = fopen(path, "wb"))) {
+		free(w->record);
+		return -1;
+	}
+
+	w->record_size = record_size;
+	w->count = 0;
+
+	// written up front such that records land at their final offsets; the count is filled in on close
+	if (fwrite(&header, sizeof(header), 1, w->fp) != 1) {
+		snapshot_writer_close(w);
+		return -1;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Append a copy of the `record_size` bytes at `record`
+ *
+ * @param w
+ * @param record
+ * @return int - 0 if success, else -1
+ */
+int snapshot_writer_append(SnapshotWriter_t* w, const void* record) {
+	SnapshotRecord_t* r = (SnapshotRecord_t*)w->record;
+
+	r->next = SNAPSHOT_STRIDE(w->record_size);
+	memcpy(r->data, record, w->record_size);
+
+	return __snapshot_writer_emit(w);
+}
+
+/**
+ * @brief Close the ring, finalize the header and close the file
+ *
+ * @param w
+ * @return int - 0 if every write succeeded, else -1
+ */
+int snapshot_writer_close(SnapshotWriter_t* w) {
+	SnapshotHeader_t header = { .version = SNAPSHOT_VERSION, .record_size = w->record_size, .count = w->count };
+	int64_t stride = SNAPSHOT_STRIDE(w->record_size);
+	int ret = ferror(w->fp) ? -1 : 0;
+
+	memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+
+	if (w->count) {
+		int64_t last = sizeof(SnapshotHeader_t) + (w->count - 1) * stride;
+		int64_t next = -(int64_t)(w->count - 1) * stride; // close the ring
+
+		header.head = sizeof(SnapshotHeader_t);
+
+		if (fseek(w->fp, last, SEEK_SET) || fwrite(&next, sizeof(next), 1, w->fp) != 1) ret = -1;
+	}
+
+	if (fseek(w->fp, 0, SEEK_SET) || fwrite(&header, sizeof(header), 1, w->fp) != 1) ret = -1;
+
+	if (fclose(w->fp)) ret = -1;
+
+	free(w->record);
+
+	w->fp = NULL;
+	w->record = NULL;
+
+	return ret;
+}
+
+/**
+ * @brief Write a snapshot of the list, in list order, where each node's data points to a record of `record_size` bytes
+ *
+ * @param ll
+ * @param path
+ * @param record_size
+ * @return int - 0 if success, else -1
+ */
+int csll_snapshot_save(CircularSinglyLinkedList* ll, const char* path, uint32_t record_size) {
+	SnapshotWriter_t w;
+	ForwardNode_t* n = ll->head;
+
+	if (snapshot_writer_open(&w, path, record_size) == -1) return -1;
+
+	for (uint32_t i = 0; i < ll->size; i++, n = n->next) {
+		if (snapshot_writer_append(&w, n->data) == -1) {
+			snapshot_writer_close(&w);
+			return -1;
+		}
+	}
+
+	return snapshot_writer_close(&w);
+}
+
+/**
+ * @brief Write a snapshot of the records threaded onto the glthread at `base_glthread`, in list order
+ *
+ * Each record is the `record_size`-byte struct embedding the glthread at `offset`; the embedded glthread is
+ * zeroed in the snapshot, as its pointers would be meaningless once reloaded
+ *
+ * @param base_glthread
+ * @param offset
+ * @param path
+ * @param record_size
+ * @return int - 0 if success, else -1
+ */
+int glthread_snapshot_save(glthread_t* base_glthread, int offset, const char* path, uint32_t record_size) {
+	SnapshotWriter_t w;
+	glthread_t* curr;
+
+	if (snapshot_writer_open(&w, path, record_size) == -1) return -1;
+
+	SnapshotRecord_t* r = (SnapshotRecord_t*)w.record;
+
+	ITERATE_GLTHREAD_BEGIN(base_glthread, curr) {
+		r->next = SNAPSHOT_STRIDE(record_size);
+		memcpy(r->data, GET_DATA_FROM_OFFSET(curr, offset), record_size);
+		memset(r->data + offset, 0, sizeof(glthread_t));
+
+		if (__snapshot_writer_emit(&w) == -1) {
+			snapshot_writer_close(&w);
+			return -1;
+		}
+	} ITERATE_GLTHREAD_END(base_glthread, curr);
+
+	return snapshot_writer_close(&w);
+}
+
+/**
+ * @brief Open the snapshot at `path` for in-place traversal
+ *
+ * The header is validated, as is that every record fits within the file; records' links are trusted,
+ * see `snapshot_verify`
+ *
+ * @param path
+ * @return Snapshot_t* - or NULL if the file cannot be opened or is not a valid snapshot
+ */
+Snapshot_t* snapshot_map(const char* path) {
+	Snapshot_t* s = malloc(sizeof(Snapshot_t));
+
+	if (!s) return NULL;
+
+	if (__snapshot_load(s, path) == -1) {
+		free(s);
+		return NULL;
+	}
+
+	if (__snapshot_validate(s) == -1) {
+		snapshot_unmap(s);
+		return NULL;
+	}
+
+	return s;
+}
+
+/**
+ * @brief Release a snapshot; records obtained from it are invalidated
+ *
+ * @param s
+ */
+void snapshot_unmap(Snapshot_t* s) {
+	__snapshot_release(s);
+	free(s);
+}
+
+/**
+ * @brief Walk every link and check that it lands on a record within the file and that the ring closes; O(n)
+ *
+ * @param s
+ * @return int - 0 if the snapshot is well-formed, else -1
+ */
+int snapshot_verify(Snapshot_t* s) {
+	SnapshotRecord_t* head = snapshot_head(s);
+	SnapshotRecord_t* r = head;
+	int64_t stride = SNAPSHOT_STRIDE(s->header->record_size);
+	int64_t limit = (int64_t)s->length - stride;
+
+	for (uint64_t i = 0; i < s->header->count; i++) {
+		int64_t at = (char*)r - (char*)s->header;
+
+		if (at < (int64_t)sizeof(SnapshotHeader_t) || at > limit || at % 8) return -1;
+
+		// only a simple ring through the head returns to it after exactly `count` steps
+		if (i && r == head) return -1;
+
+		r = snapshot_next(r);
+	}
+
+	return r == head ? 0 : -1;
+}
+
+/**
+ * @brief Iterate over the snapshot's records in list order, passing each record's data to the callback
+ *
+ * @param s
+ * @param callback
+ */
+void snapshot_iterate(Snapshot_t* s, void (*callback)(void*)) {
+	SnapshotRecord_t* r = snapshot_head(s);
+
+	for (uint64_t i = 0; i < s->header->count; i++, r = snapshot_next(r)) callback(r->data);
+}
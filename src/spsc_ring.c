@@ -0,0 +1,270 @@
+/**
+ * @file spsc_ring.c
+ * @author Matthew Zito (goldmund@freenode)
+ * @brief Implements a bounded single-producer single-consumer ring
+ * @version 0.1
+ * @date 2021-07-11
+ *
+ * @copyright Copyright (c) 2021 Matthew Zito (goldmund)
+ *
+ */
+
+#include "libcartilage.h"
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+/* The largest power of two representable in a size_t */
+#define SPSC_RING_MAX_POW2 ((SIZE_MAX >> 1) + 1)
+
+/**
+ * @brief Round `n` up to the nearest power of two
+ * @private
+ *
+ * `n` must not exceed SPSC_RING_MAX_POW2
+ *
+ * @param n
+ * @return size_t
+ */
+size_t __spsc_ring_pow2(size_t n) {
+	size_t p = 1;
+
+	while (p < n) p <<= 1;
+
+	return p;
+}
+
+/**
+ * @brief Instantiate a ring of at least `capacity` slots of `elem_size` bytes; capacity is rounded up to a power of two
+ *
+ * @param capacity
+ * @param elem_size
+ * @return spsc_ring_t* - or NULL if allocation failed, or if the rounded capacity or the slots' size overflows a size_t
+ */
+spsc_ring_t* spsc_ring_make(size_t capacity, size_t elem_size) {
+	// rounding up past the largest power of two would never terminate
+	if (capacity > SPSC_RING_MAX_POW2) return NULL;
+
+	capacity = __spsc_ring_pow2(capacity ? capacity : 1);
+
+	if (elem_size && capacity > SIZE_MAX / elem_size) return NULL;
+
+	spsc_ring_t* r = aligned_alloc(CACHE_LINE_SIZE, sizeof(spsc_ring_t));
+
+	if (!r) return NULL;
+
+	r->capacity = capacity;
+	r->mask = r->capacity - 1;
+	r->elem_size = elem_size;
+	r->slots = malloc(r->capacity * elem_size);
+
+	if (!r->slots) {
+		free(r);
+		return NULL;
+	}
+
+	atomic_init(&r->head, 0);
+	atomic_init(&r->tail, 0);
+	r->cached_head = 0;
+	r->cached_tail = 0;
+
+	return r;
+}
+
+/**
+ * @brief Free the ring and its slots
+ *
+ * @param r
+ */
+void spsc_ring_destroy(spsc_ring_t* r) {
+	free(r->slots);
+	free(r);
+}
+
+/**
+ * @brief Reserve up to `n` contiguous slots for writing; producer only
+ *
+ * The consumer's index is only reloaded when the cached copy suggests there is not enough room
+ *
+ * @param r
+ * @param n
+ * @param slots - set to the first reserved slot
+ * @return size_t - the number of slots reserved, which may be fewer than `n` if the ring is full or wraps
+ */
+size_t spsc_ring_reserve(spsc_ring_t* r, size_t n, void** slots) {
+	size_t tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+	size_t free_slots = r->capacity - (tail - r->cached_head);
+
+	if (free_slots < n) {
+		r->cached_head = atomic_load_explicit(&r->head, memory_order_acquire);
+		free_slots = r->capacity - (tail - r->cached_head);
+	}
+
+	size_t idx = tail & r->mask;
+	size_t contiguous = r->capacity - idx;
+
+	if (n > free_slots) n = free_slots;
+	if (n > contiguous) n = contiguous;
+
+	*slots = r->slots + idx * r->elem_size;
+
+	return n;
+}
+
+/**
+ * @brief Publish `n` slots previously obtained from `spsc_ring_reserve`; producer only
+ *
+ * @param r
+ * @param n
+ */
+void spsc_ring_commit(spsc_ring_t* r, size_t n) {
+	size_t tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+
+	atomic_store_explicit(&r->tail, tail + n, memory_order_release);
+}
+
+/**
+ * @brief Obtain up to `n` contiguous readable slots without copying; consumer only
+ *
+ * The producer's index is only reloaded when the cached copy suggests there are not enough elements
+ *
+ * @param r
+ * @param n
+ * @param slots - set to the first readable slot
+ * @return size_t - the number of readable slots, which may be fewer than `n` if the ring is empty or wraps
+ */
+size_t spsc_ring_peek(spsc_ring_t* r, size_t n, void** slots) {
+	size_t head = atomic_load_explicit(&r->head, memory_order_relaxed);
+	size_t available = r->cached_tail - head;
+
+	if (available < n) {
+		r->cached_tail = atomic_load_explicit(&r->tail, memory_order_acquire);
+		available = r->cached_tail - head;
+	}
+
+	size_t idx = head & r->mask;
+	size_t contiguous = r->capacity - idx;
+
+	if (n > available) n = available;
+	if (n > contiguous) n = contiguous;
+
+	*slots = r->slots + idx * r->elem_size;
+
+	return n;
+}
+
+/**
+ * @brief Return `n` slots previously obtained from `spsc_ring_peek` to the producer; consumer only
+ *
+ * @param r
+ * @param n
+ */
+void spsc_ring_release(spsc_ring_t* r, size_t n) {
+	size_t head = atomic_load_explicit(&r->head, memory_order_relaxed);
+
+	atomic_store_explicit(&r->head, head + n, memory_order_release);
+}
+
+/**
+ * @brief Copy an element into the ring; producer only
+ *
+ * @param r
+ * @param elem
+ * @return int - 0 if success, else -1 if the ring is full
+ */
+int spsc_ring_push(spsc_ring_t* r, const void* elem) {
+	void* slot;
+
+	if (!spsc_ring_reserve(r, 1, &slot)) return -1;
+
+	memcpy(slot, elem, r->elem_size);
+	spsc_ring_commit(r, 1);
+
+	return 0;
+}
+
+/**
+ * @brief Copy an element out of the ring; consumer only
+ *
+ * @param r
+ * @param elem
+ * @return int - 0 if success, else -1 if the ring is empty
+ */
+int spsc_ring_pop(spsc_ring_t* r, void* elem) {
+	void* slot;
+
+	if (!spsc_ring_peek(r, 1, &slot)) return -1;
+
+	memcpy(elem, slot, r->elem_size);
+	spsc_ring_release(r, 1);
+
+	return 0;
+}
+
+/**
+ * @brief Copy up to `n` elements into the ring; producer only
+ *
+ * At most two copies are made, as the reserved region may wrap around the end of the ring
+ *
+ * @param r
+ * @param elems
+ * @param n
+ * @return size_t - the number of elements pushed
+ */
+size_t spsc_ring_push_batch(spsc_ring_t* r, const void* elems, size_t n) {
+	const char* src = elems;
+	size_t pushed = 0;
+
+	for (int i = 0; i < 2 && pushed < n; i++) {
+		void* slots;
+		size_t count = spsc_ring_reserve(r, n - pushed, &slots);
+
+		if (!count) break;
+
+		memcpy(slots, src + pushed * r->elem_size, count * r->elem_size);
+		spsc_ring_commit(r, count);
+		pushed += count;
+	}
+
+	return pushed;
+}
+
+/**
+ * @brief Copy up to `n` elements out of the ring; consumer only
+ *
+ * @param r
+ * @param elems
+ * @param n
+ * @return size_t - the number of elements popped
+ */
+size_t spsc_ring_pop_batch(spsc_ring_t* r, void* elems, size_t n) {
+	char* dst = elems;
+	size_t popped = 0;
+
+	for (int i = 0; i < 2 && popped < n; i++) {
+		void* slots;
+		size_t count = spsc_ring_peek(r, n - popped, &slots);
+
+		if (!count) break;
+
+		memcpy(dst + popped * r->elem_size, slots, count * r->elem_size);
+		spsc_ring_release(r, count);
+		popped += count;
+	}
+
+	return popped;
+}
+
+/**
+ * @brief Get the number of elements in the ring; exact only when called by the producer or consumer
+ *
+ * @param r
+ * @return size_t
+ */
+size_t spsc_ring_size(spsc_ring_t* r) {
+	size_t tail = atomic_load_explicit(&r->tail, memory_order_acquire);
+	size_t head = atomic_load_explicit(&r->head, memory_order_acquire);
+
+	return tail - head;
+}
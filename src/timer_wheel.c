@@ -0,0 +1,194 @@
+/**
+ * @file timer_wheel.c
+ * @author Matthew Zito (goldmund@freenode)
+ * @brief Implements a hashed hierarchical timing wheel of intrusive glthread-linked timers
+ * @version 0.1
+ * @date 2021-07-11
+ *
+ * @copyright Copyright (c) 2021 Matthew Zito (goldmund)
+ *
+ */
+
+#include "libcartilage.h"
+
+#define TIMER_WHEEL_MASK (TIMER_WHEEL_SLOTS - 1)
+/* Furthest a timer can be hashed from the next tick; beyond, it waits in the top level */
+#define TIMER_WHEEL_MAX_DELTA ((UINT64_C(1) << (TIMER_WHEEL_BITS * TIMER_WHEEL_LEVELS)) - 1)
+
+/**
+ * @brief Index of the slot at `level` that the next tick lies in
+ * @private
+ *
+ * @param w
+ * @param level
+ * @return unsigned int
+ */
+unsigned int __timer_wheel_index(timer_wheel_t* w, int level) {
+	return (w->now >> (TIMER_WHEEL_BITS * level)) & TIMER_WHEEL_MASK;
+}
+
+/**
+ * @brief Link the timer into the slot its expiry hashes to, relative to the next tick
+ * @private
+ *
+ * @param w
+ * @param t
+ */
+void __timer_wheel_link(timer_wheel_t* w, wheel_timer_t* t) {
+	uint64_t expires = t->expires;
+	uint64_t delta = expires - w->now;
+	int level = 0;
+
+	if (expires < w->now) {
+		expires = w->now;
+	} else if (delta > TIMER_WHEEL_MAX_DELTA) {
+		expires = w->now + TIMER_WHEEL_MAX_DELTA;
+		level = TIMER_WHEEL_LEVELS - 1;
+	} else {
+		while (level < TIMER_WHEEL_LEVELS - 1 && delta >> (TIMER_WHEEL_BITS * (level + 1))) level++;
+	}
+
+	unsigned int index = (expires >> (TIMER_WHEEL_BITS * level)) & TIMER_WHEEL_MASK;
+
+	glthread_insert_after(&w->slots[level][index], &t->glthread);
+}
+
+/**
+ * @brief Re-hash every timer in the given slot, which moves each down at least one level
+ * @private
+ *
+ * @param w
+ * @param level
+ * @param index
+ * @return unsigned int - the slot index, such that the caller knows whether the level wrapped
+ */
+unsigned int __timer_wheel_cascade(timer_wheel_t* w, int level, unsigned int index) {
+	glthread_t* slot = &w->slots[level][index];
+	glthread_t* curr = slot->next;
+
+	glthread_init(slot);
+
+	while (curr) {
+		glthread_t* next = curr->next;
+
+		glthread_init(curr);
+		__timer_wheel_link(w, (wheel_timer_t*)GET_DATA_FROM_OFFSET(curr, offsetof(wheel_timer_t, glthread)));
+
+		curr = next;
+	}
+
+	return index;
+}
+
+/**
+ * @brief Initialize a new, empty timing wheel whose next tick is `now`
+ *
+ * @param w
+ * @param now
+ */
+void timer_wheel_init(timer_wheel_t* w, uint64_t now) {
+	for (int l = 0; l < TIMER_WHEEL_LEVELS; l++) {
+		for (int i = 0; i < TIMER_WHEEL_SLOTS; i++) glthread_init(&w->slots[l][i]);
+	}
+
+	w->now = now;
+	w->size = 0;
+}
+
+/**
+ * @brief Initialize a new, unarmed timer
+ *
+ * @param t
+ */
+void wheel_timer_init(wheel_timer_t* t) {
+	glthread_init(&t->glthread);
+	t->expires = 0;
+}
+
+/**
+ * @brief Arm the timer to fire at tick `expires` in constant time, re-arming it if it is already armed
+ *
+ * A timer due at or before the wheel's next tick fires on that tick
+ *
+ * @param w
+ * @param t
+ * @param expires
+ */
+void timer_wheel_arm(timer_wheel_t* w, wheel_timer_t* t, uint64_t expires) {
+	timer_wheel_cancel(w, t);
+
+	t->expires = expires;
+	__timer_wheel_link(w, t);
+
+	w->size++;
+}
+
+/**
+ * @brief Disarm the timer in constant time
+ *
+ * @param w
+ * @param t
+ * @return int - 0 if the timer was armed, else -1
+ */
+int timer_wheel_cancel(timer_wheel_t* w, wheel_timer_t* t) {
+	if (!wheel_timer_is_armed(t)) return -1;
+
+	glthread_remove(&t->glthread);
+
+	w->size--;
+
+	return 0;
+}
+
+/**
+ * @brief Process every tick up to and including `now`, firing the timers that expire
+ *
+ * Each tick's timers are detached from their slot in one step and fired as a batch; every timer is disarmed before
+ * `callback` is invoked with it, so the callback may re-arm it, or arm or cancel any other timer
+ *
+ * Ticks are processed one at a time, but a wheel with no armed timers skips straight to `now`
+ *
+ * @param w
+ * @param now
+ * @param callback
+ * @param ctx
+ * @return size_t - the number of timers fired
+ */
+size_t timer_wheel_advance(timer_wheel_t* w, uint64_t now, void (*callback)(wheel_timer_t*, void*), void* ctx) {
+	size_t fired = 0;
+	glthread_t batch;
+
+	while (w->now <= now) {
+		if (!w->size) {
+			w->now = now + 1;
+			break;
+		}
+
+		unsigned int index = w->now & TIMER_WHEEL_MASK;
+
+		// on wrapping a level, pull its next slot down; a level that wraps in turn cascades the one above
+		for (int l = 1; !index && l < TIMER_WHEEL_LEVELS; l++) index = __timer_wheel_cascade(w, l, __timer_wheel_index(w, l));
+
+		glthread_t* slot = &w->slots[0][w->now & TIMER_WHEEL_MASK];
+
+		glthread_init(&batch);
+
+		if ((batch.next = slot->next)) {
+			batch.next->prev = &batch;
+			slot->next = NULL;
+		}
+
+		w->now++;
+
+		while (batch.next) {
+			wheel_timer_t* t = GET_DATA_FROM_OFFSET(batch.next, offsetof(wheel_timer_t, glthread));
+
+			timer_wheel_cancel(w, t);
+			callback(t, ctx);
+
+			fired++;
+		}
+	}
+
+	return fired;
+}
@@ -0,0 +1,400 @@
+/**
+ * @file unrolled_csll.c
+ * @author Matthew Zito (goldmund@freenode)
+ * @brief Implements an unrolled Circular Singly Linked List
+ * @version 0.1
+ * @date 2021-07-11
+ *
+ * @copyright Copyright (c) 2021 Matthew Zito (goldmund)
+ *
+ */
+
+#include "libcartilage.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+_Static_assert(sizeof(UnrolledNode_t) % CACHE_LINE_SIZE == 0, "unrolled nodes must span whole cache lines");
+
+/**
+ * @brief Generate a new, empty node
+ * @private
+ *
+ * @return UnrolledNode_t*
+ */
+UnrolledNode_t* __ucsll_make_node(void) {
+	UnrolledNode_t* node = aligned_alloc(CACHE_LINE_SIZE, sizeof(UnrolledNode_t));
+
+	if (!node) return NULL;
+
+	node->next = NULL;
+	node->count = 0;
+
+	return node;
+}
+
+/**
+ * @brief Link a detached node immediately after `mark`, or as the sole node if `mark` is NULL
+ * @private
+ *
+ * @param ll
+ * @param mark
+ * @param node
+ */
+void __ucsll_link_after(UnrolledCircularSinglyLinkedList* ll, UnrolledNode_t* mark, UnrolledNode_t* node) {
+	if (!mark) {
+		node->next = node;
+		ll->head = node;
+		ll->tail = node;
+	} else {
+		node->next = mark->next;
+		mark->next = node;
+
+		if (mark == ll->tail) ll->tail = node;
+	}
+
+	ll->nodes++;
+}
+
+/**
+ * @brief Unlink and free `node`, whose predecessor is `prev`
+ * @private
+ *
+ * @param ll
+ * @param prev
+ * @param node
+ */
+void __ucsll_unlink(UnrolledCircularSinglyLinkedList* ll, UnrolledNode_t* prev, UnrolledNode_t* node) {
+	if (ll->nodes == 1) {
+		ll->head = NULL;
+		ll->tail = NULL;
+	} else {
+		prev->next = node->next;
+
+		if (node == ll->head) ll->head = node->next;
+		if (node == ll->tail) ll->tail = prev;
+	}
+
+	ll->nodes--;
+	free(node);
+}
+
+/**
+ * @brief Find the node holding position `index`, which must be in range
+ * @private
+ *
+ * @param ll
+ * @param index
+ * @param prev Receives the node's predecessor
+ * @param offset Receives the position within the node
+ * @return UnrolledNode_t*
+ */
+UnrolledNode_t* __ucsll_locate(UnrolledCircularSinglyLinkedList* ll, uint32_t index, UnrolledNode_t** prev, uint32_t* offset) {
+	UnrolledNode_t* p = ll->tail;
+	UnrolledNode_t* node = ll->head;
+
+	while (index >= node->count) {
+		index -= node->count;
+		p = node;
+		node = node->next;
+	}
+
+	*prev = p;
+	*offset = index;
+
+	return node;
+}
+
+/**
+ * @brief Restore at least half occupancy of `node` by merging its successor into it, or by borrowing from it
+ * @private
+ *
+ * @param ll
+ * @param node
+ */
+void __ucsll_rebalance(UnrolledCircularSinglyLinkedList* ll, UnrolledNode_t* node) {
+	// the tail's successor is the head; never merge across the seam
+	if (node->count >= UCSLL_NODE_CAPACITY / 2 || node == ll->tail) return;
+
+	UnrolledNode_t* next = node->next;
+
+	if (node->count + next->count <= UCSLL_NODE_CAPACITY) {
+		memcpy(node->data + node->count, next->data, next->count * sizeof(void*));
+		node->count += next->count;
+
+		__ucsll_unlink(ll, node, next);
+		return;
+	}
+
+	uint32_t borrow = (next->count - node->count) / 2;
+
+	memcpy(node->data + node->count, next->data, borrow * sizeof(void*));
+	memmove(next->data, next->data + borrow, (next->count - borrow) * sizeof(void*));
+
+	node->count += borrow;
+	next->count -= borrow;
+}
+
+/**
+ * @brief Instantiate an empty unrolled circular singly linked list
+ *
+ * @return UnrolledCircularSinglyLinkedList*
+ */
+UnrolledCircularSinglyLinkedList* ucsll_make_list(void) {
+	UnrolledCircularSinglyLinkedList* ll = malloc(sizeof(UnrolledCircularSinglyLinkedList));
+
+	if (!ll) return NULL;
+
+	ll->head = NULL;
+	ll->tail = NULL;
+	ll->size = 0;
+	ll->nodes = 0;
+
+	return ll;
+}
+
+/**
+ * @brief Free all nodes of the list and the list itself; values are not freed
+ *
+ * @param ll
+ */
+void ucsll_destroy_list(UnrolledCircularSinglyLinkedList* ll) {
+	UnrolledNode_t* node = ll->head;
+
+	for (uint32_t i = 0; i < ll->nodes; i++) {
+		UnrolledNode_t* next = node->next;
+
+		free(node);
+		node = next;
+	}
+
+	free(ll);
+}
+
+/**
+ * @brief Push `value` to the back of the list
+ *
+ * A new tail node is started only once the current one is full, such that appends pack nodes densely
+ *
+ * @param ll
+ * @param value
+ * @return int - 0 if success, else -1
+ */
+int ucsll_push_back(UnrolledCircularSinglyLinkedList* ll, void* value) {
+	if (!ll->tail || ll->tail->count == UCSLL_NODE_CAPACITY) {
+		UnrolledNode_t* node = __ucsll_make_node();
+
+		if (!node) return -1;
+
+		__ucsll_link_after(ll, ll->tail, node);
+	}
+
+	ll->tail->data[ll->tail->count++] = value;
+	ll->size++;
+
+	return 0;
+}
+
+/**
+ * @brief Push `value` to the front of the list
+ *
+ * @param ll
+ * @param value
+ * @return int - 0 if success, else -1
+ */
+int ucsll_push_front(UnrolledCircularSinglyLinkedList* ll, void* value) {
+	if (!ll->head || ll->head->count == UCSLL_NODE_CAPACITY) {
+		UnrolledNode_t* node = __ucsll_make_node();
+
+		if (!node) return -1;
+
+		// linking after the tail makes the node the tail's successor, i.e. the new head
+		UnrolledNode_t* tail = ll->tail;
+
+		__ucsll_link_after(ll, tail, node);
+
+		ll->head = node;
+		if (tail) ll->tail = tail;
+	}
+
+	UnrolledNode_t* head = ll->head;
+
+	memmove(head->data + 1, head->data, head->count * sizeof(void*));
+	head->data[0] = value;
+	head->count++;
+	ll->size++;
+
+	return 0;
+}
+
+/**
+ * @brief Remove the last value from the list
+ *
+ * Removing the last value of the tail node walks the nodes to find its predecessor
+ *
+ * @param ll
+ * @return void* - the value, or NULL if the list is empty
+ */
+void* ucsll_pop(UnrolledCircularSinglyLinkedList* ll) {
+	if (!ll->size) return NULL;
+
+	UnrolledNode_t* tail = ll->tail;
+	void* value = tail->data[--tail->count];
+
+	ll->size--;
+
+	if (!tail->count) {
+		UnrolledNode_t* prev = ll->head;
+
+		while (prev->next != tail) prev = prev->next;
+
+		__ucsll_unlink(ll, prev, tail);
+	}
+
+	return value;
+}
+
+/**
+ * @brief Remove the first value from the list
+ *
+ * @param ll
+ * @return void* - the value, or NULL if the list is empty
+ */
+void* ucsll_pop_front(UnrolledCircularSinglyLinkedList* ll) {
+	if (!ll->size) return NULL;
+
+	UnrolledNode_t* head = ll->head;
+	void* value = head->data[0];
+
+	head->count--;
+	memmove(head->data, head->data + 1, head->count * sizeof(void*));
+	ll->size--;
+
+	if (!head->count) __ucsll_unlink(ll, ll->tail, head);
+
+	return value;
+}
+
+/**
+ * @brief Returns the value at position `index`
+ *
+ * @param ll
+ * @param index
+ * @return void* - the value, or NULL if `index` is out of range
+ */
+void* ucsll_get(UnrolledCircularSinglyLinkedList* ll, uint32_t index) {
+	if (index >= ll->size) return NULL;
+
+	UnrolledNode_t* prev;
+	uint32_t offset;
+	UnrolledNode_t* node = __ucsll_locate(ll, index, &prev, &offset);
+
+	return node->data[offset];
+}
+
+/**
+ * @brief Insert `value` immediately before the value at position `index`
+ *
+ * A full node is split in half to make room; `index` == size appends
+ *
+ * @param ll
+ * @param value
+ * @param index
+ * @return int - 0 if success, else -1
+ */
+int ucsll_insert_before(UnrolledCircularSinglyLinkedList* ll, void* value, uint32_t index) {
+	if (index > ll->size) return -1;
+	if (index == ll->size) return ucsll_push_back(ll, value);
+
+	UnrolledNode_t* prev;
+	uint32_t offset;
+	UnrolledNode_t* node = __ucsll_locate(ll, index, &prev, &offset);
+
+	if (node->count == UCSLL_NODE_CAPACITY) {
+		UnrolledNode_t* split = __ucsll_make_node();
+
+		if (!split) return -1;
+
+		uint32_t half = UCSLL_NODE_CAPACITY / 2;
+
+		memcpy(split->data, node->data + half, (UCSLL_NODE_CAPACITY - half) * sizeof(void*));
+		split->count = UCSLL_NODE_CAPACITY - half;
+		node->count = half;
+
+		__ucsll_link_after(ll, node, split);
+
+		if (offset > half) {
+			node = split;
+			offset -= half;
+		}
+	}
+
+	memmove(node->data + offset + 1, node->data + offset, (node->count - offset) * sizeof(void*));
+	node->data[offset] = value;
+	node->count++;
+	ll->size++;
+
+	return 0;
+}
+
+/**
+ * @brief Insert `value` immediately after the value at position `index`
+ *
+ * @param ll
+ * @param value
+ * @param index
+ * @return int - 0 if success, else -1
+ */
+int ucsll_insert_after(UnrolledCircularSinglyLinkedList* ll, void* value, uint32_t index) {
+	if (index >= ll->size) return -1;
+
+	return ucsll_insert_before(ll, value, index + 1);
+}
+
+/**
+ * @brief Remove the value at position `index`
+ *
+ * A node left less than half full is merged with, or refilled from, its successor
+ *
+ * @param ll
+ * @param index
+ * @return void* - the value, or NULL if `index` is out of range
+ */
+void* ucsll_remove_at(UnrolledCircularSinglyLinkedList* ll, uint32_t index) {
+	if (index >= ll->size) return NULL;
+
+	UnrolledNode_t* prev;
+	uint32_t offset;
+	UnrolledNode_t* node = __ucsll_locate(ll, index, &prev, &offset);
+	void* value = node->data[offset];
+
+	node->count--;
+	memmove(node->data + offset, node->data + offset + 1, (node->count - offset) * sizeof(void*));
+	ll->size--;
+
+	if (!node->count) {
+		__ucsll_unlink(ll, prev, node);
+	} else {
+		__ucsll_rebalance(ll, node);
+	}
+
+	return value;
+}
+
+/**
+ * @brief Iterate over the list and invoke `callback` with each value
+ *
+ * @param ll
+ * @param callback
+ */
+void ucsll_iterate(UnrolledCircularSinglyLinkedList* ll, void (*callback)(void*)) {
+	UnrolledNode_t* node = ll->head;
+
+	for (uint32_t n = 0; n < ll->nodes; n++) {
+		UnrolledNode_t* next = node->next;
+
+		for (uint32_t i = 0; i < node->count; i++) callback(node->data[i]);
+
+		node = next;
+	}
+}
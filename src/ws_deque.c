@@ -0,0 +1,214 @@
+/**
+ * @file ws_deque.c
+ * @author Matthew Zito (goldmund@freenode)
+ * @brief Implements a lock-free Chase-Lev work-stealing deque
+ * @version 0.1
+ * @date 2021-07-11
+ *
+ * @copyright Copyright (c) 2021 Matthew Zito (goldmund)
+ *
+ */
+
+#include "libcartilage.h"
+
+#include <stdlib.h>
+
+#define WS_DEQUE_MIN_CAPACITY 16
+
+/* The largest power of two such that an array's slots fit in a size_t */
+#define WS_DEQUE_MAX_CAPACITY ((int64_t)((SIZE_MAX / sizeof(_Atomic(void*))) >> 1) + 1)
+
+/**
+ * @brief Allocate an array of `capacity` slots
+ * @private
+ *
+ * @param capacity - a power of two
+ * @return ws_deque_array_t* - or NULL if `capacity` exceeds WS_DEQUE_MAX_CAPACITY or allocation failed
+ */
+ws_deque_array_t* __ws_deque_array_make(int64_t capacity) {
+	if (capacity > WS_DEQUE_MAX_CAPACITY) return NULL;
+
+	ws_deque_array_t* a = malloc(sizeof(ws_deque_array_t) + capacity * sizeof(_Atomic(void*)));
+
+	if (!a) return NULL;
+
+	a->retired = NULL;
+	a->mask = capacity - 1;
+
+	return a;
+}
+
+/**
+ * @brief Replace the full array with one of twice the capacity, holding the elements in [top, bottom)
+ * @private
+ *
+ * Only the owner grows the deque, so bottom cannot move meanwhile; thieves may advance top, which is harmless
+ * as the elements they take are copied as well
+ *
+ * @param d
+ * @param a
+ * @param top
+ * @param bottom
+ * @return ws_deque_array_t* - the new array, or NULL if it could not be allocated
+ */
+ws_deque_array_t* __ws_deque_grow(ws_deque_t* d, ws_deque_array_t* a, int64_t top, int64_t bottom) {
+	ws_deque_array_t* grown = __ws_deque_array_make(2 * (a->mask + 1));
+
+	if (!grown) return NULL;
+
+	for (int64_t i = top; i < bottom; i++) {
+		void* elem = atomic_load_explicit(&a->slots[i & a->mask], memory_order_relaxed);
+
+		atomic_store_explicit(&grown->slots[i & grown->mask], elem, memory_order_relaxed);
+	}
+
+	grown->retired = a;
+	atomic_store_explicit(&d->array, grown, memory_order_release);
+
+	return grown;
+}
+
+/**
+ * @brief Instantiate an empty deque with room for at least `capacity` elements before it must grow
+ *
+ * @param capacity
+ * @return ws_deque_t* - or NULL if allocation failed, or if `capacity` exceeds the largest power of two whose slots
+ * fit in a size_t
+ */
+ws_deque_t* ws_deque_make(size_t capacity) {
+	// rounding up past the largest capacity would overflow
+	if (capacity > (size_t)WS_DEQUE_MAX_CAPACITY) return NULL;
+
+	int64_t cap = WS_DEQUE_MIN_CAPACITY;
+	while ((size_t)cap < capacity) cap <<= 1;
+
+	ws_deque_t* d = aligned_alloc(CACHE_LINE_SIZE, sizeof(ws_deque_t));
+
+	if (!d) return NULL;
+
+	ws_deque_array_t* a = __ws_deque_array_make(cap);
+
+	if (!a) {
+		free(d);
+		return NULL;
+	}
+
+	atomic_init(&d->top, 0);
+	atomic_init(&d->bottom, 0);
+	atomic_init(&d->array, a);
+
+	return d;
+}
+
+/**
+ * @brief Free the deque and every array it has used; no thread may be using it
+ *
+ * @param d
+ */
+void ws_deque_destroy(ws_deque_t* d) {
+	ws_deque_array_t* a = atomic_load_explicit(&d->array, memory_order_relaxed);
+
+	while (a) {
+		ws_deque_array_t* retired = a->retired;
+
+		free(a);
+		a = retired;
+	}
+
+	free(d);
+}
+
+/**
+ * @brief Push an element onto the bottom of the deque; owner only
+ *
+ * @param d
+ * @param elem - must not be NULL
+ * @return int - 0 if success, else -1 if the deque was full and could not grow
+ */
+int ws_deque_push(ws_deque_t* d, void* elem) {
+	int64_t b = atomic_load_explicit(&d->bottom, memory_order_relaxed);
+	int64_t t = atomic_load_explicit(&d->top, memory_order_acquire);
+	ws_deque_array_t* a = atomic_load_explicit(&d->array, memory_order_relaxed);
+
+	if (b - t > a->mask && !(a = __ws_deque_grow(d, a, t, b))) return -1;
+
+	atomic_store_explicit(&a->slots[b & a->mask], elem, memory_order_relaxed);
+	// publish the element before the thieves can see the new bottom
+	atomic_thread_fence(memory_order_release);
+	atomic_store_explicit(&d->bottom, b + 1, memory_order_relaxed);
+
+	return 0;
+}
+
+/**
+ * @brief Pop the most recently pushed element from the bottom of the deque; owner only
+ *
+ * @param d
+ * @return void* - the element, or NULL if the deque is empty or a thief took the last element
+ */
+void* ws_deque_pop(ws_deque_t* d) {
+	int64_t b = atomic_load_explicit(&d->bottom, memory_order_relaxed) - 1;
+	ws_deque_array_t* a = atomic_load_explicit(&d->array, memory_order_relaxed);
+
+	// reserve the bottom element before reading top, such that a thief either sees the reservation or wins the CAS below
+	atomic_store_explicit(&d->bottom, b, memory_order_relaxed);
+	atomic_thread_fence(memory_order_seq_cst);
+
+	int64_t t = atomic_load_explicit(&d->top, memory_order_relaxed);
+	void* elem = NULL;
+
+	if (t <= b) {
+		elem = atomic_load_explicit(&a->slots[b & a->mask], memory_order_relaxed);
+
+		if (t == b) {
+			// the last element; race the thieves for it
+			if (!atomic_compare_exchange_strong_explicit(&d->top, &t, t + 1, memory_order_seq_cst, memory_order_relaxed)) {
+				elem = NULL;
+			}
+
+			atomic_store_explicit(&d->bottom, b + 1, memory_order_relaxed);
+		}
+	} else {
+		atomic_store_explicit(&d->bottom, b + 1, memory_order_relaxed);
+	}
+
+	return elem;
+}
+
+/**
+ * @brief Steal the least recently pushed element from the top of the deque; any thread
+ *
+ * @param d
+ * @return void* - the element, or NULL if the deque is empty or another thread took the element first
+ */
+void* ws_deque_steal(ws_deque_t* d) {
+	int64_t t = atomic_load_explicit(&d->top, memory_order_acquire);
+
+	atomic_thread_fence(memory_order_seq_cst);
+
+	int64_t b = atomic_load_explicit(&d->bottom, memory_order_acquire);
+
+	if (t >= b) return NULL;
+
+	ws_deque_array_t* a = atomic_load_explicit(&d->array, memory_order_acquire);
+	void* elem = atomic_load_explicit(&a->slots[t & a->mask], memory_order_relaxed);
+
+	if (!atomic_compare_exchange_strong_explicit(&d->top, &t, t + 1, memory_order_seq_cst, memory_order_relaxed)) {
+		return NULL;
+	}
+
+	return elem;
+}
+
+/**
+ * @brief Approximate number of elements in the deque; exact only while no other thread is using it
+ *
+ * @param d
+ * @return size_t
+ */
+size_t ws_deque_size(ws_deque_t* d) {
+	int64_t b = atomic_load_explicit(&d->bottom, memory_order_relaxed);
+	int64_t t = atomic_load_explicit(&d->top, memory_order_relaxed);
+
+	return b > t ? (size_t)(b - t) : 0;
+}
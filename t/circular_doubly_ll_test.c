@@ -0,0 +1,240 @@
+#include "test_util.h"
+
+#include "libcartilage.h"
+#include <stdarg.h>
+
+/**
+ * Environment
+ */
+
+typedef BidirectionalNode_t Node;
+
+typedef CircularDoublyLinkedList LinkedList;
+
+/**
+ * Lifecycle
+ */
+
+int run_test(LinkedList* (*setup)(void), void (*teardown)(LinkedList*), LinkedList* (*test)(LinkedList*)) {
+	teardown(test(setup()));
+}
+
+LinkedList* setup(void) {
+	return cdll_make_list();
+}
+
+void teardown(LinkedList* ll) {
+	cdll_iterate(ll, free);
+	free(ll);
+}
+
+/**
+ * Helpers
+ */
+
+/* Asserts order in both directions, and that the list is congruent with its size */
+void assert_ordinal_pointers(LinkedList* ll, int nodes_n, ...) {
+	va_list args;
+	Node* nodes[16];
+
+	va_start(args, nodes_n);
+
+	for (int i = 0; i < nodes_n; i++) nodes[i] = va_arg(args, Node*);
+
+	va_end(args);
+
+	Node* tmp = ll->head;
+
+	for (int i = 0; i < nodes_n; i++, tmp = tmp->next) {
+		assert(tmp == nodes[i]);
+		assert(tmp->next->prev == tmp);
+	}
+
+	assert(tmp == ll->head);
+
+	tmp = ll->head->prev;
+
+	for (int i = nodes_n - 1; i >= 0; i--, tmp = tmp->prev) {
+		assert(tmp == nodes[i]);
+	}
+
+	ASSERT(ll->size == nodes_n, "has the expected list order and size");
+}
+
+void assert_ordinal_data(LinkedList* ll, int vals_n, ...) {
+	va_list args;
+
+	va_start(args, vals_n);
+
+	Node* tmp = ll->head;
+
+	for (int i = 0; i < vals_n; i++, tmp = tmp->next) {
+		char n = (char)va_arg(args, int);
+
+		assert(tmp->data == (void*)(intptr_t)n);
+	}
+
+	ASSERT(ll->size == vals_n, "has the expected list order and size");
+
+	va_end(args);
+}
+
+/**
+ * Tests
+ */
+
+LinkedList* test_push(LinkedList* ll) {
+	DESCRIBE();
+
+	Node* n2 = cdll_push_back(ll, (void*)'B');
+
+	ASSERT(n2->next == n2 && n2->prev == n2, "inserts a node as the head when the list is empty");
+
+	Node* n3 = cdll_push_back(ll, (void*)'C');
+	Node* n1 = cdll_push_front(ll, (void*)'A');
+
+	ASSERT(ll->head == n1, "pushes to the front");
+	assert_ordinal_pointers(ll, 3, n1, n2, n3);
+
+	return ll;
+}
+
+LinkedList* test_multi_node_ll(LinkedList* ll) {
+	DESCRIBE();
+
+	Node* n2 = cdll_push_front(ll, (void*)'B');
+	Node* n1 = cdll_push_front(ll, (void*)'A');
+	Node* n3 = cdll_push_back(ll, (void*)'C');
+	Node* n4 = cdll_push_back(ll, (void*)'D');
+
+	assert_ordinal_pointers(ll, 4, n1, n2, n3, n4);
+
+	ASSERT(cdll_prev(ll, n1) == n4 && cdll_next(ll, n4) == n1, "links the head and tail");
+
+	cdll_remove_node(ll, n2);
+	assert_ordinal_pointers(ll, 3, n1, n3, n4);
+
+	ASSERT(cdll_remove_node(ll, n2) == NULL, "is a no-op when removing a non-member");
+	free(n2);
+
+	free(cdll_remove_node(ll, ll->head));
+	assert_ordinal_pointers(ll, 2, n3, n4);
+
+	ASSERT(cdll_pop(ll) == n4, "pops the tail");
+	free(n4);
+
+	n2 = cdll_insert_after(ll, (void*)'B', n3);
+	assert_ordinal_pointers(ll, 2, n3, n2);
+
+	n1 = cdll_insert_before(ll, (void*)'A', n3);
+	assert_ordinal_pointers(ll, 3, n3, n2, n1);
+	ASSERT(n1->next == n3, "inserts before the head at the back of the ring");
+
+	ASSERT(cdll_pop_front(ll) == n3, "pops the head");
+	free(n3);
+
+	free(cdll_pop(ll));
+	free(cdll_pop(ll));
+
+	ASSERT(cdll_pop(ll) == NULL && ll->head == NULL && ll->size == 0, "empties the list");
+
+	return ll;
+}
+
+LinkedList* test_move(LinkedList* ll) {
+	DESCRIBE();
+
+	Node* n1 = cdll_push_back(ll, (void*)'A');
+	Node* n2 = cdll_push_back(ll, (void*)'B');
+	Node* n3 = cdll_push_back(ll, (void*)'C');
+	Node* n4 = cdll_push_back(ll, (void*)'D');
+
+	ASSERT(cdll_move_after(ll, n3, n3) == -1, "a) is a no-op");
+	ASSERT(cdll_move_before(ll, n2, n2) == -1, "b) is a no-op");
+	ASSERT(cdll_move_after(ll, n3, n2) == -1, "c) is a no-op");
+	ASSERT(cdll_move_before(ll, n2, n3) == -1, "d) is a no-op");
+	assert_ordinal_pointers(ll, 4, n1, n2, n3, n4);
+
+	cdll_move_before(ll, n2, n4);
+	assert_ordinal_pointers(ll, 4, n1, n3, n2, n4);
+
+	cdll_move_after(ll, n3, n4);
+	assert_ordinal_pointers(ll, 4, n1, n2, n4, n3);
+
+	cdll_move_after(ll, n1, n4);
+	assert_ordinal_pointers(ll, 4, n2, n4, n1, n3);
+
+	cdll_move_before(ll, n4, n2);
+	assert_ordinal_pointers(ll, 4, n2, n1, n3, n4);
+
+	return ll;
+}
+
+LinkedList* test_extensibility(LinkedList* ll) {
+	DESCRIBE();
+
+	LinkedList* l2 = cdll_make_list();
+	LinkedList* l3 = cdll_make_list();
+
+	cdll_push_back(ll, (void*)'A');
+	cdll_push_back(ll, (void*)'B');
+
+	cdll_push_back(l2, (void*)'C');
+
+	cdll_push_back_list(l3, ll);
+	cdll_push_back_list(l3, l2);
+	assert_ordinal_data(l3, 3, 'A', 'B', 'C');
+
+	cdll_push_front_list(l2, ll);
+	assert_ordinal_data(l2, 3, 'A', 'B', 'C');
+
+	cdll_push_front_list(ll, ll);
+	assert_ordinal_data(ll, 4, 'A', 'B', 'A', 'B');
+
+	cdll_push_back_list(ll, ll);
+	assert_ordinal_data(ll, 8, 'A', 'B', 'A', 'B', 'A', 'B', 'A', 'B');
+
+	teardown(l2);
+	teardown(l3);
+
+	return ll;
+}
+
+LinkedList* test_pooled(LinkedList* ll) {
+	DESCRIBE();
+
+	NodePool_t* pool = node_pool_make(sizeof(Node), 4);
+	LinkedList* l2 = cdll_make_list_owning_allocator(&pool->allocator);
+
+	for (int i = 0; i < 10; i++) cdll_push_back(l2, NULL);
+
+	Node* n = cdll_pop_front(l2);
+	cdll_release_node(l2, n);
+
+	ASSERT(cdll_push_front(l2, NULL) == n, "recycles nodes through the list's allocator");
+
+	LinkedList* l3 = cdll_make_list_with_allocator(&pool->allocator);
+
+	cdll_push_back(l3, NULL);
+	cdll_destroy_list(l3);
+
+	ASSERT(pool->chunks != NULL && cdll_push_back(l2, NULL) != NULL, "shares a pool with a list that does not own it");
+
+	cdll_destroy_list(l2);
+
+	return ll;
+}
+
+/**
+ * Runner
+ */
+
+int main() {
+	run_test(setup, teardown, test_push);
+	run_test(setup, teardown, test_multi_node_ll);
+	run_test(setup, teardown, test_move);
+	run_test(setup, teardown, test_extensibility);
+	run_test(setup, teardown, test_pooled);
+
+	return EXIT_SUCCESS;
+}
@@ -475,6 +475,415 @@ LinkedList* test_single_node_ll(LinkedList* ll) {
 	return ll;
 }
 
+LinkedList* test_tail(LinkedList* ll) {
+	DESCRIBE();
+
+	Node* n2 = csll_push_back(ll, 'B');
+	ASSERT(ll->tail == n2 && ll->tail->next == ll->head, "tracks the tail of a single-node list");
+
+	Node* n1 = csll_push_front(ll, 'A');
+	Node* n3 = csll_push_back(ll, 'C');
+	ASSERT(ll->tail == n3 && n3->next == n1, "tracks the tail across pushes at either end");
+
+	Node* n4 = csll_insert_after(ll, 'D', n3);
+	ASSERT(ll->tail == n4 && n4->next == n1, "tracks the tail when inserting after the tail");
+
+	csll_move_after(ll, n2, n4);
+	assert_ordinal_pointers(ll, 4, n1, n3, n4, n2);
+	ASSERT(ll->tail == n2 && n2->next == n1, "tracks the tail when moving a node after the tail");
+
+	csll_move_before(ll, n2, n3);
+	assert_ordinal_pointers(ll, 4, n1, n2, n3, n4);
+	ASSERT(ll->tail == n4 && n4->next == n1, "tracks the tail when moving the tail");
+
+	csll_remove_node(ll, n4);
+	ASSERT(ll->tail == n3 && n3->next == n1, "tracks the tail when removing the tail");
+
+	csll_remove_node(ll, n1);
+	ASSERT(ll->head == n2 && n3->next == n2, "relinks the tail when removing the head");
+
+	free(n1);
+	free(n4);
+
+	return ll;
+}
+
+LinkedList* test_pop_front(LinkedList* ll) {
+	DESCRIBE();
+
+	Node* n1 = csll_push_back(ll, 'A');
+	Node* n2 = csll_push_back(ll, 'B');
+	Node* n3 = csll_push_back(ll, 'C');
+
+	ASSERT(csll_pop_front(ll) == n1, "removes the head");
+	assert_ordinal_pointers(ll, 2, n2, n3);
+	ASSERT(ll->tail->next == n2, "links the tail to the new head");
+
+	ASSERT(csll_pop_front(ll) == n2, "removes the head");
+	ASSERT(csll_pop_front(ll) == n3, "removes the last remaining node");
+	ASSERT(!ll->head && !ll->tail && ll->size == 0, "empties the list");
+	ASSERT(csll_pop_front(ll) == NULL, "is a no-op on an empty list");
+
+	Node* n4 = csll_push_back(ll, 'D');
+	ASSERT(ll->head == n4 && ll->tail == n4, "reuses an emptied list");
+
+	free(n1);
+	free(n2);
+	free(n3);
+
+	return ll;
+}
+
+/* Orders by the high nibble only, such that values sharing it compare equal and expose instability */
+int compare_nibble(void* a, void* b) {
+	intptr_t x = (intptr_t)a >> 4, y = (intptr_t)b >> 4;
+
+	if (x == y) return 0;
+	return x < y ? -1 : 1;
+}
+
+LinkedList* test_sort(LinkedList* ll) {
+	DESCRIBE();
+
+	csll_sort(ll, compare_nibble);
+	ASSERT(ll->head == NULL, "is a no-op on an empty list");
+
+	csll_push_back(ll, 0x31);
+	csll_push_back(ll, 0x12);
+	csll_push_back(ll, 0x32);
+	csll_push_back(ll, 0x11);
+	csll_push_back(ll, 0x21);
+
+	csll_sort(ll, compare_nibble);
+	assert_ordinal_data(ll, 5, 0x12, 0x11, 0x21, 0x31, 0x32);
+	ASSERT(ll->tail->data == (void*)0x32 && ll->tail->next == ll->head, "closes the ring at the new tail");
+
+	for (int i = 0; i < 1000; i++) csll_push_back(ll, (void*)(intptr_t)(random() % 4096));
+
+	csll_sort(ll, compare_nibble);
+
+	Node* n = ll->head;
+
+	for (uint32_t i = 1; i < ll->size; i++, n = n->next) assert(compare_nibble(n->data, n->next->data) != 1);
+
+	ASSERT(ll->size == 1005, "sorts a large list");
+
+	return ll;
+}
+
+LinkedList* test_merge(LinkedList* ll) {
+	DESCRIBE();
+
+	LinkedList* l2 = csll_make_list();
+
+	csll_push_back(ll, 0x11);
+	csll_push_back(ll, 0x31);
+
+	csll_push_back(l2, 0x02);
+	csll_push_back(l2, 0x12);
+	csll_push_back(l2, 0x42);
+
+	ASSERT(csll_merge(ll, ll, compare_nibble) == -1, "rejects merging a list into itself");
+
+	csll_merge(ll, l2, compare_nibble);
+	assert_ordinal_data(ll, 5, 0x02, 0x11, 0x12, 0x31, 0x42);
+
+	ASSERT(l2->head == NULL && l2->size == 0, "empties the other list");
+	ASSERT(ll->tail->data == (void*)0x42 && ll->tail->next == ll->head, "closes the ring at the new tail");
+	ASSERT(csll_next(ll, ll->head) != NULL, "adopts the other list's nodes");
+
+	csll_merge(l2, ll, compare_nibble);
+	ASSERT(l2->size == 5 && ll->size == 0, "merges into an empty list");
+
+	teardown(l2);
+
+	NodePool_t* pool = node_pool_make(sizeof(Node), 4);
+	LinkedList* owner = csll_make_list_owning_allocator(&pool->allocator);
+	LinkedList* a = csll_make_list_with_allocator(&pool->allocator);
+	LinkedList* b = csll_make_list_with_allocator(&pool->allocator);
+
+	csll_push_back(a, 0x11);
+	csll_push_back(b, 0x02);
+	csll_push_back(owner, 0x21);
+
+	ASSERT(csll_merge(a, b, compare_nibble) == 0 && a->size == 2, "merges two lists sharing a pool");
+
+	csll_destroy_list(b);
+	assert_ordinal_data(a, 2, 0x02, 0x11);
+
+	ASSERT(csll_merge(a, owner, compare_nibble) == -1, "rejects merging from a list that owns its allocator");
+	ASSERT(csll_merge(owner, a, compare_nibble) == 0 && owner->size == 3, "merges into a list that owns its allocator");
+
+	csll_destroy_list(a);
+	csll_destroy_list(owner);
+
+	return ll;
+}
+
+int stop_at_c(Node* node, void* ctx) {
+	(*(int*)ctx)++;
+
+	return node->data == (void*)'C';
+}
+
+LinkedList* test_cursor(LinkedList* ll) {
+	DESCRIBE();
+
+	Node* n = NULL;
+	int visits = 0;
+
+	CSLL_FOREACH(ll, n) visits++;
+	ASSERT(visits == 0 && csll_iterate_ctx(ll, stop_at_c, &visits) == NULL, "visits nothing in an empty list");
+
+	Node* n1 = csll_push_back(ll, 'A');
+	Node* n2 = csll_push_back(ll, 'B');
+	Node* n3 = csll_push_back(ll, 'C');
+	Node* n4 = csll_push_back(ll, 'D');
+	Node* expected[] = { n1, n2, n3, n4 };
+
+	CSLL_FOREACH(ll, n) assert(n == expected[visits++]);
+	ASSERT(visits == 4, "visits every node in order");
+
+	csll_cursor_t c = csll_cursor_make(ll, 100);
+
+	for (visits = 0; (n = csll_cursor_next(&c)); visits++) assert(n == expected[visits]);
+	ASSERT(visits == 4, "tolerates a prefetch distance beyond the list size");
+
+	visits = 0;
+	CSLL_FOREACH(ll, n) {
+		if (n == n2) break;
+		visits++;
+	}
+	ASSERT(visits == 1, "terminates early on break");
+
+	visits = 0;
+	ASSERT(csll_iterate_ctx(ll, stop_at_c, &visits) == n3 && visits == 3, "passes the context and stops when the callback returns non-zero");
+
+	CSLL_FOREACH(ll, n) {
+		if (n == n2 || n == n4) free(csll_remove_node(ll, n));
+	}
+	assert_ordinal_pointers(ll, 2, n1, n3);
+
+	for (int i = 0; i < 5; i++) csll_push_back(ll, 'E');
+
+	CSLL_FOREACH(ll, n) free(csll_remove_node(ll, n));
+	ASSERT(ll->size == 0, "allows the current node to be removed while draining a short ring");
+
+	return ll;
+}
+
+typedef struct remap_log {
+	Node* from[64];
+	Node* to[64];
+	int n;
+} remap_log_t;
+
+void log_remap(Node* from, Node* to, void* ctx) {
+	remap_log_t* log = ctx;
+
+	assert(from->data == to->data);
+
+	log->from[log->n] = from;
+	log->to[log->n++] = to;
+}
+
+LinkedList* test_compact(LinkedList* ll) {
+	DESCRIBE();
+
+	NodePool_t* pool = node_pool_make(sizeof(Node), 64);
+	LinkedList* l2 = csll_make_list_owning_allocator(&pool->allocator);
+	remap_log_t log = { .n = 0 };
+
+	ASSERT(csll_compact(l2, NULL, NULL) == 0 && csll_fragmentation(l2) == 0, "is a no-op on an empty list");
+
+	// the pool hands out ascending addresses, so pushing to the front traverses against address order
+	for (intptr_t i = 0; i < 32; i++) csll_push_front(l2, (void*)i);
+
+	ASSERT(csll_fragmentation(l2) == 1, "reports a list traversed against address order as fully fragmented");
+
+	Node* head = l2->head;
+
+	ASSERT(csll_compact(l2, log_remap, &log) == 0, "compacts the list");
+	ASSERT(csll_fragmentation(l2) == 0, "lays nodes out in traversal order");
+	ASSERT(log.n == 32 && log.from[0] == head && log.to[0] == l2->head, "reports each node's new address");
+
+	Node* n = l2->head;
+
+	for (intptr_t i = 31; i >= 0; i--, n = n->next) {
+		assert(n->data == (void*)i && n->list == l2);
+	}
+
+	ASSERT(n == l2->head && l2->tail->next == l2->head && l2->size == 32, "preserves order and size");
+
+	csll_push_back(l2, (void*)32);
+	csll_release_node(l2, csll_pop_front(l2));
+	ASSERT(csll_compact(l2, NULL, NULL) == 0 && l2->size == 32, "recompacts a list whose allocator is a pool");
+
+	LinkedList* l3 = csll_make_list();
+
+	for (intptr_t i = 0; i < 8; i++) csll_push_back(l3, (void*)i);
+
+	ASSERT(csll_compact(l3, NULL, NULL) == 0 && l3->allocator != NULL, "compacts a list of malloc'd nodes");
+	ASSERT(l3->head->data == (void*)0 && l3->tail->data == (void*)7, "preserves order");
+
+	NodePool_t* shared = node_pool_make(sizeof(Node), 8);
+	LinkedList* l4 = csll_make_list_with_allocator(&shared->allocator);
+	LinkedList* l5 = csll_make_list_with_allocator(&shared->allocator);
+
+	for (intptr_t i = 0; i < 4; i++) {
+		csll_push_front(l4, (void*)i);
+		csll_push_back(l5, (void*)i);
+	}
+
+	ASSERT(csll_compact(l4, NULL, NULL) == 0 && l4->allocator != &shared->allocator && l4->owns_allocator, "replaces the allocator with a pool the list owns");
+	ASSERT(l4->head->data == (void*)3 && l4->tail->data == (void*)0, "preserves order of a list whose allocator is shared");
+	ASSERT(csll_push_back(l5, (void*)4) && l5->size == 5 && l5->tail->data == (void*)4, "leaves a shared allocator usable by other lists");
+
+	csll_destroy_list(l2);
+	csll_destroy_list(l3);
+	csll_destroy_list(l4);
+	csll_destroy_list(l5);
+	node_pool_destroy(shared);
+
+	return ll;
+}
+
+int is_lowercase(Node* node, void* ctx) {
+	(void)ctx;
+
+	return (intptr_t)node->data >= 'a';
+}
+
+int is_uppercase(Node* node, void* ctx) {
+	(void)ctx;
+
+	return (intptr_t)node->data < 'a';
+}
+
+void count_disposed(Node* node, void* ctx) {
+	(void)node;
+	(*(int*)ctx)++;
+}
+
+LinkedList* test_remove_if(LinkedList* ll) {
+	DESCRIBE();
+
+	int disposed = 0;
+
+	ASSERT(csll_remove_if(ll, is_lowercase, NULL) == NULL, "is a no-op on an empty list");
+
+	csll_push_back(ll, 'a');
+	csll_push_back(ll, 'B');
+	csll_push_back(ll, 'c');
+	csll_push_back(ll, 'd');
+	csll_push_back(ll, 'E');
+	csll_push_back(ll, 'f');
+
+	Node* removed = csll_remove_if(ll, is_lowercase, NULL);
+
+	assert_ordinal_data(ll, 2, 'B', 'E');
+	ASSERT(ll->tail->data == (void*)'E' && ll->tail->next == ll->head, "closes the ring when the head and tail are removed");
+	ASSERT(
+		removed->data == (void*)'a' && removed->next->data == (void*)'c' && removed->next->next->next->data == (void*)'f',
+		"hands back the removed nodes in order"
+	);
+	ASSERT(removed->next->next->next->next == NULL && removed->list == NULL, "detaches the removed chain");
+
+	while (removed) {
+		Node* next = removed->next;
+
+		csll_release_node(ll, removed);
+		removed = next;
+	}
+
+	ASSERT(csll_remove_if(ll, is_lowercase, NULL) == NULL && ll->size == 2, "is a no-op when no node matches");
+
+	csll_push_back(ll, 'g');
+	ASSERT(csll_retain(ll, is_lowercase, count_disposed, &disposed) == 2 && disposed == 2, "disposes of each node not retained");
+	assert_ordinal_data(ll, 1, 'g');
+
+	for (intptr_t i = 0; i < 1000; i++) csll_push_back(ll, (void*)(i % 2 ? 'h' : 'H'));
+
+	csll_retain(ll, is_uppercase, NULL, NULL);
+	ASSERT(ll->size == 500 && ll->head->data == (void*)'H' && ll->tail->next == ll->head, "purges a large list in one pass");
+
+	csll_retain(ll, is_lowercase, NULL, NULL);
+	ASSERT(ll->head == NULL && ll->tail == NULL && ll->size == 0, "empties the list when no node is retained");
+
+	return ll;
+}
+
+LinkedList* test_rotate(LinkedList* ll) {
+	DESCRIBE();
+
+	ASSERT(csll_rotate(ll, 1) == NULL, "is a no-op on an empty list");
+
+	Node* n1 = csll_push_back(ll, 'A');
+	Node* n2 = csll_push_back(ll, 'B');
+	Node* n3 = csll_push_back(ll, 'C');
+
+	ASSERT(csll_rotate(ll, 1) == n2 && ll->tail == n1, "advances the head by one");
+	assert_ordinal_pointers(ll, 3, n2, n3, n1);
+
+	ASSERT(csll_rotate(ll, 5) == n1 && ll->tail == n3, "wraps rotations beyond the list size");
+	ASSERT(csll_rotate(ll, 3) == n1, "is a no-op when rotating by the list size");
+
+	csll_push_back(ll, 'D');
+	assert_ordinal_data(ll, 4, 'A', 'B', 'C', 'D');
+
+	return ll;
+}
+
+LinkedList* test_round_robin(LinkedList* ll) {
+	DESCRIBE();
+
+	csll_rr_cursor_t c;
+
+	csll_rr_init(&c, ll);
+	ASSERT(csll_rr_next(&c) == NULL && csll_rr_remove(&c) == NULL, "yields nothing from an empty list");
+
+	Node* n1 = csll_push_back(ll, 'A');
+	Node* n2 = csll_push_back(ll, 'B');
+	Node* n3 = csll_push_back(ll, 'C');
+
+	ASSERT(csll_rr_next(&c) == n1 && csll_rr_next(&c) == n2, "yields from the head");
+	ASSERT(csll_rr_next(&c) == n3 && csll_rr_next(&c) == n1, "wraps from the tail to the head");
+	ASSERT(csll_rr_skip(&c, 4) == n2, "skips nodes");
+
+	csll_rr_cursor_t fresh;
+
+	csll_rr_init(&fresh, ll);
+	ASSERT(csll_rr_skip(&fresh, 3) == n3, "skips from a fresh cursor as would repeated calls to csll_rr_next");
+
+	ASSERT(csll_rr_remove(&c) == n2 && csll_rr_remove(&c) == NULL, "removes the current node once");
+	assert_ordinal_pointers(ll, 2, n1, n3);
+
+	csll_rr_cursor_t removed = c;
+
+	ASSERT(csll_rr_skip(&removed, 2) == n1, "skips a multiple of the size from a removed node");
+	ASSERT(csll_rr_next(&c) == n3, "yields the removed node's successor");
+
+	ASSERT(csll_rr_remove(&c) == n3 && ll->tail == n1 && ll->tail->next == ll->head, "removes the tail");
+	ASSERT(csll_rr_next(&c) == n1 && csll_rr_next(&c) == n1, "cycles over a single node");
+
+	Node* n4 = csll_push_front(ll, 'D');
+
+	ASSERT(csll_rr_remove(&c) == n1, "a) removes a node whose predecessor changed since it was yielded");
+	assert_ordinal_pointers(ll, 1, n4);
+	ASSERT(ll->tail == n4 && n4->next == n4, "b) removes a node whose predecessor changed since it was yielded");
+
+	ASSERT(csll_rr_next(&c) == n4 && csll_rr_remove(&c) == n4 && ll->head == NULL, "empties the list");
+
+	csll_release_node(ll, n1);
+	csll_release_node(ll, n2);
+	csll_release_node(ll, n3);
+	csll_release_node(ll, n4);
+
+	n1 = csll_push_back(ll, 'E');
+	ASSERT(csll_rr_next(&c) == n1, "restarts at the head once the list is refilled");
+
+	return ll;
+}
 
 /**
  * Runner
@@ -493,6 +902,15 @@ int main() {
 	run_test(setup, teardown, test_move);
 	run_test(setup, teardown, test_modification);
 	run_test(setup, teardown, test_single_node_ll);
+	run_test(setup, teardown, test_tail);
+	run_test(setup, teardown, test_pop_front);
+	run_test(setup, teardown, test_sort);
+	run_test(setup, teardown, test_merge);
+	run_test(setup, teardown, test_cursor);
+	run_test(setup, teardown, test_compact);
+	run_test(setup, teardown, test_remove_if);
+	run_test(setup, teardown, test_rotate);
+	run_test(setup, teardown, test_round_robin);
 
 	return EXIT_SUCCESS;
 }
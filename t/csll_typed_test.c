@@ -0,0 +1,189 @@
+#include "test_util.h"
+
+#include "csll_typed.h"
+#include <stdarg.h>
+
+/**
+ * Environment
+ */
+
+typedef struct point {
+	long x, y, z, w;
+} point_t;
+
+CSLL_DEFINE(int_list, int)
+CSLL_DEFINE(point_list, point_t)
+
+typedef int_list_t LinkedList;
+
+static int visited[32];
+static int visited_n;
+
+/**
+ * Lifecycle
+ */
+
+int run_test(LinkedList* (*setup)(void), void (*teardown)(LinkedList*), LinkedList* (*test)(LinkedList*)) {
+	teardown(test(setup()));
+}
+
+LinkedList* setup(void) {
+	return int_list_make_list();
+}
+
+LinkedList* setup_pool(void) {
+	NodePool_t* pool = node_pool_make(sizeof(int_list_node_t), 4);
+
+	return int_list_make_list_owning_allocator(&pool->allocator);
+}
+
+void teardown(LinkedList* ll) {
+	int_list_destroy_list(ll);
+}
+
+/**
+ * Helpers
+ */
+
+void* fail_alloc(void* ctx, size_t size) {
+	(void)ctx;
+	(void)size;
+
+	return NULL;
+}
+
+void visit(int* value) {
+	visited[visited_n++] = *value;
+}
+
+void scale(point_t* p) {
+	p->x *= 2;
+	p->w *= 2;
+}
+
+/* Asserts order via the links, via iteration and via CSLL_TYPED_FOREACH, and that the list is congruent with its size */
+void assert_ordinal_data(LinkedList* ll, int vals_n, ...) {
+	va_list args;
+	int_list_node_t* n;
+	int i = 0;
+
+	va_start(args, vals_n);
+
+	visited_n = 0;
+	int_list_iterate(ll, visit);
+
+	CSLL_TYPED_FOREACH(ll, n) {
+		int v = va_arg(args, int);
+
+		assert(n->value == v);
+		assert(visited[i++] == v);
+	}
+
+	va_end(args);
+
+	assert(!vals_n || ll->tail->next == ll->head);
+
+	ASSERT(ll->size == vals_n && visited_n == vals_n && i == vals_n, "has the expected list order and size");
+}
+
+/**
+ * Tests
+ */
+
+LinkedList* test_push_pop(LinkedList* ll) {
+	DESCRIBE();
+
+	int out = 0;
+
+	ASSERT(int_list_pop(ll, &out) == -1 && int_list_pop_front(ll, &out) == -1, "returns -1 when popping an empty list");
+	ASSERT(int_list_front(ll) == NULL && int_list_back(ll) == NULL, "has no front or back when empty");
+
+	int_list_push_back(ll, 2);
+	int_list_push_back(ll, 3);
+	int_list_push_front(ll, 1);
+	assert_ordinal_data(ll, 3, 1, 2, 3);
+
+	ASSERT(*int_list_front(ll) == 1 && *int_list_back(ll) == 3, "exposes the front and back values in place");
+
+	ASSERT(int_list_pop(ll, &out) == 0 && out == 3, "pops the tail");
+	ASSERT(int_list_pop_front(ll, &out) == 0 && out == 1, "pops the head");
+	assert_ordinal_data(ll, 1, 2);
+
+	ASSERT(int_list_pop(ll, NULL) == 0, "discards the value when `out` is NULL");
+	ASSERT(ll->head == NULL && ll->tail == NULL && ll->size == 0, "empties the list");
+
+	int_list_push_front(ll, 4);
+	assert_ordinal_data(ll, 1, 4);
+
+	return ll;
+}
+
+LinkedList* test_allocator(LinkedList* ll) {
+	DESCRIBE();
+
+	for (int i = 0; i < 10; i++) int_list_push_back(ll, i);
+
+	int_list_pop_front(ll, NULL);
+	int_list_pop_front(ll, NULL);
+	int_list_push_back(ll, 10);
+	int_list_push_back(ll, 11);
+
+	assert_ordinal_data(ll, 10, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11);
+
+	ASSERT(ll->allocator != NULL && ll->owns_allocator, "draws nodes from the given allocator, which the list releases on destroy");
+
+	NodePool_t* shared = node_pool_make(sizeof(int_list_node_t), 4);
+	int_list_t* a = int_list_make_list_with_allocator(&shared->allocator);
+	int_list_t* b = int_list_make_list_with_allocator(&shared->allocator);
+
+	int_list_push_back(a, 1);
+	int_list_push_back(b, 2);
+	int_list_destroy_list(a);
+
+	ASSERT(int_list_push_back(b, 3) && *int_list_back(b) == 3 && b->size == 2, "leaves a shared allocator to its other lists on destroy");
+
+	int_list_destroy_list(b);
+	node_pool_destroy(shared);
+
+	NodeAllocator_t exhausted = { fail_alloc, NULL, NULL, NULL };
+	int_list_t* c = int_list_make_list_with_allocator(&exhausted);
+
+	ASSERT(!int_list_push_back(c, 1) && !int_list_push_front(c, 1) && c->size == 0 && !c->head, "propagates allocation failure");
+
+	int_list_destroy_list(c);
+
+	return ll;
+}
+
+LinkedList* test_struct_values(LinkedList* ll) {
+	DESCRIBE();
+
+	point_list_t* pl = point_list_make_list();
+	point_t out;
+
+	point_list_push_back(pl, (point_t){1, 2, 3, 4});
+	point_list_push_back(pl, (point_t){5, 6, 7, 8});
+
+	ASSERT(sizeof(point_list_node_t) == sizeof(void*) + sizeof(point_t), "stores the value inline in the node");
+
+	point_list_iterate(pl, scale);
+
+	ASSERT(point_list_pop_front(pl, &out) == 0 && out.x == 2 && out.y == 2 && out.w == 8, "copies the value out");
+	ASSERT(point_list_front(pl)->x == 10 && pl->size == 1, "mutates values in place");
+
+	point_list_destroy_list(pl);
+
+	return ll;
+}
+
+/**
+ * Runner
+ */
+
+int main() {
+	run_test(setup, teardown, test_push_pop);
+	run_test(setup_pool, teardown, test_allocator);
+	run_test(setup, teardown, test_struct_values);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,156 @@
+#include "test_util.h"
+
+#include "libcartilage.h"
+
+#define FUZZ_MEMBERS 32
+#define FUZZ_ROUNDS 200
+
+/**
+ * Environment
+ */
+
+typedef drr_scheduler_t Scheduler;
+
+/**
+ * Lifecycle
+ */
+
+int run_test(Scheduler* (*setup)(void), void (*teardown)(Scheduler*), Scheduler* (*test)(Scheduler*)) {
+	teardown(test(setup()));
+}
+
+Scheduler* setup(void) {
+	return drr_make();
+}
+
+void teardown(Scheduler* s) {
+	drr_destroy(s);
+}
+
+/**
+ * Helpers
+ */
+
+void* fail_alloc(void* ctx, size_t size) {
+	(void)ctx;
+	(void)size;
+
+	return NULL;
+}
+
+/* Asserts the next picks yield the given data, in order */
+void assert_picks(Scheduler* s, const char* expected, const char* desc) {
+	for (const char* c = expected; *c; c++) assert(drr_pick(s)->data == (void*)(intptr_t)*c);
+
+	ASSERT(1, desc);
+}
+
+/**
+ * Tests
+ */
+
+Scheduler* test_pick(Scheduler* s) {
+	DESCRIBE();
+
+	ASSERT(drr_pick(s) == NULL && drr_size(s) == 0, "picks nothing from an empty scheduler");
+	ASSERT(drr_add(s, (void*)'X', 0) == NULL, "rejects a zero quantum");
+
+	drr_add(s, (void*)'A', 1);
+	drr_add(s, (void*)'B', 3);
+	drr_add(s, (void*)'C', 2);
+
+	ASSERT(drr_size(s) == 3, "counts its members");
+	assert_picks(s, "ABBBCC" "ABBBCC", "grants each member its quantum per round");
+
+	drr_member_t* out[8];
+
+	ASSERT(drr_pick_batch(s, out, 8) == 8, "fills a batch");
+	ASSERT(out[0]->data == (void*)'A' && out[3]->data == (void*)'B' && out[7]->data == (void*)'B', "a) picks in order");
+
+	assert_picks(s, "BBCC", "b) picks in order");
+
+	return s;
+}
+
+Scheduler* test_add_remove(Scheduler* s) {
+	DESCRIBE();
+
+	drr_member_t* a = drr_add(s, (void*)'A', 2);
+	drr_member_t* b = drr_add(s, (void*)'B', 2);
+
+	drr_pick_batch(s, (drr_member_t*[3]){ 0 }, 3);
+
+	drr_member_t* c = drr_add(s, (void*)'C', 1);
+
+	ASSERT(drr_pick(s) == b, "finishes the current member's round");
+	ASSERT(drr_pick(s) == c && drr_pick(s) == a, "visits an added member at the ring's tail");
+
+	ASSERT(drr_remove(s, a) == 0 && drr_size(s) == 2, "removes the member last picked");
+	assert_picks(s, "BBC" "BBC", "skips the removed member");
+
+	ASSERT(drr_remove(s, b) == 0 && drr_size(s) == 1, "marks a member that is not current");
+	ASSERT(drr_remove(s, b) == -1, "rejects removing a member twice");
+	assert_picks(s, "CCC", "unlinks the marked member when the cursor reaches it");
+
+	ASSERT(drr_remove(s, c) == 0 && drr_pick(s) == NULL && drr_pick_batch(s, &a, 1) == 0, "empties the scheduler");
+
+	drr_add(s, (void*)'D', 1);
+	assert_picks(s, "DD", "picks again once refilled");
+
+	NodeAllocator_t* nodes = s->ring->allocator;
+	NodeAllocator_t exhausted = { fail_alloc, NULL, NULL, NULL };
+
+	s->ring->allocator = &exhausted;
+
+	ASSERT(drr_add(s, (void*)'E', 1) == NULL && drr_size(s) == 1, "fails to add a member whose node cannot be allocated");
+
+	s->ring->allocator = nodes;
+
+	ASSERT(drr_add(s, (void*)'F', 1) != NULL, "adds again once nodes can be allocated");
+	assert_picks(s, "FD", "a) leaves the ring intact on failure");
+	ASSERT(s->ring->size == 2, "b) leaves the ring intact on failure");
+
+	return s;
+}
+
+Scheduler* test_fairness(Scheduler* s) {
+	DESCRIBE();
+
+	drr_member_t* members[FUZZ_MEMBERS];
+	uint32_t picks[FUZZ_MEMBERS] = { 0 };
+	uint32_t total = 0;
+
+	for (intptr_t i = 0; i < FUZZ_MEMBERS; i++) members[i] = drr_add(s, (void*)i, i % 4 + 1);
+
+	// replace every eighth member; none has been picked yet, so each is unlinked lazily
+	for (int i = 0; i < FUZZ_MEMBERS; i += 8) {
+		drr_remove(s, members[i]);
+		members[i] = drr_add(s, (void*)(intptr_t)i, i % 4 + 1);
+	}
+
+	for (uint32_t i = 0; i < FUZZ_MEMBERS; i++) total += i % 4 + 1;
+
+	for (int r = 0; r < FUZZ_ROUNDS; r++) {
+		for (uint32_t i = 0; i < total; i++) picks[(intptr_t)drr_pick(s)->data]++;
+	}
+
+	int fair = 1;
+
+	for (int i = 0; i < FUZZ_MEMBERS; i++) fair &= picks[i] >= (uint32_t)(FUZZ_ROUNDS - 1) * (i % 4 + 1);
+
+	ASSERT(fair && drr_size(s) == FUZZ_MEMBERS, "picks each member in proportion to its quantum");
+
+	return s;
+}
+
+/**
+ * Runner
+ */
+
+int main() {
+	run_test(setup, teardown, test_pick);
+	run_test(setup, teardown, test_add_remove);
+	run_test(setup, teardown, test_fairness);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,209 @@
+#include "test_util.h"
+
+#include "libcartilage.h"
+
+#define USERS_N 1000
+#define FUZZ_KEYS 512
+#define FUZZ_OPS 100000
+
+/**
+ * Environment
+ */
+
+typedef struct user {
+	long id;
+	glthread_t hash_link;
+	glthread_t order_link;
+} user_t;
+
+static int visited_n;
+
+uint64_t hash_id(const void* key) {
+	return *(const long*)key;
+}
+
+int eq_id(const void* a, const void* b) {
+	return *(const long*)a == *(const long*)b;
+}
+
+int compare_id(void* a, void* b) {
+	long ka = ((user_t*)a)->id;
+	long kb = ((user_t*)b)->id;
+
+	if (ka == kb) return 0;
+	return ka < kb ? -1 : 1;
+}
+
+/**
+ * Lifecycle
+ */
+
+int run_test(glthread_hash_t* (*setup)(void), void (*teardown)(glthread_hash_t*), glthread_hash_t* (*test)(glthread_hash_t*)) {
+	teardown(test(setup()));
+}
+
+glthread_hash_t* setup(void) {
+	glthread_hash_t* h = malloc(sizeof(glthread_hash_t));
+
+	glthread_hash_init(h, 0, hash_id, eq_id, offsetof(user_t, hash_link), offsetof(user_t, id));
+
+	return h;
+}
+
+void teardown(glthread_hash_t* h) {
+	glthread_hash_destroy(h);
+	free(h);
+}
+
+/**
+ * Helpers
+ */
+
+void visit(void* data) {
+	(void)data;
+
+	visited_n++;
+}
+
+/**
+ * Tests
+ */
+
+glthread_hash_t* test_insert_find_remove(glthread_hash_t* h) {
+	DESCRIBE();
+
+	user_t a = { .id = 1 }, b = { .id = 2 }, dup = { .id = 1 };
+	long missing = 3;
+
+	ASSERT(glthread_hash_insert(h, &a.hash_link) == 0 && glthread_hash_insert(h, &b.hash_link) == 0, "inserts objects");
+	ASSERT(glthread_hash_insert(h, &dup.hash_link) == -1 && glthread_hash_size(h) == 2, "rejects a duplicate key");
+
+	ASSERT(glthread_hash_find(h, &a.id) == &a && glthread_hash_find(h, &b.id) == &b, "finds objects by key");
+	ASSERT(glthread_hash_find(h, &missing) == NULL, "returns NULL for a missing key");
+
+	ASSERT(glthread_hash_remove(h, &a.id) == &a && glthread_hash_find(h, &a.id) == NULL, "removes an object by key");
+	ASSERT(glthread_hash_remove(h, &a.id) == NULL, "returns NULL when removing a missing key");
+
+	glthread_hash_remove_node(h, &b.hash_link);
+
+	ASSERT(glthread_hash_size(h) == 0 && glthread_hash_find(h, &b.id) == NULL, "removes an object by its glthread");
+
+	return h;
+}
+
+glthread_hash_t* test_incremental_resize(glthread_hash_t* h) {
+	DESCRIBE();
+
+	user_t* users = calloc(USERS_N, sizeof(user_t));
+	int saw_migration = 0;
+
+	for (long i = 0; i < USERS_N; i++) {
+		unsigned int bits = h->bits;
+
+		users[i].id = i * 7919;
+		glthread_hash_insert(h, &users[i].hash_link);
+
+		if (h->bits != bits) {
+			assert(h->old_buckets && h->migrated <= 2); // grown, but not rehashed at once
+			saw_migration = 1;
+		}
+
+		for (long j = 0; j <= i; j += 1 + i / 16) assert(glthread_hash_find(h, &users[j].id) == &users[j]);
+	}
+
+	ASSERT(saw_migration, "migrates buckets incrementally as the table grows");
+	ASSERT((size_t)1 << h->bits >= USERS_N && glthread_hash_size(h) == USERS_N, "grows with its size");
+
+	visited_n = 0;
+	glthread_hash_iterate(h, visit);
+
+	ASSERT(visited_n == USERS_N, "iterates every object");
+
+	free(users);
+
+	return h;
+}
+
+glthread_hash_t* test_dual_membership(glthread_hash_t* h) {
+	DESCRIBE();
+
+	user_t users[8];
+	glthread_list_t order;
+
+	glthread_list_init(&order);
+
+	for (int i = 0; i < 8; i++) {
+		users[i].id = (i * 5) % 8;
+		glthread_init(&users[i].order_link);
+		glthread_hash_insert(h, &users[i].hash_link);
+		glthread_list_push(&order, &users[i].order_link);
+	}
+
+	glthread_list_sort(&order, compare_id, offsetof(user_t, order_link));
+
+	long id = 3;
+	user_t* u = glthread_hash_remove(h, &id);
+
+	glthread_list_remove(&order, &u->order_link);
+
+	glthread_t* curr;
+	long expected = 0;
+
+	ITERATE_GLTHREAD_BEGIN(&order.head, curr) {
+		if (expected == 3) expected++;
+
+		assert(((user_t*)GET_DATA_FROM_OFFSET(curr, offsetof(user_t, order_link)))->id == expected++);
+	} ITERATE_GLTHREAD_END(&order.head, curr);
+
+	ASSERT(expected == 8 && glthread_hash_size(h) == 7 && order.size == 7, "indexes objects that are also in an ordered glthread");
+
+	return h;
+}
+
+glthread_hash_t* test_fuzz(glthread_hash_t* h) {
+	DESCRIBE();
+
+	user_t* users = calloc(FUZZ_KEYS, sizeof(user_t));
+	int present[FUZZ_KEYS] = { 0 };
+	size_t size = 0;
+
+	for (long i = 0; i < FUZZ_KEYS; i++) users[i].id = i;
+
+	for (int op = 0; op < FUZZ_OPS; op++) {
+		long k = random() % FUZZ_KEYS;
+
+		if (random() % 2) {
+			assert(glthread_hash_insert(h, &users[k].hash_link) == (present[k] ? -1 : 0));
+			size += !present[k];
+			present[k] = 1;
+		} else {
+			assert(glthread_hash_remove(h, &k) == (present[k] ? &users[k] : NULL));
+			size -= present[k];
+			present[k] = 0;
+		}
+
+		long probe = random() % FUZZ_KEYS;
+
+		assert(glthread_hash_find(h, &probe) == (present[probe] ? &users[probe] : NULL));
+		assert(glthread_hash_size(h) == size);
+	}
+
+	ASSERT(1, "agrees with a reference set across random inserts and removals");
+
+	free(users);
+
+	return h;
+}
+
+/**
+ * Runner
+ */
+
+int main() {
+	run_test(setup, teardown, test_insert_find_remove);
+	run_test(setup, teardown, test_incremental_resize);
+	run_test(setup, teardown, test_dual_membership);
+	run_test(setup, teardown, test_fuzz);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,178 @@
+#include "test_util.h"
+
+#include "libcartilage.h"
+
+#define MAX_TEST_CYCLES 512
+#define OFFSET(struct, member) (unsigned int)(size_t)&(((struct*)0)->member)
+
+/**
+ * Environment
+ */
+
+typedef struct test_data {
+	int x;
+	glthread_heap_node_t node;
+} test_t;
+
+int comparator(void* a, void* b) {
+	test_t* meta_a = a;
+	test_t* meta_b = b;
+
+	if (meta_a->x == meta_b->x) return 0;
+	if (meta_a->x < meta_b->x) return -1;
+	return 1;
+}
+
+test_t* data(glthread_heap_node_t* node) {
+	return GET_DATA_FROM_OFFSET(node, OFFSET(test_t, node));
+}
+
+/**
+ * Lifecycle
+ */
+
+int run_test(glthread_heap_t* (*setup)(void), void (*teardown)(glthread_heap_t*), glthread_heap_t* (*test)(glthread_heap_t*)) {
+	teardown(test(setup()));
+}
+
+glthread_heap_t* setup(void) {
+	glthread_heap_t* heap = malloc(sizeof(glthread_heap_t));
+
+	glthread_heap_init(heap, comparator, OFFSET(test_t, node));
+
+	return heap;
+}
+
+void teardown(glthread_heap_t* heap) {
+	free(heap);
+}
+
+/**
+ * Helpers
+ */
+
+void assert_drains_in_order(glthread_heap_t* heap, unsigned int n) {
+	int last = -1;
+
+	for (unsigned int i = 0; i < n; i++) {
+		glthread_heap_node_t* node = glthread_heap_extract(heap);
+
+		assert(node);
+		assert(data(node)->x >= last);
+		last = data(node)->x;
+	}
+
+	ASSERT(glthread_heap_extract(heap) == NULL && glthread_heap_size(heap) == 0, "drains in priority order");
+}
+
+/**
+ * Tests
+ */
+
+glthread_heap_t* test_heap(glthread_heap_t* heap) {
+	DESCRIBE();
+
+	test_t td[MAX_TEST_CYCLES];
+
+	ASSERT(glthread_heap_peek(heap) == NULL, "a) is a no-op on an empty heap");
+	ASSERT(glthread_heap_extract(heap) == NULL, "b) is a no-op on an empty heap");
+
+	for (int i = 0; i < MAX_TEST_CYCLES; i++) {
+		td[i].x = random() % 100;
+		glthread_heap_insert(heap, &td[i].node);
+	}
+
+	ASSERT(glthread_heap_size(heap) == MAX_TEST_CYCLES, "maintains proper heap size");
+
+	int min = td[0].x;
+	for (int i = 1; i < MAX_TEST_CYCLES; i++) {
+		if (td[i].x < min) min = td[i].x;
+	}
+
+	ASSERT(data(glthread_heap_peek(heap))->x == min, "peeks the first node");
+
+	assert_drains_in_order(heap, MAX_TEST_CYCLES);
+
+	return heap;
+}
+
+glthread_heap_t* test_decrease_key(glthread_heap_t* heap) {
+	DESCRIBE();
+
+	test_t td[MAX_TEST_CYCLES];
+
+	for (int i = 0; i < MAX_TEST_CYCLES; i++) {
+		td[i].x = 100 + random() % 100;
+		glthread_heap_insert(heap, &td[i].node);
+	}
+
+	// force some structure before updating keys
+	glthread_heap_node_t* first = glthread_heap_extract(heap);
+
+	td[MAX_TEST_CYCLES / 2].x = 0;
+	glthread_heap_decrease_key(heap, &td[MAX_TEST_CYCLES / 2].node);
+
+	ASSERT(glthread_heap_peek(heap) == &td[MAX_TEST_CYCLES / 2].node, "moves a node with a decreased key to the front");
+
+	for (int i = 0; i < MAX_TEST_CYCLES; i += 7) {
+		if (&td[i].node == first) continue;
+
+		td[i].x -= random() % 100;
+		glthread_heap_decrease_key(heap, &td[i].node);
+	}
+
+	assert_drains_in_order(heap, MAX_TEST_CYCLES - 1);
+
+	return heap;
+}
+
+glthread_heap_t* test_remove(glthread_heap_t* heap) {
+	DESCRIBE();
+
+	test_t td[MAX_TEST_CYCLES];
+
+	for (int i = 0; i < MAX_TEST_CYCLES; i++) {
+		td[i].x = random() % 1000;
+		glthread_heap_insert(heap, &td[i].node);
+	}
+
+	glthread_heap_extract(heap);
+
+	unsigned int removed = 1;
+
+	for (int i = 0; i < MAX_TEST_CYCLES; i += 3) {
+		if (td[i].node.prev || glthread_heap_peek(heap) == &td[i].node) {
+			glthread_heap_remove(heap, &td[i].node);
+			removed++;
+		}
+	}
+
+	ASSERT(glthread_heap_size(heap) == MAX_TEST_CYCLES - removed, "maintains proper heap size");
+
+	glthread_heap_remove(heap, glthread_heap_peek(heap));
+	removed++;
+
+	ASSERT(glthread_heap_size(heap) == MAX_TEST_CYCLES - removed, "removes the root");
+
+	assert_drains_in_order(heap, MAX_TEST_CYCLES - removed);
+
+	test_t single = { .x = 1 };
+	glthread_heap_insert(heap, &single.node);
+	glthread_heap_remove(heap, &single.node);
+
+	ASSERT(glthread_heap_peek(heap) == NULL, "empties a single-node heap");
+
+	return heap;
+}
+
+/**
+ * Runner
+ */
+
+int main(void) {
+	run_test(setup, teardown, test_heap);
+	run_test(setup, teardown, test_decrease_key);
+	run_test(setup, teardown, test_remove);
+
+	return EXIT_SUCCESS;
+}
@@ -31,7 +31,7 @@ int run_test(glthread_t* (*setup)(void), void (*teardown)(glthread_t*), glthread
 }
 
 glthread_t* setup(void) {
-	glthread_t* t;
+	glthread_t* t = malloc(sizeof(glthread_t));
 
 	glthread_init(t);
 
@@ -39,10 +39,8 @@ glthread_t* setup(void) {
 }
 
 void teardown(glthread_t* thread) {
-	while (thread) {
-		thread = thread->next;
-		glthread_remove(thread);
-	}
+	glthread_del_list(thread);
+	free(thread);
 }
 
 /**
@@ -65,6 +63,227 @@ glthread_t* test_glthread(glthread_t* thread) {
 	return thread;
 }
 
+glthread_t* test_glthread_list(glthread_t* thread) {
+	DESCRIBE();
+
+	test_t td[MAX_TEST_CYCLES];
+	glthread_list_t list;
+
+	glthread_list_init(&list);
+
+	ASSERT(glthread_list_dequeue_first(&list) == NULL, "a) is a no-op on an empty list");
+	ASSERT(glthread_list_pop(&list) == NULL, "b) is a no-op on an empty list");
+
+	for (int i = 0; i < MAX_TEST_CYCLES; i++) {
+		td[i].x = i;
+		glthread_list_push(&list, &td[i].glthread);
+	}
+
+	ASSERT(list.tail == &td[MAX_TEST_CYCLES - 1].glthread, "appends to the tail");
+	ASSERT(glthread_list_size(&list) == MAX_TEST_CYCLES, "maintains proper list size");
+	ASSERT(glthread_size(&list.head) == MAX_TEST_CYCLES, "is congruent with the glthread chain");
+
+	glthread_t* curr = NULL;
+	int i = 0;
+
+	ITERATE_GLTHREAD_BEGIN(&list.head, curr) {
+		assert(((test_t*)GET_DATA_FROM_OFFSET(curr, OFFSET(test_t, glthread)))->x == i++);
+	} ITERATE_GLTHREAD_END(&list.head, curr);
+
+	ASSERT(i == MAX_TEST_CYCLES, "is iterable from its head");
+
+	ASSERT(glthread_list_pop(&list) == &td[MAX_TEST_CYCLES - 1].glthread, "pops the tail");
+	ASSERT(list.tail == &td[MAX_TEST_CYCLES - 2].glthread, "moves the tail back");
+
+	ASSERT(glthread_list_dequeue_first(&list) == &td[0].glthread, "dequeues the head");
+	ASSERT(list.head.next == &td[1].glthread && td[1].glthread.prev == &list.head, "relinks the sentinel");
+
+	glthread_list_push_front(&list, &td[0].glthread);
+	ASSERT(list.head.next == &td[0].glthread, "pushes to the head");
+
+	glthread_list_remove(&list, &td[4].glthread);
+	glthread_list_insert_after(&list, list.tail, &td[4].glthread);
+	ASSERT(list.tail == &td[4].glthread, "moves the tail when inserting after it");
+
+	glthread_list_insert_before(&list, &td[0].glthread, &td[MAX_TEST_CYCLES - 1].glthread);
+	ASSERT(list.head.next == &td[MAX_TEST_CYCLES - 1].glthread, "inserts before the first node");
+	ASSERT(glthread_list_size(&list) == MAX_TEST_CYCLES, "maintains proper list size");
+	ASSERT(glthread_size(&list.head) == MAX_TEST_CYCLES, "is congruent with the glthread chain");
+
+	while (glthread_list_size(&list) > 1) glthread_list_pop(&list);
+
+	ASSERT(list.tail == list.head.next, "tracks the tail of a single-node list");
+
+	glthread_list_remove(&list, list.tail);
+	ASSERT(!list.tail && !list.head.next && glthread_list_size(&list) == 0, "empties the list");
+
+	glthread_list_push(&list, &td[2].glthread);
+	glthread_list_push(&list, &td[3].glthread);
+	glthread_list_del_list(&list);
+	ASSERT(!list.tail && !list.head.next && glthread_list_size(&list) == 0, "deletes all nodes");
+
+	return thread;
+}
+
+/* Ascending by x; equal x compare equal, such that y (the insertion order) exposes instability */
+int compare_x(void* a, void* b) {
+	test_t* ta = a;
+	test_t* tb = b;
+
+	if (ta->x == tb->x) return 0;
+	return ta->x < tb->x ? -1 : 1;
+}
+
+void assert_sorted(glthread_t* head, int n) {
+	glthread_t* curr = NULL;
+	glthread_t* prev = head;
+	test_t* last = NULL;
+	int i = 0;
+
+	ITERATE_GLTHREAD_BEGIN(head, curr) {
+		test_t* t = GET_DATA_FROM_OFFSET(curr, OFFSET(test_t, glthread));
+
+		assert(curr->prev == prev);
+		assert(!last || last->x < t->x || (last->x == t->x && last->y < t->y));
+
+		prev = curr;
+		last = t;
+		i++;
+	} ITERATE_GLTHREAD_END(head, curr);
+
+	assert(i == n);
+}
+
+glthread_t* test_glthread_sort(glthread_t* thread) {
+	DESCRIBE();
+
+	test_t td[MAX_TEST_CYCLES * 2];
+	glthread_list_t list;
+	glthread_list_t other;
+
+	glthread_sort(thread, compare_x, OFFSET(test_t, glthread));
+	ASSERT(thread->next == NULL, "is a no-op on an empty chain");
+
+	for (int i = 0; i < MAX_TEST_CYCLES; i++) {
+		td[i].x = (i * 7) % 4;
+		td[i].y = i;
+		glthread_init(&td[i].glthread);
+		glthread_push(thread, &td[i].glthread);
+	}
+
+	glthread_sort(thread, compare_x, OFFSET(test_t, glthread));
+	assert_sorted(thread, MAX_TEST_CYCLES);
+	ASSERT(1, "sorts stably and restores prev links");
+
+	while (glthread_dequeue_first(thread));
+
+	glthread_list_init(&list);
+	glthread_list_init(&other);
+
+	for (int i = 0; i < MAX_TEST_CYCLES * 2; i++) {
+		td[i].x = (i * 5) % 6;
+		td[i].y = i;
+		glthread_list_push(i % 2 ? &other : &list, &td[i].glthread);
+	}
+
+	glthread_list_sort(&list, compare_x, OFFSET(test_t, glthread));
+	glthread_list_sort(&other, compare_x, OFFSET(test_t, glthread));
+	assert_sorted(&list.head, MAX_TEST_CYCLES);
+	ASSERT(list.tail->next == NULL && list.tail->prev->next == list.tail, "tracks the tail of a sorted list");
+
+	glthread_list_merge(&list, &other, compare_x, OFFSET(test_t, glthread));
+
+	glthread_t* curr = NULL;
+	test_t* last = NULL;
+
+	ITERATE_GLTHREAD_BEGIN(&list.head, curr) {
+		test_t* t = GET_DATA_FROM_OFFSET(curr, OFFSET(test_t, glthread));
+
+		assert(!last || last->x <= t->x);
+		last = t;
+	} ITERATE_GLTHREAD_END(&list.head, curr);
+
+	ASSERT(glthread_list_size(&list) == MAX_TEST_CYCLES * 2 && glthread_size(&list.head) == MAX_TEST_CYCLES * 2, "merges two sorted lists");
+	ASSERT(list.tail == &last->glthread, "tracks the tail of a merged list");
+	ASSERT(!other.tail && !other.head.next && glthread_list_size(&other) == 0, "empties the other list");
+
+	return thread;
+}
+
+int is_odd(void* data, void* ctx) {
+	(void)ctx;
+
+	return ((test_t*)data)->x % 2;
+}
+
+int is_even(void* data, void* ctx) {
+	(void)ctx;
+
+	return !(((test_t*)data)->x % 2);
+}
+
+void count_disposed(void* data, void* ctx) {
+	(void)data;
+	(*(int*)ctx)++;
+}
+
+glthread_t* test_glthread_remove_if(glthread_t* thread) {
+	DESCRIBE();
+
+	test_t td[MAX_TEST_CYCLES];
+	glthread_list_t list;
+	int disposed = 0;
+
+	ASSERT(glthread_remove_if(thread, is_odd, NULL, OFFSET(test_t, glthread)) == NULL, "is a no-op on an empty chain");
+
+	for (int i = 0; i < MAX_TEST_CYCLES; i++) {
+		td[i].x = i;
+		glthread_init(&td[i].glthread);
+		glthread_push(thread, &td[i].glthread);
+	}
+
+	glthread_t* removed = glthread_remove_if(thread, is_odd, NULL, OFFSET(test_t, glthread));
+	glthread_t* curr = NULL;
+	int i = 0;
+
+	ITERATE_GLTHREAD_BEGIN(thread, curr) {
+		assert(curr == &td[i].glthread && curr->prev == (i ? &td[i - 2].glthread : thread));
+		i += 2;
+	} ITERATE_GLTHREAD_END(thread, curr);
+
+	ASSERT(i == MAX_TEST_CYCLES + 1 && glthread_size(thread) == (MAX_TEST_CYCLES + 1) / 2, "relinks the remaining nodes");
+
+	for (i = 1, curr = removed; curr; curr = curr->next, i += 2) {
+		assert(curr == &td[i].glthread && curr->prev == (i > 1 ? &td[i - 2].glthread : NULL));
+	}
+
+	ASSERT(i == MAX_TEST_CYCLES, "hands back the removed nodes as an ordered, detached chain");
+
+	ASSERT(glthread_retain(thread, is_odd, count_disposed, &disposed, OFFSET(test_t, glthread)) == 5, "a) empties the chain");
+	ASSERT(thread->next == NULL && disposed == 5, "b) empties the chain");
+
+	glthread_list_init(&list);
+
+	for (i = 0; i < MAX_TEST_CYCLES; i++) {
+		glthread_init(&td[i].glthread);
+		glthread_list_push(&list, &td[i].glthread);
+	}
+
+	removed = glthread_list_remove_if(&list, is_even, NULL, OFFSET(test_t, glthread));
+	ASSERT(removed == &td[0].glthread && list.tail == &td[MAX_TEST_CYCLES - 2].glthread, "moves the list's tail back");
+	ASSERT(glthread_list_size(&list) == glthread_size(&list.head) && list.size == 4, "maintains proper list size");
+
+	ASSERT(glthread_list_retain(&list, is_even, NULL, NULL, OFFSET(test_t, glthread)) == 4, "retains only matching nodes");
+	ASSERT(list.tail == NULL && list.size == 0 && list.head.next == NULL, "empties the list");
+
+	return thread;
+}
+
 int main(void) {
-	return 0;
+	run_test(setup, teardown, test_glthread);
+	run_test(setup, teardown, test_glthread_list);
+	run_test(setup, teardown, test_glthread_sort);
+	run_test(setup, teardown, test_glthread_remove_if);
+
+	return EXIT_SUCCESS;
 }
@@ -0,0 +1,178 @@
+#include "test_util.h"
+
+#include "glthread_typed.h"
+
+#define ITEMS_N 64
+
+/**
+ * Environment
+ */
+
+typedef struct item {
+	int key;
+	int seq;
+	glthread_t glthread;
+} item_t;
+
+GLTHREAD_DEFINE(item, item_t, glthread, a->key < b->key)
+
+int comparator(void* a, void* b) {
+	int ka = ((item_t*)a)->key;
+	int kb = ((item_t*)b)->key;
+
+	if (ka == kb) return 0;
+	return ka < kb ? -1 : 1;
+}
+
+/**
+ * Lifecycle
+ */
+
+int run_test(glthread_t* (*setup)(void), void (*teardown)(glthread_t*), glthread_t* (*test)(glthread_t*)) {
+	teardown(test(setup()));
+}
+
+glthread_t* setup(void) {
+	glthread_t* head = malloc(sizeof(glthread_t));
+
+	glthread_init(head);
+
+	return head;
+}
+
+void teardown(glthread_t* head) {
+	free(head);
+}
+
+/**
+ * Helpers
+ */
+
+/* Asserts the chain is sorted and stable, has `n` nodes, and that its prev links mirror its next links */
+void assert_sorted(glthread_t* head, int n) {
+	glthread_t* prev = head;
+	item_t* last = NULL;
+	int size = 0;
+
+	for (item_t* it = item_first(head); it; last = it, it = item_next(it), size++) {
+		assert(it->glthread.prev == prev);
+		assert(!last || last->key < it->key || (last->key == it->key && last->seq < it->seq));
+
+		prev = &it->glthread;
+	}
+
+	ASSERT(size == n, "yields a sorted, stable, well-linked chain");
+}
+
+/**
+ * Tests
+ */
+
+glthread_t* test_accessors(glthread_t* head) {
+	DESCRIBE();
+
+	item_t a = { .key = 1 };
+
+	glthread_init(&a.glthread);
+
+	ASSERT(item_from_glthread(&a.glthread) == &a, "recovers the struct from its glthread");
+	ASSERT(item_from_glthread(NULL) == NULL && item_first(head) == NULL, "maps a NULL glthread to NULL");
+
+	item_priority_insert(head, &a);
+
+	ASSERT(item_first(head) == &a && item_next(&a) == NULL, "walks the chain by struct");
+
+	glthread_remove(&a.glthread);
+
+	return head;
+}
+
+glthread_t* test_priority_insert(glthread_t* head) {
+	DESCRIBE();
+
+	item_t items[ITEMS_N], mirror[ITEMS_N];
+	glthread_t mirror_head;
+
+	glthread_init(&mirror_head);
+
+	for (int i = 0; i < ITEMS_N; i++) {
+		items[i] = (item_t){ .key = (i * 37) % 11, .seq = i };
+		mirror[i] = items[i];
+
+		item_priority_insert(head, &items[i]);
+		glthread_priority_insert(&mirror_head, &mirror[i].glthread, comparator, offsetof(item_t, glthread));
+	}
+
+	assert_sorted(head, ITEMS_N);
+
+	item_t* it = item_first(head);
+	glthread_t* m = mirror_head.next;
+
+	for (; it && m; it = item_next(it), m = m->next) {
+		assert(it->seq == ((item_t*)GET_DATA_FROM_OFFSET(m, offsetof(item_t, glthread)))->seq);
+	}
+
+	ASSERT(!it && !m, "orders as glthread_priority_insert does");
+
+	item_t key = { .key = 5 };
+	item_t* found = item_find(head, &key);
+
+	ASSERT(found && found->key == 5, "finds a struct equal to the key");
+
+	item_t* first_five = item_first(head);
+
+	while (first_five->key != 5) first_five = item_next(first_five);
+
+	ASSERT(found == first_five, "finds the first of several equal structs");
+
+	key.key = 11;
+	ASSERT(item_find(head, &key) == NULL, "returns NULL for an absent key");
+
+	key.key = -1;
+	ASSERT(item_find(head, &key) == NULL, "returns NULL for a key preceding every struct");
+
+	return head;
+}
+
+glthread_t* test_merge(glthread_t* head) {
+	DESCRIBE();
+
+	item_t items[ITEMS_N];
+	glthread_t other;
+
+	glthread_init(&other);
+
+	item_merge(head, &other);
+	ASSERT(head->next == NULL, "merges two empty chains");
+
+	for (int i = 0; i < ITEMS_N; i++) {
+		items[i] = (item_t){ .key = (i * 13) % 7, .seq = i };
+
+		item_priority_insert(i < ITEMS_N / 2 ? head : &other, &items[i]);
+	}
+
+	item_merge(head, &other);
+
+	ASSERT(other.next == NULL, "empties the other chain");
+	assert_sorted(head, ITEMS_N);
+
+	glthread_init(&other);
+	item_merge(&other, head);
+
+	ASSERT(head->next == NULL, "merges into an empty chain");
+	assert_sorted(&other, ITEMS_N);
+
+	return head;
+}
+
+/**
+ * Runner
+ */
+
+int main() {
+	run_test(setup, teardown, test_accessors);
+	run_test(setup, teardown, test_priority_insert);
+	run_test(setup, teardown, test_merge);
+
+	return EXIT_SUCCESS;
+}
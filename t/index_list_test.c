@@ -0,0 +1,200 @@
+#include "test_util.h"
+
+#include "libcartilage.h"
+#include <stdarg.h>
+
+/**
+ * Environment
+ */
+
+typedef IndexHandle_t Node;
+
+typedef IndexList_t LinkedList;
+
+static void* visited[32];
+static int visited_n;
+
+/**
+ * Lifecycle
+ */
+
+int run_test(LinkedList* (*setup)(void), void (*teardown)(LinkedList*), LinkedList* (*test)(LinkedList*)) {
+	teardown(test(setup()));
+}
+
+LinkedList* setup(void) {
+	return ilist_make_list(0);
+}
+
+void teardown(LinkedList* ll) {
+	ilist_destroy_list(ll);
+}
+
+/**
+ * Helpers
+ */
+
+void visit(void* data) {
+	visited[visited_n++] = data;
+}
+
+/* Asserts order via the links and via iteration, and that the list is congruent with its size */
+void assert_ordinal_data(LinkedList* ll, int vals_n, ...) {
+	va_list args;
+
+	va_start(args, vals_n);
+
+	uint32_t n = ll->head;
+
+	visited_n = 0;
+	ilist_iterate(ll, visit);
+
+	for (int i = 0; i < vals_n; i++, n = ll->nodes[n].next) {
+		void* v = (void*)(intptr_t)va_arg(args, int);
+
+		assert(ll->nodes[n].data == v);
+		assert(visited[i] == v);
+	}
+
+	va_end(args);
+
+	assert(!vals_n || n == ll->head);
+	assert(!vals_n || ll->nodes[ll->tail].next == ll->head);
+
+	ASSERT(ll->size == vals_n && visited_n == vals_n, "has the expected list order and size");
+}
+
+/**
+ * Tests
+ */
+
+LinkedList* test_push_pop(LinkedList* ll) {
+	DESCRIBE();
+
+	ASSERT(ilist_pop(ll) == NULL && ilist_pop_front(ll) == NULL, "returns NULL when popping an empty list");
+
+	ilist_push_back(ll, (void*)'B');
+	ilist_push_back(ll, (void*)'C');
+	ilist_push_front(ll, (void*)'A');
+	assert_ordinal_data(ll, 3, 'A', 'B', 'C');
+
+	ASSERT(ilist_pop(ll) == (void*)'C', "pops the tail");
+	ASSERT(ilist_pop_front(ll) == (void*)'A', "pops the head");
+	assert_ordinal_data(ll, 1, 'B');
+
+	ilist_pop(ll);
+	ASSERT(ll->head == ILIST_NIL && ll->size == 0, "empties the list");
+
+	return ll;
+}
+
+LinkedList* test_handles(LinkedList* ll) {
+	DESCRIBE();
+
+	Node a = ilist_push_back(ll, (void*)'A');
+	Node b = ilist_push_back(ll, (void*)'B');
+
+	ASSERT(ilist_is_valid(ll, a) && ilist_get(ll, b) == (void*)'B', "resolves live handles");
+	ASSERT(ilist_next(ll, b).index == a.index && ilist_prev(ll, a).index == b.index, "links the head and tail");
+
+	ASSERT(ilist_remove_node(ll, a) == (void*)'A', "removes a node");
+	ASSERT(!ilist_is_valid(ll, a) && ilist_get(ll, a) == NULL, "invalidates the removed node's handle");
+	ASSERT(ilist_remove_node(ll, a) == NULL, "is a no-op when removing via a stale handle");
+
+	Node c = ilist_push_back(ll, (void*)'C');
+
+	ASSERT(c.index == a.index, "reuses freed indices");
+	ASSERT(!ilist_is_valid(ll, a) && ilist_insert_after(ll, (void*)'X', a).index == ILIST_NIL, "rejects the stale handle of a reused index");
+	assert_ordinal_data(ll, 2, 'B', 'C');
+
+	ASSERT(ilist_move_after(ll, b, a) == -1, "rejects moves relative to a stale handle");
+
+	return ll;
+}
+
+LinkedList* test_insert_move(LinkedList* ll) {
+	DESCRIBE();
+
+	Node n1 = ilist_push_back(ll, (void*)'A');
+	Node n3 = ilist_insert_after(ll, (void*)'C', n1);
+	Node n2 = ilist_insert_before(ll, (void*)'B', n3);
+	Node n4 = ilist_insert_after(ll, (void*)'D', n3);
+
+	assert_ordinal_data(ll, 4, 'A', 'B', 'C', 'D');
+
+	ASSERT(ilist_move_after(ll, n3, n3) == -1, "a) is a no-op");
+	ASSERT(ilist_move_before(ll, n2, n2) == -1, "b) is a no-op");
+	ASSERT(ilist_move_after(ll, n3, n2) == -1, "c) is a no-op");
+	ASSERT(ilist_move_before(ll, n2, n3) == -1, "d) is a no-op");
+
+	ilist_move_before(ll, n2, n4);
+	assert_ordinal_data(ll, 4, 'A', 'C', 'B', 'D');
+
+	ilist_move_after(ll, n3, n4);
+	assert_ordinal_data(ll, 4, 'A', 'B', 'D', 'C');
+
+	ilist_move_after(ll, n1, n4);
+	assert_ordinal_data(ll, 4, 'B', 'D', 'A', 'C');
+
+	return ll;
+}
+
+LinkedList* test_growth(LinkedList* ll) {
+	DESCRIBE();
+
+	Node first = ilist_push_back(ll, (void*)0);
+
+	for (intptr_t i = 1; i < 1000; i++) ilist_push_back(ll, (void*)i);
+
+	ASSERT(ll->capacity >= 1000 && ilist_get(ll, first) == (void*)0, "keeps handles valid across growth");
+
+	ilist_push_back_list(ll, ll);
+
+	intptr_t expected = 0;
+	uint32_t n = ll->head;
+
+	for (uint32_t i = 0; i < ll->size; i++, n = ll->nodes[n].next) {
+		assert(ll->nodes[n].data == (void*)(expected++ % 1000));
+	}
+
+	ASSERT(ll->size == 2000, "copies a list onto itself");
+
+	return ll;
+}
+
+LinkedList* test_push_list(LinkedList* ll) {
+	DESCRIBE();
+
+	LinkedList* l2 = ilist_make_list(0);
+
+	ilist_push_back(ll, (void*)'C');
+	ilist_push_back(l2, (void*)'A');
+	ilist_push_back(l2, (void*)'B');
+
+	ilist_push_front_list(ll, l2);
+	assert_ordinal_data(ll, 3, 'A', 'B', 'C');
+
+	ilist_push_front_list(l2, l2);
+	assert_ordinal_data(l2, 4, 'A', 'B', 'A', 'B');
+
+	ilist_push_back_list(ll, l2);
+	assert_ordinal_data(ll, 7, 'A', 'B', 'C', 'A', 'B', 'A', 'B');
+
+	ilist_destroy_list(l2);
+
+	return ll;
+}
+
+/**
+ * Runner
+ */
+
+int main() {
+	run_test(setup, teardown, test_push_pop);
+	run_test(setup, teardown, test_handles);
+	run_test(setup, teardown, test_insert_move);
+	run_test(setup, teardown, test_growth);
+	run_test(setup, teardown, test_push_list);
+
+	return EXIT_SUCCESS;
+}
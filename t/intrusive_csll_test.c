@@ -0,0 +1,190 @@
+#include "test_util.h"
+
+#include "libcartilage.h"
+#include <stdarg.h>
+
+/**
+ * Environment
+ */
+
+typedef struct item {
+	char key;
+	icsll_node_t link;
+} item_t;
+
+typedef icsll_t LinkedList;
+
+static char visited[16];
+static int visited_n;
+
+/**
+ * Lifecycle
+ */
+
+int run_test(LinkedList* (*setup)(void), void (*teardown)(LinkedList*), LinkedList* (*test)(LinkedList*)) {
+	teardown(test(setup()));
+}
+
+LinkedList* setup(void) {
+	LinkedList* ll = malloc(sizeof(LinkedList));
+
+	icsll_init(ll, offsetof(item_t, link));
+
+	return ll;
+}
+
+void teardown(LinkedList* ll) {
+	free(ll);
+}
+
+/**
+ * Helpers
+ */
+
+item_t* make_item(char key) {
+	item_t* item = malloc(sizeof(item_t));
+
+	item->key = key;
+	icsll_node_init(&item->link);
+
+	return item;
+}
+
+void visit(void* data) {
+	visited[visited_n++] = ((item_t*)data)->key;
+}
+
+/* Asserts order via the links and via iteration, and that the list is congruent with its size */
+void assert_ordinal_items(LinkedList* ll, int items_n, ...) {
+	va_list args;
+	item_t* items[16];
+
+	va_start(args, items_n);
+
+	for (int i = 0; i < items_n; i++) items[i] = va_arg(args, item_t*);
+
+	va_end(args);
+
+	icsll_node_t* tmp = ll->head;
+
+	for (int i = 0; i < items_n; i++, tmp = tmp->next) {
+		assert(tmp == &items[i]->link);
+		assert(tmp->list == ll);
+	}
+
+	assert(tmp == ll->head);
+	assert(!items_n || ll->tail == &items[items_n - 1]->link);
+
+	visited_n = 0;
+	icsll_iterate(ll, visit);
+
+	for (int i = 0; i < items_n; i++) assert(visited[i] == items[i]->key);
+
+	ASSERT(ll->size == items_n && visited_n == items_n, "has the expected list order and size");
+}
+
+/**
+ * Tests
+ */
+
+LinkedList* test_push_pop(LinkedList* ll) {
+	DESCRIBE();
+
+	item_t* a = make_item('A');
+	item_t* b = make_item('B');
+	item_t* c = make_item('C');
+
+	icsll_push_back(ll, &b->link);
+	icsll_push_back(ll, &c->link);
+	icsll_push_front(ll, &a->link);
+	assert_ordinal_items(ll, 3, a, b, c);
+
+	ASSERT(icsll_push_back(ll, &a->link) == NULL, "rejects a link that already belongs to a list");
+
+	ASSERT(icsll_pop(ll) == &c->link && c->link.list == NULL, "pops the tail and detaches it");
+	ASSERT(icsll_pop_front(ll) == &a->link, "pops the head");
+	assert_ordinal_items(ll, 1, b);
+
+	ASSERT(icsll_remove_node(ll, &a->link) == NULL, "is a no-op when removing a non-member");
+
+	icsll_remove_node(ll, &b->link);
+	ASSERT(ll->head == NULL && ll->tail == NULL && icsll_pop(ll) == NULL, "empties the list");
+
+	free(a);
+	free(b);
+	free(c);
+
+	return ll;
+}
+
+LinkedList* test_insert_move(LinkedList* ll) {
+	DESCRIBE();
+
+	item_t* a = make_item('A');
+	item_t* b = make_item('B');
+	item_t* c = make_item('C');
+	item_t* d = make_item('D');
+
+	icsll_push_back(ll, &a->link);
+	icsll_insert_after(ll, &c->link, &a->link);
+	icsll_insert_before(ll, &b->link, &c->link);
+	icsll_insert_after(ll, &d->link, &c->link);
+	assert_ordinal_items(ll, 4, a, b, c, d);
+
+	ASSERT(icsll_prev(ll, &a->link) == &d->link && icsll_next(ll, &d->link) == &a->link, "links the head and tail");
+
+	ASSERT(icsll_move_after(ll, &c->link, &c->link) == -1, "a) is a no-op");
+	ASSERT(icsll_move_before(ll, &b->link, &b->link) == -1, "b) is a no-op");
+	ASSERT(icsll_move_after(ll, &c->link, &b->link) == -1, "c) is a no-op");
+	ASSERT(icsll_move_before(ll, &b->link, &c->link) == -1, "d) is a no-op");
+	assert_ordinal_items(ll, 4, a, b, c, d);
+
+	icsll_move_before(ll, &b->link, &d->link);
+	assert_ordinal_items(ll, 4, a, c, b, d);
+
+	icsll_move_after(ll, &c->link, &d->link);
+	assert_ordinal_items(ll, 4, a, b, d, c);
+
+	icsll_move_after(ll, &a->link, &d->link);
+	assert_ordinal_items(ll, 4, b, d, a, c);
+
+	while (ll->size) free(GET_DATA_FROM_OFFSET(icsll_pop_front(ll), ll->offset));
+
+	return ll;
+}
+
+LinkedList* test_multi_membership(LinkedList* ll) {
+	DESCRIBE();
+
+	LinkedList* l2 = setup();
+	item_t* a = make_item('A');
+	item_t* b = make_item('B');
+
+	icsll_push_back(ll, &a->link);
+	icsll_push_back(l2, &b->link);
+
+	ASSERT(icsll_insert_after(l2, &a->link, &b->link) == NULL, "rejects inserting a member of another list");
+	ASSERT(icsll_move_after(ll, &a->link, &b->link) == -1, "rejects moving relative to a non-member");
+	ASSERT(icsll_next(l2, &a->link) == NULL, "does not traverse a non-member");
+
+	icsll_pop(ll);
+	icsll_pop(l2);
+
+	free(a);
+	free(b);
+	teardown(l2);
+
+	return ll;
+}
+
+/**
+ * Runner
+ */
+
+int main() {
+	run_test(setup, teardown, test_push_pop);
+	run_test(setup, teardown, test_insert_move);
+	run_test(setup, teardown, test_multi_membership);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,182 @@
+#include "test_util.h"
+
+#include "libcartilage.h"
+#include <pthread.h>
+#include <sched.h>
+
+#define CAPACITY 64
+#define PRODUCERS 4
+#define CONSUMERS 4
+#define ITEMS_PER_PRODUCER 20000
+#define BATCH_SIZE 8
+
+/**
+ * Environment
+ */
+
+typedef struct worker_arg {
+	mpmc_ring_t* r;
+	int id;
+	_Atomic(int)* seen;
+	_Atomic(int)* remaining;
+	int ordered;
+} worker_arg_t;
+
+void* produce(void* arg) {
+	worker_arg_t* w = arg;
+
+	for (int i = 0; i < ITEMS_PER_PRODUCER; i++) {
+		int value = w->id * ITEMS_PER_PRODUCER + i;
+
+		// alternate between the blocking and batch paths
+		if (i % 2) {
+			mpmc_ring_push(w->r, &value);
+		} else {
+			while (!mpmc_ring_try_push_batch(w->r, &value, 1)) sched_yield();
+		}
+	}
+
+	return NULL;
+}
+
+void* consume(void* arg) {
+	worker_arg_t* w = arg;
+	int last[PRODUCERS];
+	int batch[BATCH_SIZE];
+
+	for (int i = 0; i < PRODUCERS; i++) last[i] = -1;
+
+	w->ordered = 1;
+
+	while (atomic_load(w->remaining) > 0) {
+		size_t n = mpmc_ring_try_pop_batch(w->r, batch, BATCH_SIZE);
+
+		if (!n) {
+			sched_yield();
+			continue;
+		}
+
+		for (size_t i = 0; i < n; i++) {
+			int producer = batch[i] / ITEMS_PER_PRODUCER;
+
+			// a single consumer must observe each producer's values in order
+			if (batch[i] <= last[producer]) w->ordered = 0;
+			last[producer] = batch[i];
+
+			atomic_fetch_add(&w->seen[batch[i]], 1);
+		}
+
+		atomic_fetch_sub(w->remaining, (int)n);
+	}
+
+	return NULL;
+}
+
+/**
+ * Lifecycle
+ */
+
+int run_test(mpmc_ring_t* (*setup)(void), void (*teardown)(mpmc_ring_t*), mpmc_ring_t* (*test)(mpmc_ring_t*)) {
+	teardown(test(setup()));
+}
+
+mpmc_ring_t* setup(void) {
+	return mpmc_ring_make(CAPACITY, sizeof(int));
+}
+
+void teardown(mpmc_ring_t* r) {
+	mpmc_ring_destroy(r);
+}
+
+/**
+ * Tests
+ */
+
+mpmc_ring_t* test_single_thread(mpmc_ring_t* r) {
+	DESCRIBE();
+
+	int v = 0;
+	int batch[CAPACITY * 2];
+
+	ASSERT(mpmc_ring_try_pop(r, &v) == -1, "is a no-op on an empty ring");
+
+	for (int i = 0; i < CAPACITY; i++) {
+		assert(mpmc_ring_try_push(r, &i) == 0);
+	}
+
+	ASSERT(mpmc_ring_try_push(r, &v) == -1, "rejects pushes when full");
+
+	ASSERT(mpmc_ring_try_pop(r, &v) == 0 && v == 0, "pops in FIFO order");
+
+	mpmc_ring_pop(r, &v);
+	ASSERT(v == 1, "pops via the blocking variant when elements are available");
+
+	ASSERT(mpmc_ring_try_pop_batch(r, batch, 10) == 10 && batch[0] == 2 && batch[9] == 11, "pops in batches");
+
+	for (int i = 0; i < CAPACITY * 2; i++) batch[i] = 1000 + i;
+
+	ASSERT(mpmc_ring_try_push_batch(r, batch, CAPACITY * 2) == 12, "pushes batches up to the free capacity, across the wrap");
+
+	ASSERT(mpmc_ring_try_pop_batch(r, batch, CAPACITY * 2) == CAPACITY, "pops batches across the wrap");
+	ASSERT(batch[0] == 12 && batch[CAPACITY - 13] == CAPACITY - 1 && batch[CAPACITY - 12] == 1000, "preserves order across the wrap");
+
+	ASSERT(mpmc_ring_try_pop(r, &v) == -1, "drains the ring");
+
+	ASSERT(mpmc_ring_make(SIZE_MAX, 1) == NULL, "rejects a capacity that cannot be rounded up to a power of two");
+	ASSERT(mpmc_ring_make((SIZE_MAX >> 1) + 1, 1) == NULL, "rejects a capacity whose slots overflow a size_t");
+	ASSERT(mpmc_ring_make(SIZE_MAX >> 2, sizeof(int)) == NULL, "rejects a rounded capacity whose slots overflow a size_t");
+	ASSERT(mpmc_ring_make(2, SIZE_MAX) == NULL, "rejects an element size that overflows a slot");
+
+	return r;
+}
+
+mpmc_ring_t* test_concurrent(mpmc_ring_t* r) {
+	DESCRIBE();
+
+	pthread_t producers[PRODUCERS], consumers[CONSUMERS];
+	worker_arg_t pargs[PRODUCERS], cargs[CONSUMERS];
+	_Atomic(int)* seen = calloc(PRODUCERS * ITEMS_PER_PRODUCER, sizeof(_Atomic(int)));
+	_Atomic(int) remaining = PRODUCERS * ITEMS_PER_PRODUCER;
+
+	for (int i = 0; i < CONSUMERS; i++) {
+		cargs[i] = (worker_arg_t){ .r = r, .id = i, .seen = seen, .remaining = &remaining };
+		pthread_create(&consumers[i], NULL, consume, &cargs[i]);
+	}
+
+	for (int i = 0; i < PRODUCERS; i++) {
+		pargs[i] = (worker_arg_t){ .r = r, .id = i };
+		pthread_create(&producers[i], NULL, produce, &pargs[i]);
+	}
+
+	for (int i = 0; i < PRODUCERS; i++) pthread_join(producers[i], NULL);
+	for (int i = 0; i < CONSUMERS; i++) pthread_join(consumers[i], NULL);
+
+	int exactly_once = 1, ordered = 1;
+
+	for (int i = 0; i < PRODUCERS * ITEMS_PER_PRODUCER; i++) {
+		if (atomic_load(&seen[i]) != 1) exactly_once = 0;
+	}
+
+	for (int i = 0; i < CONSUMERS; i++) ordered &= cargs[i].ordered;
+
+	ASSERT(exactly_once, "delivers every element exactly once");
+	ASSERT(ordered, "preserves each producer's order as observed by each consumer");
+
+	int v;
+	ASSERT(mpmc_ring_try_pop(r, &v) == -1, "is empty once drained");
+
+	free(seen);
+
+	return r;
+}
+
+/**
+ * Runner
+ */
+
+int main(void) {
+	run_test(setup, teardown, test_single_thread);
+	run_test(setup, teardown, test_concurrent);
+
+	return EXIT_SUCCESS;
+}
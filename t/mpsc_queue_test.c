@@ -0,0 +1,148 @@
+#include "test_util.h"
+
+#include "libcartilage.h"
+#include <pthread.h>
+
+#define PRODUCERS 4
+#define ITEMS_PER_PRODUCER 100000
+#define BATCH_SIZE 64
+#define OFFSET(struct, member) (unsigned int)(size_t)&(((struct*)0)->member)
+
+/**
+ * Environment
+ */
+
+typedef struct test_data {
+	int producer;
+	int seq;
+	mpsc_node_t node;
+} test_t;
+
+typedef struct producer_arg {
+	mpsc_queue_t* q;
+	test_t* items;
+	int id;
+} producer_arg_t;
+
+test_t* data(mpsc_node_t* node) {
+	return GET_DATA_FROM_OFFSET(node, OFFSET(test_t, node));
+}
+
+void* produce(void* arg) {
+	producer_arg_t* p = arg;
+
+	for (int i = 0; i < ITEMS_PER_PRODUCER; i++) {
+		p->items[i].producer = p->id;
+		p->items[i].seq = i;
+		mpsc_queue_push(p->q, &p->items[i].node);
+	}
+
+	return NULL;
+}
+
+/**
+ * Lifecycle
+ */
+
+int run_test(mpsc_queue_t* (*setup)(void), void (*teardown)(mpsc_queue_t*), mpsc_queue_t* (*test)(mpsc_queue_t*)) {
+	teardown(test(setup()));
+}
+
+mpsc_queue_t* setup(void) {
+	mpsc_queue_t* q = aligned_alloc(CACHE_LINE_SIZE, sizeof(mpsc_queue_t));
+
+	mpsc_queue_init(q);
+
+	return q;
+}
+
+void teardown(mpsc_queue_t* q) {
+	free(q);
+}
+
+/**
+ * Tests
+ */
+
+mpsc_queue_t* test_single_thread(mpsc_queue_t* q) {
+	DESCRIBE();
+
+	test_t td[8];
+
+	ASSERT(mpsc_queue_is_empty(q), "a) is empty when initialized");
+	ASSERT(mpsc_queue_pop(q) == NULL, "b) is a no-op on an empty queue");
+
+	for (int i = 0; i < 8; i++) {
+		td[i].seq = i;
+		mpsc_queue_push(q, &td[i].node);
+	}
+
+	ASSERT(!mpsc_queue_is_empty(q), "is not empty after a push");
+	ASSERT(data(mpsc_queue_pop(q))->seq == 0, "pops in FIFO order");
+
+	mpsc_node_t* batch[4];
+
+	ASSERT(mpsc_queue_pop_batch(q, batch, 4) == 4, "pops up to `max` nodes in a batch");
+	ASSERT(data(batch[0])->seq == 1 && data(batch[3])->seq == 4, "pops batches in FIFO order");
+
+	ASSERT(mpsc_queue_pop_batch(q, batch, 4) == 3, "pops the remaining nodes in a partial batch");
+	ASSERT(mpsc_queue_is_empty(q) && mpsc_queue_pop(q) == NULL, "drains the queue");
+
+	mpsc_queue_push(q, &td[0].node);
+	ASSERT(mpsc_queue_pop(q) == &td[0].node, "reuses a drained queue");
+
+	return q;
+}
+
+mpsc_queue_t* test_concurrent_producers(mpsc_queue_t* q) {
+	DESCRIBE();
+
+	pthread_t threads[PRODUCERS];
+	producer_arg_t args[PRODUCERS];
+	int next_seq[PRODUCERS] = { 0 };
+
+	for (int i = 0; i < PRODUCERS; i++) {
+		args[i].q = q;
+		args[i].id = i;
+		args[i].items = malloc(ITEMS_PER_PRODUCER * sizeof(test_t));
+		pthread_create(&threads[i], NULL, produce, &args[i]);
+	}
+
+	mpsc_node_t* batch[BATCH_SIZE];
+	int consumed = 0;
+	int ordered = 1;
+
+	while (consumed < PRODUCERS * ITEMS_PER_PRODUCER) {
+		unsigned int n = mpsc_queue_pop_batch(q, batch, BATCH_SIZE);
+
+		for (unsigned int i = 0; i < n; i++) {
+			test_t* t = data(batch[i]);
+
+			if (t->seq != next_seq[t->producer]++) ordered = 0;
+		}
+
+		consumed += n;
+	}
+
+	for (int i = 0; i < PRODUCERS; i++) {
+		pthread_join(threads[i], NULL);
+		free(args[i].items);
+	}
+
+	ASSERT(consumed == PRODUCERS * ITEMS_PER_PRODUCER, "consumes every node exactly once");
+	ASSERT(ordered, "preserves FIFO order per producer");
+	ASSERT(mpsc_queue_is_empty(q), "is empty once drained");
+
+	return q;
+}
+
+/**
+ * Runner
+ */
+
+int main(void) {
+	run_test(setup, teardown, test_single_thread);
+	run_test(setup, teardown, test_concurrent_producers);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,160 @@
+#include "test_util.h"
+
+#include "libcartilage.h"
+
+#define CHUNK_SIZE 4
+
+/**
+ * Environment
+ */
+
+typedef ForwardNode_t Node;
+
+typedef CircularSinglyLinkedList LinkedList;
+
+/**
+ * Lifecycle
+ */
+
+int run_test(LinkedList* (*setup)(void), void (*teardown)(LinkedList*), LinkedList* (*test)(LinkedList*)) {
+	teardown(test(setup()));
+}
+
+LinkedList* setup(void) {
+	NodePool_t* pool = node_pool_make(sizeof(Node), CHUNK_SIZE);
+
+	return csll_make_list_owning_allocator(&pool->allocator);
+}
+
+void teardown(LinkedList* ll) {
+	csll_destroy_list(ll);
+}
+
+/**
+ * Tests
+ */
+
+LinkedList* test_node_pool(LinkedList* ll) {
+	DESCRIBE();
+
+	NodePool_t* pool = node_pool_make(1, 2);
+
+	ASSERT(pool->node_size >= sizeof(void*), "reserves room for the free list link");
+
+	char* a = node_pool_alloc(pool);
+	char* b = node_pool_alloc(pool);
+	char* c = node_pool_alloc(pool);
+
+	ASSERT(b == a + pool->node_size, "carves consecutive nodes from a chunk");
+	ASSERT(pool->chunks && pool->chunks->next, "allocates a new chunk when the current one is exhausted");
+
+	node_pool_free(pool, b);
+	ASSERT(node_pool_alloc(pool) == b, "recycles freed nodes");
+
+	node_pool_free(pool, a);
+	node_pool_free(pool, c);
+	ASSERT(node_pool_alloc(pool) == c, "a) reuses nodes in LIFO order");
+	ASSERT(node_pool_alloc(pool) == a, "b) reuses nodes in LIFO order");
+
+	node_pool_destroy(pool);
+
+	return ll;
+}
+
+LinkedList* test_pooled_list(LinkedList* ll) {
+	DESCRIBE();
+
+	NodePool_t* pool = ll->allocator->ctx;
+
+	for (int i = 0; i < CHUNK_SIZE * 3; i++) {
+		csll_push_back(ll, (void*)(intptr_t)i);
+	}
+
+	ASSERT(ll->size == CHUNK_SIZE * 3, "maintains proper list size");
+
+	Node* n = ll->head;
+	for (int i = 0; i < CHUNK_SIZE * 3; i++, n = n->next) {
+		assert(n->data == (void*)(intptr_t)i);
+	}
+
+	ASSERT(n == ll->head, "allocates list nodes from the pool");
+
+	Node* popped = csll_pop_front(ll);
+	csll_release_node(ll, popped);
+
+	Node* pushed = csll_push_back(ll, (void*)(intptr_t)-1);
+	ASSERT(pushed == popped, "recycles nodes released by the list");
+
+	Node* removed = csll_remove_node(ll, ll->head->next);
+	csll_release_node(ll, removed);
+
+	Node* inserted = csll_insert_after(ll, NULL, ll->head);
+	ASSERT(inserted == removed, "recycles nodes on insertion");
+
+	LinkedList* copy = csll_make_list_owning_allocator(&node_pool_make(sizeof(Node), CHUNK_SIZE)->allocator);
+
+	csll_push_back_list(copy, ll);
+	csll_push_front_list(copy, ll);
+	ASSERT(copy->size == ll->size * 2, "copies lists into a pooled list");
+
+	csll_destroy_list(copy);
+
+	ASSERT(pool->chunks != NULL, "retains chunks until the list is destroyed");
+
+	return ll;
+}
+
+void* fail_alloc(void* ctx, size_t size) {
+	(void)ctx;
+	(void)size;
+
+	return NULL;
+}
+
+LinkedList* test_custom_allocator(LinkedList* ll) {
+	DESCRIBE();
+
+	NodeAllocator_t* allocator = ll->allocator;
+	NodePool_t* pool = allocator->ctx;
+
+	NodeAllocator_t shared = { allocator->alloc, allocator->free, NULL, pool };
+	LinkedList* l2 = csll_make_list_with_allocator(&shared);
+
+	Node* n = csll_push_back(l2, NULL);
+	ASSERT(csll_pop(l2) == n, "allocates nodes via a user-supplied allocator");
+
+	csll_release_node(l2, n);
+	csll_destroy_list(l2);
+
+	ASSERT(pool->free_list == n, "returns nodes to the allocator without releasing it");
+
+	LinkedList* l3 = csll_make_list_with_allocator(allocator);
+
+	csll_push_back(l3, NULL);
+	csll_push_back(l3, NULL);
+	csll_destroy_list(l3);
+
+	ASSERT(pool->chunks != NULL && csll_push_back(ll, NULL) != NULL, "shares a pool with a list that does not own it");
+
+	NodeAllocator_t exhausted = { fail_alloc, allocator->free, NULL, pool };
+	LinkedList* l4 = csll_make_list_with_allocator(&exhausted);
+
+	ASSERT(csll_push_back(l4, NULL) == NULL && csll_push_front(l4, NULL) == NULL, "a) propagates allocation failure");
+	ASSERT(l4->size == 0 && l4->head == NULL, "b) propagates allocation failure");
+
+	csll_destroy_list(l4);
+
+	return ll;
+}
+
+/**
+ * Runner
+ */
+
+int main() {
+	run_test(setup, teardown, test_node_pool);
+	run_test(setup, teardown, test_pooled_list);
+	run_test(setup, teardown, test_custom_allocator);
+
+	return EXIT_SUCCESS;
+}
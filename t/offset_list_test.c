@@ -0,0 +1,378 @@
+#include "test_util.h"
+
+#include "libcartilage.h"
+
+#include <fcntl.h>
+#include <stdarg.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define SHM_NAME "/cartilage_offset_list_test"
+#define REGION_SIZE (1 << 20)
+#define RECORDS_N 100
+
+/**
+ * Environment
+ */
+
+typedef struct record {
+	long key;
+	oglthread_t glthread;
+} record_t;
+
+/* Entry point shared by every process mapping the region */
+typedef struct root {
+	offptr_t ll;
+	oglthread_t base;
+} root_t;
+
+static long visited_sum;
+static int visited_n;
+
+/**
+ * Lifecycle
+ */
+
+int run_test(Region_t* (*setup)(void), void (*teardown)(Region_t*), Region_t* (*test)(Region_t*)) {
+	teardown(test(setup()));
+}
+
+void* map_shared(int create) {
+	int fd = shm_open(SHM_NAME, O_RDWR | (create ? O_CREAT | O_TRUNC : 0), 0600);
+
+	assert(fd != -1);
+	assert(!create || ftruncate(fd, REGION_SIZE) == 0);
+
+	void* base = mmap(NULL, REGION_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+	close(fd);
+	assert(base != MAP_FAILED);
+
+	return base;
+}
+
+Region_t* setup(void) {
+	return region_init(map_shared(1), REGION_SIZE);
+}
+
+void teardown(Region_t* r) {
+	munmap(r, REGION_SIZE);
+	shm_unlink(SHM_NAME);
+}
+
+/**
+ * Helpers
+ */
+
+void visit(void* node) {
+	visited_sum += ((record_t*)ocsll_data(node))->key;
+	visited_n++;
+}
+
+int compare_keys(void* a, void* b) {
+	long x = ((record_t*)a)->key, y = ((record_t*)b)->key;
+
+	return x < y ? -1 : x > y;
+}
+
+/* Asserts the list holds the given keys, in order, and that its tail closes the ring */
+void assert_ordinal_keys(OffsetCircularSinglyLinkedList* ll, int keys_n, ...) {
+	va_list args;
+	OffsetForwardNode_t* node = ocsll_head(ll);
+
+	va_start(args, keys_n);
+
+	for (int i = 0; i < keys_n; i++, node = ocsll_next(node)) {
+		assert(*(long*)ocsll_data(node) == va_arg(args, int));
+		assert(offptr_get(&node->list) == ll);
+	}
+
+	va_end(args);
+
+	assert(node == ocsll_head(ll) && ocsll_next(offptr_get(&ll->tail)) == ocsll_head(ll));
+
+	ASSERT(ll->size == (uint32_t)keys_n, "has the expected list order and size");
+}
+
+root_t* build(Region_t* r) {
+	root_t* root = region_alloc(r, sizeof(root_t));
+	OffsetCircularSinglyLinkedList* ll = ocsll_make_list(r);
+
+	offptr_set(&root->ll, ll);
+	oglthread_init(&root->base);
+
+	for (long i = 0; i < RECORDS_N; i++) {
+		record_t* rec = region_alloc(r, sizeof(record_t));
+
+		rec->key = i;
+		oglthread_init(&rec->glthread);
+		oglthread_push(&root->base, &rec->glthread);
+		ocsll_push_back(ll, rec);
+	}
+
+	region_set_root(r, root);
+
+	return root;
+}
+
+/* Walk both lists as seen through the mapping at `base`, asserting they hold keys 0..n-1, in order */
+void assert_lists(void* base, long n) {
+	root_t* root = region_root(region_attach(base));
+	OffsetCircularSinglyLinkedList* ll = offptr_get(&root->ll);
+	OffsetForwardNode_t* node = ocsll_head(ll);
+	oglthread_t* curr;
+	long i = 0;
+
+	assert(ll->size == n);
+
+	for (i = 0; i < n; i++, node = ocsll_next(node)) assert(((record_t*)ocsll_data(node))->key == i);
+
+	assert(node == ocsll_head(ll));
+
+	i = 0;
+
+	ITERATE_OGLTHREAD_BEGIN(&root->base, curr) {
+		assert(((record_t*)GET_DATA_FROM_OFFSET(curr, offsetof(record_t, glthread)))->key == i++);
+	} ITERATE_OGLTHREAD_END(&root->base, curr);
+
+	assert(i == n);
+}
+
+/**
+ * Tests
+ */
+
+Region_t* test_region(Region_t* r) {
+	DESCRIBE();
+
+	char garbage[sizeof(Region_t)] = { 0 };
+
+	ASSERT(region_attach(garbage) == NULL, "rejects memory that does not hold a region");
+	ASSERT(region_attach(r) == r && region_root(r) == NULL, "attaches to an empty region");
+
+	void* a = region_alloc(r, 24);
+	void* b = region_alloc(r, 24);
+
+	ASSERT(a && b && (uintptr_t)a % REGION_ALIGN == 0 && (uintptr_t)b % REGION_ALIGN == 0, "aligns allocations");
+
+	region_free(r, a);
+	ASSERT(region_alloc(r, 40) != a, "does not reuse a block of another size");
+	ASSERT(region_alloc(r, 24) == a, "reuses a freed block of the same size");
+
+	ASSERT(region_alloc(r, REGION_SIZE) == NULL, "returns NULL when exhausted");
+
+	return r;
+}
+
+Region_t* test_offset_csll(Region_t* r) {
+	DESCRIBE();
+
+	OffsetCircularSinglyLinkedList* ll = ocsll_make_list(r);
+	long* keys = region_alloc(r, 3 * sizeof(long));
+
+	for (long i = 0; i < 3; i++) keys[i] = i + 1;
+
+	ASSERT(ocsll_pop(ll) == NULL && ocsll_pop_front(ll) == NULL, "returns NULL when popping an empty list");
+
+	OffsetForwardNode_t* n2 = ocsll_push_back(ll, &keys[1]);
+
+	ASSERT(ocsll_next(n2) == n2, "links a single node to itself");
+
+	ocsll_push_back(ll, &keys[2]);
+	ocsll_push_front(ll, &keys[0]);
+
+	ASSERT(*(long*)ocsll_data(ocsll_head(ll)) == 1 && ll->size == 3, "pushes to either end");
+
+	ASSERT(ocsll_remove_node(ll, n2) == n2 && ocsll_next(ocsll_head(ll)) == offptr_get(&ll->tail), "removes a node");
+	ASSERT(ocsll_remove_node(ll, n2) == NULL, "is a no-op when removing a non-member");
+
+	ocsll_release_node(ll, n2);
+
+	ASSERT(*(long*)ocsll_data(ocsll_pop(ll)) == 3 && *(long*)ocsll_data(ocsll_pop_front(ll)) == 1, "pops either end");
+	ASSERT(ll->size == 0 && ocsll_head(ll) == NULL, "empties the list");
+
+	ocsll_destroy_list(ll);
+
+	return r;
+}
+
+Region_t* test_offset_csll_positional(Region_t* r) {
+	DESCRIBE();
+
+	OffsetCircularSinglyLinkedList* ll = ocsll_make_list(r);
+	OffsetCircularSinglyLinkedList* l2 = ocsll_make_list(r);
+	long* keys = region_alloc(r, 4 * sizeof(long));
+
+	for (long i = 0; i < 4; i++) keys[i] = i + 1;
+
+	OffsetForwardNode_t* n2 = ocsll_push_back(ll, &keys[1]);
+	OffsetForwardNode_t* n4 = ocsll_insert_after(ll, &keys[3], n2);
+	OffsetForwardNode_t* n3 = ocsll_insert_before(ll, &keys[2], n4);
+	OffsetForwardNode_t* n1 = ocsll_insert_before(ll, &keys[0], n2);
+
+	assert_ordinal_keys(ll, 4, 2, 3, 4, 1);
+	ASSERT(ocsll_head(ll) == n2 && offptr_get(&ll->tail) == n1, "inserts before the head as the new tail, as does the CSLL");
+	ASSERT(ocsll_insert_after(l2, &keys[0], n1) == NULL, "is a no-op when inserting around a non-member");
+
+	ASSERT(ocsll_prev(ll, n2) == n1 && ocsll_prev(ll, n3) == n2 && ocsll_prev(l2, n1) == NULL, "finds a node's predecessor");
+
+	ASSERT(ocsll_move_after(ll, n1, n3) == 0, "a) moves a node after a mark");
+	assert_ordinal_keys(ll, 4, 2, 3, 1, 4);
+	ASSERT(ocsll_head(ll) == n2 && offptr_get(&ll->tail) == n4, "b) moves a node after a mark");
+
+	ASSERT(ocsll_move_before(ll, n1, n4) == -1 && ocsll_move_after(ll, n1, n3) == -1, "is a no-op when already in place");
+
+	ASSERT(ocsll_move_before(ll, n3, n2) == 0, "a) moves a node before the head as the new tail, as does the CSLL");
+	assert_ordinal_keys(ll, 4, 2, 1, 4, 3);
+	ASSERT(ocsll_head(ll) == n2 && offptr_get(&ll->tail) == n3, "b) moves a node before the head as the new tail, as does the CSLL");
+
+	ocsll_push_back(l2, &keys[0]);
+	ocsll_push_back_list(l2, ll);
+	assert_ordinal_keys(l2, 5, 1, 2, 1, 4, 3);
+
+	ocsll_push_front_list(ll, ll);
+	assert_ordinal_keys(ll, 8, 2, 1, 4, 3, 2, 1, 4, 3);
+
+	ocsll_push_front_list(l2, ll);
+	assert_ordinal_keys(l2, 13, 2, 1, 4, 3, 2, 1, 4, 3, 1, 2, 1, 4, 3);
+
+	ocsll_destroy_list(ll);
+	ocsll_destroy_list(l2);
+
+	return r;
+}
+
+Region_t* test_offset_glthread(Region_t* r) {
+	DESCRIBE();
+
+	// offptrs are only defined between addresses within one object, here the mapping that holds the region
+	oglthread_t* threads = region_alloc(r, 4 * sizeof(oglthread_t));
+	oglthread_t* base = &threads[0];
+	oglthread_t* a = &threads[1];
+	oglthread_t* b = &threads[2];
+	oglthread_t* c = &threads[3];
+
+	oglthread_init(base);
+	oglthread_init(a);
+	oglthread_init(b);
+	oglthread_init(c);
+
+	oglthread_push(base, b);
+	oglthread_insert_before(b, a);
+	oglthread_insert_after(b, c);
+
+	ASSERT(oglthread_next(base) == a && oglthread_next(a) == b && oglthread_next(c) == NULL, "links in order");
+	ASSERT(oglthread_prev(c) == b && oglthread_prev(a) == base, "links in reverse");
+
+	oglthread_remove(b);
+
+	ASSERT(oglthread_next(a) == c && oglthread_prev(c) == a, "removes a node");
+	ASSERT(oglthread_next(b) == NULL && oglthread_prev(b) == NULL, "detaches the removed node");
+	ASSERT(oglthread_size(base) == 2, "counts its nodes");
+
+	oglthread_del_list(base);
+
+	ASSERT(oglthread_next(base) == NULL && oglthread_size(base) == 0, "a) deletes all nodes");
+	ASSERT(oglthread_prev(c) == NULL && oglthread_next(a) == NULL, "b) deletes all nodes");
+	ASSERT(oglthread_dequeue_first(base) == NULL, "dequeues nothing from an empty glthread");
+
+	record_t* recs = region_alloc(r, 5 * sizeof(record_t));
+	long keys[] = { 3, 1, 4, 1, 2 };
+
+	for (int i = 0; i < 5; i++) {
+		recs[i].key = keys[i];
+		oglthread_priority_insert(base, &recs[i].glthread, compare_keys, offsetof(record_t, glthread));
+	}
+
+	long expected[] = { 1, 1, 2, 3, 4 };
+	oglthread_t* curr;
+	int i = 0;
+
+	ITERATE_OGLTHREAD_BEGIN(base, curr) {
+		assert(((record_t*)GET_DATA_FROM_OFFSET(curr, offsetof(record_t, glthread)))->key == expected[i++]);
+	} ITERATE_OGLTHREAD_END(base, curr);
+
+	ASSERT(i == 5, "inserts in priority order");
+	ASSERT(oglthread_next(&recs[1].glthread) == &recs[3].glthread, "keeps equal keys in insertion order");
+
+	ASSERT(oglthread_dequeue_first(base) == &recs[1].glthread && oglthread_size(base) == 4, "a) dequeues the head node");
+	ASSERT(oglthread_prev(oglthread_next(base)) == base, "b) dequeues the head node");
+
+	return r;
+}
+
+Region_t* test_second_mapping(Region_t* r) {
+	DESCRIBE();
+
+	build(r);
+
+	void* other = map_shared(0);
+
+	ASSERT(other != (void*)r, "maps the region at a second address");
+
+	assert_lists(other, RECORDS_N);
+	ASSERT(1, "reads both lists through the second mapping");
+
+	munmap(other, REGION_SIZE);
+
+	return r;
+}
+
+Region_t* test_multi_process(Region_t* r) {
+	DESCRIBE();
+
+	int status;
+	root_t* root = build(r);
+	pid_t pid = fork();
+
+	assert(pid != -1);
+
+	if (!pid) {
+		// the child inherits the parent's mapping, so a fresh one is necessarily placed elsewhere
+		void* base = map_shared(0);
+		Region_t* cr = region_attach(base);
+
+		if (base == (void*)r) _exit(EXIT_FAILURE);
+
+		assert_lists(base, RECORDS_N);
+
+		root_t* croot = region_root(cr);
+		record_t* rec = region_alloc(cr, sizeof(record_t));
+
+		rec->key = RECORDS_N;
+		oglthread_init(&rec->glthread);
+		oglthread_push(&croot->base, &rec->glthread);
+		ocsll_push_back(offptr_get(&croot->ll), rec);
+
+		_exit(EXIT_SUCCESS);
+	}
+
+	waitpid(pid, &status, 0);
+
+	ASSERT(WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS, "reads the lists from another process");
+
+	assert_lists(r, RECORDS_N + 1);
+
+	visited_sum = visited_n = 0;
+	ocsll_iterate(offptr_get(&root->ll), visit);
+
+	ASSERT(visited_n == RECORDS_N + 1 && visited_sum == RECORDS_N * (RECORDS_N + 1) / 2, "sees nodes pushed by another process");
+
+	return r;
+}
+
+/**
+ * Runner
+ */
+
+int main() {
+	run_test(setup, teardown, test_region);
+	run_test(setup, teardown, test_offset_csll);
+	run_test(setup, teardown, test_offset_csll_positional);
+	run_test(setup, teardown, test_offset_glthread);
+	run_test(setup, teardown, test_second_mapping);
+	run_test(setup, teardown, test_multi_process);
+
+	return EXIT_SUCCESS;
+}
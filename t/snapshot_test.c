@@ -0,0 +1,228 @@
+#include "test_util.h"
+
+#include "libcartilage.h"
+#include <string.h>
+
+#define SNAPSHOT_PATH "/tmp/cartilage_snapshot_test.bin"
+#define STREAM_N 1000
+
+/**
+ * Environment
+ */
+
+typedef struct record {
+	long key;
+	char name[12];
+} record_t;
+
+typedef struct thread_record {
+	int id;
+	glthread_t glthread;
+	double weight;
+} thread_record_t;
+
+static long visited_sum;
+static int visited_n;
+
+/**
+ * Lifecycle
+ */
+
+int run_test(const char* (*setup)(void), void (*teardown)(const char*), const char* (*test)(const char*)) {
+	teardown(test(setup()));
+}
+
+const char* setup(void) {
+	return SNAPSHOT_PATH;
+}
+
+void teardown(const char* path) {
+	remove(path);
+}
+
+/**
+ * Helpers
+ */
+
+void visit(void* data) {
+	visited_sum += ((record_t*)data)->key;
+	visited_n++;
+}
+
+void write_file(const char* path, const void* bytes, size_t n) {
+	FILE* fp = fopen(path, "wb");
+
+	fwrite(bytes, n, 1, fp);
+	fclose(fp);
+}
+
+/**
+ * Tests
+ */
+
+const char* test_csll_round_trip(const char* path) {
+	DESCRIBE();
+
+	record_t records[] = { { 1, "one" }, { 2, "two" }, { 3, "three" }, { 4, "four" } };
+	CircularSinglyLinkedList* ll = csll_make_list();
+
+	for (int i = 0; i < 4; i++) csll_push_back(ll, &records[i]);
+
+	ASSERT(csll_snapshot_save(ll, path, sizeof(record_t)) == 0, "writes the snapshot");
+
+	csll_destroy_list(ll);
+
+	Snapshot_t* s = snapshot_map(path);
+
+	ASSERT(s && s->header->count == 4 && s->header->record_size == sizeof(record_t), "maps the snapshot");
+	ASSERT(snapshot_verify(s) == 0, "is well-formed");
+
+	SnapshotRecord_t* r = snapshot_head(s);
+
+	for (int i = 0; i < 4; i++, r = snapshot_next(r)) {
+		record_t* rec = (record_t*)r->data;
+
+		assert(rec->key == records[i].key && !strcmp(rec->name, records[i].name));
+	}
+
+	ASSERT(r == snapshot_head(s), "traverses the records in list order and back to the head");
+
+	visited_sum = visited_n = 0;
+	snapshot_iterate(s, visit);
+
+	ASSERT(visited_n == 4 && visited_sum == 10, "iterates every record");
+
+	snapshot_unmap(s);
+
+	return path;
+}
+
+const char* test_empty(const char* path) {
+	DESCRIBE();
+
+	CircularSinglyLinkedList* ll = csll_make_list();
+
+	csll_snapshot_save(ll, path, sizeof(record_t));
+	csll_destroy_list(ll);
+
+	Snapshot_t* s = snapshot_map(path);
+
+	ASSERT(s && s->header->count == 0 && snapshot_head(s) == NULL, "maps an empty snapshot");
+	ASSERT(snapshot_verify(s) == 0, "is well-formed");
+
+	snapshot_unmap(s);
+
+	return path;
+}
+
+const char* test_glthread_round_trip(const char* path) {
+	DESCRIBE();
+
+	thread_record_t records[3] = { { .id = 7, .weight = 0.5 }, { .id = 8, .weight = 1.5 }, { .id = 9, .weight = 2.5 } };
+	glthread_t base;
+
+	glthread_init(&base);
+
+	for (int i = 2; i >= 0; i--) {
+		glthread_init(&records[i].glthread);
+		glthread_insert_after(&base, &records[i].glthread);
+	}
+
+	ASSERT(glthread_snapshot_save(&base, offsetof(thread_record_t, glthread), path, sizeof(thread_record_t)) == 0, "writes the snapshot");
+
+	Snapshot_t* s = snapshot_map(path);
+	SnapshotRecord_t* r = snapshot_head(s);
+
+	for (int i = 0; i < 3; i++, r = snapshot_next(r)) {
+		thread_record_t* rec = (thread_record_t*)r->data;
+
+		assert(rec->id == records[i].id && rec->weight == records[i].weight);
+		assert(IS_GLTHREAD_EMPTY(&rec->glthread));
+	}
+
+	ASSERT(s->header->count == 3 && r == snapshot_head(s), "stores the records in list order");
+	ASSERT(((uintptr_t)snapshot_head(s)->data) % 8 == 0, "aligns the records");
+
+	snapshot_unmap(s);
+
+	return path;
+}
+
+const char* test_streaming_writer(const char* path) {
+	DESCRIBE();
+
+	SnapshotWriter_t w;
+
+	ASSERT(snapshot_writer_open(&w, path, sizeof(record_t)) == 0, "opens the writer");
+
+	for (long i = 0; i < STREAM_N; i++) {
+		record_t rec = { .key = i };
+
+		snapshot_writer_append(&w, &rec);
+	}
+
+	ASSERT(snapshot_writer_close(&w) == 0, "closes the writer");
+
+	Snapshot_t* s = snapshot_map(path);
+
+	visited_sum = visited_n = 0;
+	snapshot_iterate(s, visit);
+
+	ASSERT(snapshot_verify(s) == 0 && visited_n == STREAM_N && visited_sum == STREAM_N * (STREAM_N - 1) / 2, "stores every appended record");
+
+	snapshot_unmap(s);
+
+	return path;
+}
+
+const char* test_rejects_invalid(const char* path) {
+	DESCRIBE();
+
+	ASSERT(snapshot_map("/tmp/cartilage_snapshot_test.missing") == NULL, "returns NULL for a missing file");
+
+	write_file(path, "not a snapshot at all, but long enough", 38);
+	ASSERT(snapshot_map(path) == NULL, "returns NULL for a foreign file");
+
+	record_t records[] = { { 1, "one" }, { 2, "two" } };
+	CircularSinglyLinkedList* ll = csll_make_list();
+
+	csll_push_back(ll, &records[0]);
+	csll_push_back(ll, &records[1]);
+	csll_snapshot_save(ll, path, sizeof(record_t));
+	csll_destroy_list(ll);
+
+	unsigned char bytes[sizeof(SnapshotHeader_t) + 2 * SNAPSHOT_STRIDE(sizeof(record_t))];
+	FILE* fp = fopen(path, "rb");
+
+	fread(bytes, sizeof(bytes), 1, fp);
+	fclose(fp);
+
+	write_file(path, bytes, sizeof(bytes) - 1);
+	ASSERT(snapshot_map(path) == NULL, "returns NULL for a truncated file");
+
+	// point the first record at itself, such that the ring skips the second
+	((SnapshotRecord_t*)(bytes + sizeof(SnapshotHeader_t)))->next = 0;
+	write_file(path, bytes, sizeof(bytes));
+
+	Snapshot_t* s = snapshot_map(path);
+
+	ASSERT(s && snapshot_verify(s) == -1, "detects a corrupt link");
+
+	snapshot_unmap(s);
+
+	return path;
+}
+
+/**
+ * Runner
+ */
+
+int main() {
+	run_test(setup, teardown, test_csll_round_trip);
+	run_test(setup, teardown, test_empty);
+	run_test(setup, teardown, test_glthread_round_trip);
+	run_test(setup, teardown, test_streaming_writer);
+	run_test(setup, teardown, test_rejects_invalid);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,176 @@
+#include "test_util.h"
+
+#include "libcartilage.h"
+#include <pthread.h>
+#include <sched.h>
+
+#define CAPACITY 8
+#define ITEMS 1000000
+#define BATCH_SIZE 5
+
+/**
+ * Environment
+ */
+
+typedef struct message {
+	uint64_t seq;
+	uint64_t checksum;
+} message_t;
+
+void* produce(void* arg) {
+	spsc_ring_t* r = arg;
+	uint64_t seq = 0;
+
+	while (seq < ITEMS) {
+		message_t* slots;
+		size_t n = spsc_ring_reserve(r, ITEMS - seq < BATCH_SIZE ? ITEMS - seq : BATCH_SIZE, (void**)&slots);
+
+		if (!n) {
+			sched_yield();
+			continue;
+		}
+
+		for (size_t i = 0; i < n; i++, seq++) {
+			slots[i].seq = seq;
+			slots[i].checksum = ~seq;
+		}
+
+		spsc_ring_commit(r, n);
+	}
+
+	return NULL;
+}
+
+/**
+ * Lifecycle
+ */
+
+int run_test(spsc_ring_t* (*setup)(void), void (*teardown)(spsc_ring_t*), spsc_ring_t* (*test)(spsc_ring_t*)) {
+	teardown(test(setup()));
+}
+
+spsc_ring_t* setup(void) {
+	return spsc_ring_make(CAPACITY - 1, sizeof(message_t));
+}
+
+void teardown(spsc_ring_t* r) {
+	spsc_ring_destroy(r);
+}
+
+/**
+ * Tests
+ */
+
+spsc_ring_t* test_single_thread(spsc_ring_t* r) {
+	DESCRIBE();
+
+	message_t m = { 0 };
+	message_t batch[CAPACITY * 2];
+
+	ASSERT(r->capacity == CAPACITY, "rounds the capacity up to a power of two");
+	ASSERT(spsc_ring_pop(r, &m) == -1, "is a no-op on an empty ring");
+
+	for (int i = 0; i < CAPACITY; i++) {
+		m.seq = i;
+		assert(spsc_ring_push(r, &m) == 0);
+	}
+
+	ASSERT(spsc_ring_push(r, &m) == -1, "rejects pushes when full");
+	ASSERT(spsc_ring_size(r) == CAPACITY, "maintains proper ring size");
+
+	ASSERT(spsc_ring_pop(r, &m) == 0 && m.seq == 0, "pops in FIFO order");
+
+	ASSERT(spsc_ring_pop_batch(r, batch, 3) == 3 && batch[0].seq == 1 && batch[2].seq == 3, "pops in batches");
+
+	for (int i = 0; i < CAPACITY * 2; i++) batch[i].seq = 100 + i;
+
+	ASSERT(spsc_ring_push_batch(r, batch, CAPACITY * 2) == 4, "pushes batches up to the free capacity, across the wrap");
+	ASSERT(spsc_ring_pop_batch(r, batch, CAPACITY * 2) == CAPACITY, "pops batches across the wrap");
+	ASSERT(batch[3].seq == 7 && batch[4].seq == 100 && batch[7].seq == 103, "preserves order across the wrap");
+
+	ASSERT(spsc_ring_size(r) == 0, "drains the ring");
+
+	ASSERT(spsc_ring_make(SIZE_MAX, 1) == NULL, "rejects a capacity that cannot be rounded up to a power of two");
+	ASSERT(spsc_ring_make((SIZE_MAX >> 1) + 1, 2) == NULL, "rejects a capacity whose slots overflow a size_t");
+	ASSERT(spsc_ring_make(SIZE_MAX >> 2, sizeof(message_t)) == NULL, "rejects a rounded capacity whose slots overflow a size_t");
+
+	return r;
+}
+
+spsc_ring_t* test_reserve_commit(spsc_ring_t* r) {
+	DESCRIBE();
+
+	message_t* slots;
+	message_t m;
+
+	// move the indices such that the ring wraps after two slots
+	for (int i = 0; i < CAPACITY - 2; i++) {
+		spsc_ring_push(r, &m);
+		spsc_ring_pop(r, &m);
+	}
+
+	ASSERT(spsc_ring_reserve(r, 4, (void**)&slots) == 2, "reserves only contiguous slots");
+
+	slots[0].seq = 1;
+	slots[1].seq = 2;
+
+	ASSERT(spsc_ring_size(r) == 0, "does not publish reserved slots");
+
+	spsc_ring_commit(r, 2);
+	ASSERT(spsc_ring_size(r) == 2, "publishes committed slots");
+
+	ASSERT(spsc_ring_reserve(r, 4, (void**)&slots) == 4 && (char*)slots == r->slots, "reserves from the start of the ring after the wrap");
+
+	slots[0].seq = 3;
+	spsc_ring_commit(r, 1);
+
+	ASSERT(spsc_ring_peek(r, 8, (void**)&slots) == 2 && slots[1].seq == 2, "peeks contiguous slots in place");
+
+	spsc_ring_release(r, 2);
+	ASSERT(spsc_ring_pop(r, &m) == 0 && m.seq == 3, "releases peeked slots");
+
+	return r;
+}
+
+spsc_ring_t* test_concurrent(spsc_ring_t* r) {
+	DESCRIBE();
+
+	pthread_t producer;
+	message_t batch[BATCH_SIZE];
+	uint64_t expected = 0;
+	int ordered = 1;
+
+	pthread_create(&producer, NULL, produce, r);
+
+	while (expected < ITEMS) {
+		size_t n = spsc_ring_pop_batch(r, batch, BATCH_SIZE);
+
+		if (!n) {
+			sched_yield();
+			continue;
+		}
+
+		for (size_t i = 0; i < n; i++, expected++) {
+			if (batch[i].seq != expected || batch[i].checksum != ~expected) ordered = 0;
+		}
+	}
+
+	pthread_join(producer, NULL);
+
+	ASSERT(ordered, "transfers every message intact and in order across threads");
+	ASSERT(spsc_ring_size(r) == 0, "is empty once drained");
+
+	return r;
+}
+
+/**
+ * Runner
+ */
+
+int main(void) {
+	run_test(setup, teardown, test_single_thread);
+	run_test(setup, teardown, test_reserve_commit);
+	run_test(setup, teardown, test_concurrent);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,207 @@
+#include "test_util.h"
+
+#include "libcartilage.h"
+
+#define FUZZ_N 10000
+#define FUZZ_HORIZON (1 << 25)
+
+/**
+ * Environment
+ */
+
+typedef struct conn {
+	int id;
+	wheel_timer_t timer;
+	uint64_t fired_at;
+	int fired;
+} conn_t;
+
+typedef struct fire_log {
+	timer_wheel_t* w;
+	int order[16];
+	int n;
+	conn_t* cancel; /* Cancelled by the first timer to fire, if set */
+	int rearm; /* Period with which timers are re-armed, if set */
+} fire_log_t;
+
+/**
+ * Lifecycle
+ */
+
+int run_test(timer_wheel_t* (*setup)(void), void (*teardown)(timer_wheel_t*), timer_wheel_t* (*test)(timer_wheel_t*)) {
+	teardown(test(setup()));
+}
+
+timer_wheel_t* setup(void) {
+	timer_wheel_t* w = malloc(sizeof(timer_wheel_t));
+
+	timer_wheel_init(w, 0);
+
+	return w;
+}
+
+void teardown(timer_wheel_t* w) {
+	free(w);
+}
+
+/**
+ * Helpers
+ */
+
+conn_t* conn_of(wheel_timer_t* t) {
+	return GET_DATA_FROM_OFFSET(t, offsetof(conn_t, timer));
+}
+
+void record(wheel_timer_t* t, void* ctx) {
+	fire_log_t* log = ctx;
+	conn_t* c = conn_of(t);
+
+	c->fired_at = log->w->now - 1;
+	c->fired++;
+	log->order[log->n++] = c->id;
+
+	if (log->cancel) {
+		timer_wheel_cancel(log->w, &log->cancel->timer);
+		log->cancel = NULL;
+	}
+
+	if (log->rearm) timer_wheel_arm(log->w, t, c->fired_at + log->rearm);
+}
+
+void fire_exact(wheel_timer_t* t, void* ctx) {
+	timer_wheel_t* w = ctx;
+	conn_t* c = conn_of(t);
+
+	assert(!wheel_timer_is_armed(t));
+
+	c->fired_at = w->now - 1;
+	c->fired++;
+}
+
+/**
+ * Tests
+ */
+
+timer_wheel_t* test_arm_fire(timer_wheel_t* w) {
+	DESCRIBE();
+
+	conn_t c[4] = { { .id = 0 }, { .id = 1 }, { .id = 2 }, { .id = 3 } };
+	uint64_t expires[4] = { 70000, 300, 5, 0 };
+	fire_log_t log = { .w = w };
+
+	for (int i = 0; i < 4; i++) {
+		wheel_timer_init(&c[i].timer);
+		timer_wheel_arm(w, &c[i].timer, expires[i]);
+	}
+
+	ASSERT(w->size == 4 && wheel_timer_is_armed(&c[0].timer), "arms the timers");
+
+	ASSERT(timer_wheel_advance(w, 4, record, &log) == 1 && c[3].fired_at == 0, "fires a timer due at the next tick");
+	ASSERT(timer_wheel_advance(w, 5, record, &log) == 1 && c[2].fired_at == 5, "fires a timer on the tick it is due");
+	ASSERT(timer_wheel_advance(w, 299, record, &log) == 0, "does not fire timers early");
+	ASSERT(timer_wheel_advance(w, 300, record, &log) == 1 && c[1].fired_at == 300, "fires a timer cascaded from the second level");
+	ASSERT(timer_wheel_advance(w, 100000, record, &log) == 1 && c[0].fired_at == 70000, "fires a timer cascaded from the third level");
+
+	ASSERT(log.n == 4 && log.order[0] == 3 && log.order[3] == 0 && w->size == 0, "fires every timer once, in order");
+
+	return w;
+}
+
+timer_wheel_t* test_cancel_rearm(timer_wheel_t* w) {
+	DESCRIBE();
+
+	conn_t a = { .id = 0 }, b = { .id = 1 }, c = { .id = 2 };
+	fire_log_t log = { .w = w };
+
+	wheel_timer_init(&a.timer);
+	wheel_timer_init(&b.timer);
+	wheel_timer_init(&c.timer);
+
+	ASSERT(timer_wheel_cancel(w, &a.timer) == -1, "is a no-op when cancelling an unarmed timer");
+
+	timer_wheel_arm(w, &a.timer, 10);
+	timer_wheel_arm(w, &a.timer, 20);
+
+	ASSERT(w->size == 1, "re-arms an armed timer");
+	ASSERT(timer_wheel_advance(w, 19, record, &log) == 0 && timer_wheel_advance(w, 20, record, &log) == 1, "fires at the re-armed tick");
+
+	timer_wheel_arm(w, &a.timer, 30);
+	timer_wheel_arm(w, &b.timer, 30);
+	timer_wheel_arm(w, &c.timer, 30);
+	a.fired = log.n = 0;
+	log.cancel = &a; // the slot is walked newest first, so c fires first and cancels a, still in its batch
+
+	ASSERT(timer_wheel_advance(w, 30, record, &log) == 2 && !a.fired, "cancels a timer from within a batch");
+
+	log.rearm = 100;
+	timer_wheel_arm(w, &a.timer, 40);
+	timer_wheel_advance(w, 1000, record, &log);
+
+	ASSERT(a.fired == 10 && a.fired_at == 940 && w->size == 1, "re-arms a timer from its callback");
+
+	timer_wheel_cancel(w, &a.timer);
+
+	ASSERT(w->size == 0 && !wheel_timer_is_armed(&a.timer), "disarms the timer");
+
+	return w;
+}
+
+timer_wheel_t* test_far_future(timer_wheel_t* w) {
+	DESCRIBE();
+
+	conn_t c = { .id = 0 };
+
+	wheel_timer_init(&c.timer);
+	timer_wheel_arm(w, &c.timer, UINT64_MAX);
+
+	ASSERT(timer_wheel_advance(w, FUZZ_HORIZON, fire_exact, w) == 0 && wheel_timer_is_armed(&c.timer), "holds timers due beyond the wheel's range");
+
+	timer_wheel_cancel(w, &c.timer);
+
+	return w;
+}
+
+timer_wheel_t* test_fuzz(timer_wheel_t* w) {
+	DESCRIBE();
+
+	conn_t* c = calloc(FUZZ_N, sizeof(conn_t));
+	int* cancelled = calloc(FUZZ_N, sizeof(int));
+
+	for (int i = 0; i < FUZZ_N; i++) {
+		wheel_timer_init(&c[i].timer);
+		timer_wheel_arm(w, &c[i].timer, random() % (i % 2 ? 1 << 12 : FUZZ_HORIZON));
+	}
+
+	while (w->size) {
+		int i = random() % FUZZ_N;
+
+		if (random() % 4 == 0 && timer_wheel_cancel(w, &c[i].timer) == 0) cancelled[i] = 1;
+
+		timer_wheel_advance(w, w->now + random() % 4096, fire_exact, w);
+	}
+
+	for (int i = 0; i < FUZZ_N; i++) {
+		assert(cancelled[i] ? c[i].fired == 0 : c[i].fired == 1);
+		assert(cancelled[i] || c[i].fired_at == c[i].timer.expires);
+	}
+
+	ASSERT(1, "fires every uncancelled timer exactly once, on the tick it is due");
+
+	free(c);
+	free(cancelled);
+
+	return w;
+}
+
+/**
+ * Runner
+ */
+
+int main() {
+	run_test(setup, teardown, test_arm_fire);
+	run_test(setup, teardown, test_cancel_rearm);
+	run_test(setup, teardown, test_far_future);
+	run_test(setup, teardown, test_fuzz);
+
+	return EXIT_SUCCESS;
+}
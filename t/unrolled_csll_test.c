@@ -0,0 +1,192 @@
+#include "test_util.h"
+
+#include "libcartilage.h"
+
+#include <stdint.h>
+
+#define FUZZ_OPS 20000
+#define FUZZ_MAX 512
+
+/**
+ * Environment
+ */
+
+typedef UnrolledCircularSinglyLinkedList LinkedList;
+
+static intptr_t visited[FUZZ_MAX * 2];
+static uint32_t visited_n;
+
+/**
+ * Lifecycle
+ */
+
+int run_test(LinkedList* (*setup)(void), void (*teardown)(LinkedList*), LinkedList* (*test)(LinkedList*)) {
+	teardown(test(setup()));
+}
+
+LinkedList* setup(void) {
+	return ucsll_make_list();
+}
+
+void teardown(LinkedList* ll) {
+	ucsll_destroy_list(ll);
+}
+
+/**
+ * Helpers
+ */
+
+void visit(void* value) {
+	visited[visited_n++] = (intptr_t)value;
+}
+
+/* Asserts the list holds exactly `expected`, in order, and that its nodes are congruent with its size */
+void assert_contents(LinkedList* ll, intptr_t* expected, uint32_t n) {
+	assert(ll->size == n);
+
+	visited_n = 0;
+	ucsll_iterate(ll, visit);
+
+	assert(visited_n == n);
+	for (uint32_t i = 0; i < n; i++) assert(visited[i] == expected[i]);
+
+	uint32_t total = 0;
+	UnrolledNode_t* node = ll->head;
+
+	for (uint32_t i = 0; i < ll->nodes; i++, node = node->next) {
+		assert(node->count > 0 && node->count <= UCSLL_NODE_CAPACITY);
+		total += node->count;
+	}
+
+	assert(node == ll->head);
+	assert(total == n);
+	assert(!n || ll->tail->next == ll->head);
+}
+
+/**
+ * Tests
+ */
+
+LinkedList* test_push_pop(LinkedList* ll) {
+	DESCRIBE();
+
+	ASSERT(ucsll_pop(ll) == NULL && ucsll_pop_front(ll) == NULL, "returns NULL when popping an empty list");
+
+	ucsll_push_back(ll, (void*)'B');
+	ucsll_push_back(ll, (void*)'C');
+	ucsll_push_front(ll, (void*)'A');
+
+	assert_contents(ll, (intptr_t[]){ 'A', 'B', 'C' }, 3);
+	ASSERT(ll->nodes == 1, "packs values into a single node");
+
+	ASSERT(ucsll_pop(ll) == (void*)'C', "pops the back");
+	ASSERT(ucsll_pop_front(ll) == (void*)'A', "pops the front");
+	ASSERT(ucsll_pop(ll) == (void*)'B' && ll->head == NULL && ll->nodes == 0, "empties the list");
+
+	return ll;
+}
+
+LinkedList* test_split_merge(LinkedList* ll) {
+	DESCRIBE();
+
+	intptr_t expected[UCSLL_NODE_CAPACITY * 2];
+	uint32_t n = UCSLL_NODE_CAPACITY;
+
+	for (uint32_t i = 0; i < n; i++) {
+		ucsll_push_back(ll, (void*)(intptr_t)i);
+		expected[i] = i;
+	}
+
+	ASSERT(ll->nodes == 1, "fills a node before allocating another");
+
+	ucsll_insert_after(ll, (void*)-1, 2);
+	for (uint32_t i = n; i > 3; i--) expected[i] = expected[i - 1];
+	expected[3] = -1;
+	n++;
+
+	ASSERT(ll->nodes == 2, "splits a full node on insert");
+	assert_contents(ll, expected, n);
+
+	while (ll->nodes > 1) {
+		ucsll_remove_at(ll, 0);
+
+		for (uint32_t i = 0; i < n - 1; i++) expected[i] = expected[i + 1];
+		n--;
+	}
+
+	ASSERT(n >= UCSLL_NODE_CAPACITY / 2, "merges underfull nodes on remove");
+	assert_contents(ll, expected, n);
+
+	ASSERT(ucsll_get(ll, n) == NULL && ucsll_remove_at(ll, n) == NULL, "rejects out-of-range positions");
+	ASSERT(ucsll_insert_before(ll, NULL, n + 1) == -1, "rejects out-of-range insertions");
+
+	return ll;
+}
+
+LinkedList* test_fuzz(LinkedList* ll) {
+	DESCRIBE();
+
+	intptr_t expected[FUZZ_MAX * 2];
+	uint32_t n = 0;
+
+	for (int op = 0; op < FUZZ_OPS; op++) {
+		intptr_t v = op;
+		uint32_t at = n ? random() % (n + 1) : 0;
+
+		switch (n >= FUZZ_MAX ? 4 + random() % 3 : random() % 7) {
+			case 0:
+				ucsll_push_back(ll, (void*)v);
+				expected[n++] = v;
+				break;
+			case 1:
+				ucsll_push_front(ll, (void*)v);
+				for (uint32_t i = n; i > 0; i--) expected[i] = expected[i - 1];
+				expected[0] = v;
+				n++;
+				break;
+			case 2:
+			case 3:
+				ucsll_insert_before(ll, (void*)v, at);
+				for (uint32_t i = n; i > at; i--) expected[i] = expected[i - 1];
+				expected[at] = v;
+				n++;
+				break;
+			case 4:
+				if (!n) break;
+				assert(ucsll_pop(ll) == (void*)expected[--n]);
+				break;
+			case 5:
+				if (!n) break;
+				assert(ucsll_pop_front(ll) == (void*)expected[0]);
+				for (uint32_t i = 0; i < n - 1; i++) expected[i] = expected[i + 1];
+				n--;
+				break;
+			case 6:
+				if (at >= n) break;
+				assert(ucsll_get(ll, at) == (void*)expected[at]);
+				assert(ucsll_remove_at(ll, at) == (void*)expected[at]);
+				for (uint32_t i = at; i < n - 1; i++) expected[i] = expected[i + 1];
+				n--;
+				break;
+		}
+
+		assert(ll->size == n);
+	}
+
+	assert_contents(ll, expected, n);
+	ASSERT(1, "agrees with an array under random operations");
+
+	return ll;
+}
+
+/**
+ * Runner
+ */
+
+int main() {
+	run_test(setup, teardown, test_push_pop);
+	run_test(setup, teardown, test_split_merge);
+	run_test(setup, teardown, test_fuzz);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,165 @@
+#include "test_util.h"
+
+#include "libcartilage.h"
+#include <pthread.h>
+#include <sched.h>
+
+#define THIEVES 3
+#define ITEMS 200000
+
+/**
+ * Environment
+ */
+
+typedef struct worker_arg {
+	ws_deque_t* d;
+	_Atomic(int)* seen;
+	_Atomic(int)* done;
+	size_t taken;
+} worker_arg_t;
+
+void take(worker_arg_t* w, void* elem) {
+	atomic_fetch_add(&w->seen[(uintptr_t)elem - 1], 1);
+	w->taken++;
+}
+
+void* steal(void* arg) {
+	worker_arg_t* w = arg;
+
+	for (;;) {
+		void* elem = ws_deque_steal(w->d);
+
+		if (elem) {
+			take(w, elem);
+		} else if (atomic_load(w->done) && !ws_deque_size(w->d)) {
+			break;
+		} else {
+			sched_yield();
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Lifecycle
+ */
+
+int run_test(ws_deque_t* (*setup)(void), void (*teardown)(ws_deque_t*), ws_deque_t* (*test)(ws_deque_t*)) {
+	teardown(test(setup()));
+}
+
+ws_deque_t* setup(void) {
+	return ws_deque_make(0);
+}
+
+void teardown(ws_deque_t* d) {
+	ws_deque_destroy(d);
+}
+
+/**
+ * Tests
+ */
+
+ws_deque_t* test_owner_lifo(ws_deque_t* d) {
+	DESCRIBE();
+
+	ASSERT(ws_deque_pop(d) == NULL && ws_deque_steal(d) == NULL, "returns NULL when empty");
+
+	ws_deque_push(d, (void*)1);
+	ws_deque_push(d, (void*)2);
+	ws_deque_push(d, (void*)3);
+
+	ASSERT(ws_deque_size(d) == 3, "pushes elements");
+	ASSERT(ws_deque_pop(d) == (void*)3 && ws_deque_pop(d) == (void*)2, "pops the most recent element");
+	ASSERT(ws_deque_steal(d) == (void*)1 && ws_deque_pop(d) == NULL, "steals the oldest element");
+
+	ws_deque_push(d, (void*)4);
+	ws_deque_push(d, (void*)5);
+	ws_deque_push(d, (void*)6);
+
+	ASSERT(ws_deque_steal(d) == (void*)4 && ws_deque_pop(d) == (void*)6 && ws_deque_steal(d) == (void*)5, "works both ends");
+	ASSERT(ws_deque_size(d) == 0, "empties the deque");
+
+	return d;
+}
+
+ws_deque_t* test_growth(ws_deque_t* d) {
+	DESCRIBE();
+
+	for (uintptr_t i = 1; i <= 1000; i++) {
+		ws_deque_push(d, (void*)i);
+
+		if (i == 8) ws_deque_steal(d); // advances top, such that the contents wrap the array
+	}
+
+	ASSERT(ws_deque_size(d) == 999, "grows when full");
+
+	int ordered = ws_deque_steal(d) == (void*)2;
+
+	for (uintptr_t i = 1000; i > 2; i--) ordered &= ws_deque_pop(d) == (void*)i;
+
+	ASSERT(ordered && ws_deque_pop(d) == NULL, "keeps every element in order across growth");
+
+	ASSERT(ws_deque_make(SIZE_MAX) == NULL, "rejects a capacity that cannot be rounded up to a power of two");
+	ASSERT(ws_deque_make(SIZE_MAX / sizeof(void*)) == NULL, "rejects a capacity whose slots overflow a size_t");
+
+	return d;
+}
+
+ws_deque_t* test_concurrent(ws_deque_t* d) {
+	DESCRIBE();
+
+	pthread_t thieves[THIEVES];
+	worker_arg_t args[THIEVES + 1];
+	_Atomic(int)* seen = calloc(ITEMS, sizeof(_Atomic(int)));
+	_Atomic(int) done = 0;
+
+	for (int i = 0; i <= THIEVES; i++) args[i] = (worker_arg_t){ .d = d, .seen = seen, .done = &done };
+
+	for (int i = 0; i < THIEVES; i++) pthread_create(&thieves[i], NULL, steal, &args[i]);
+
+	worker_arg_t* owner = &args[THIEVES];
+
+	for (uintptr_t i = 1; i <= ITEMS; i++) {
+		ws_deque_push(d, (void*)i);
+
+		if (i % 3 == 0) {
+			void* elem = ws_deque_pop(d);
+
+			if (elem) take(owner, elem);
+		}
+	}
+
+	void* elem;
+
+	while ((elem = ws_deque_pop(d))) take(owner, elem);
+
+	atomic_store(&done, 1);
+
+	for (int i = 0; i < THIEVES; i++) pthread_join(thieves[i], NULL);
+
+	size_t taken = 0;
+	int once = 1;
+
+	for (int i = 0; i <= THIEVES; i++) taken += args[i].taken;
+	for (int i = 0; i < ITEMS; i++) once &= seen[i] == 1;
+
+	ASSERT(taken == ITEMS && once, "hands every element to exactly one thread");
+
+	free(seen);
+
+	return d;
+}
+
+/**
+ * Runner
+ */
+
+int main() {
+	run_test(setup, teardown, test_owner_lifo);
+	run_test(setup, teardown, test_growth);
+	run_test(setup, teardown, test_concurrent);
+
+	return EXIT_SUCCESS;
+}